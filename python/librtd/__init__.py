@@ -1,6 +1,8 @@
 import smbus2 as smbus
 import struct
 
+from . import calib
+
 # bus = smbus.SMBus(1)    # 0 = /dev/i2c-0 (port I2C0), 1 = /dev/i2c-1 (port I2C1)
 
 DEVICE_ADDRESS = 0x40  # 7 bit address (will be left shifted to add the read write bit)
@@ -19,6 +21,10 @@ def get(stack, channel):
     try:
         buff = bus.read_i2c_block_data(DEVICE_ADDRESS + stack, RTD_TEMPERATURE_ADD + (4 * (channel - 1)), 4)
         val = struct.unpack('f', bytearray(buff))
+        p = calib.profile(stack, channel)
+        if p is not None:
+            buff = bus.read_i2c_block_data(DEVICE_ADDRESS + stack, RTD_RESISTANCE_ADD + (4 * (channel - 1)), 4)
+            val = (calib.correct_temp(p, val[0], struct.unpack('f', bytearray(buff))[0]),)
     except Exception as e:
         bus.close()
         raise ValueError('Fail to communicate with the RTD card with message: \"' + str(e) + '\"')
@@ -36,6 +42,9 @@ def getRes(stack, channel):
     try:
         buff = bus.read_i2c_block_data(DEVICE_ADDRESS + stack, RTD_RESISTANCE_ADD + (4 * (channel - 1)), 4)
         val = struct.unpack('f', bytearray(buff))
+        p = calib.profile(stack, channel)
+        if p is not None:
+            val = (calib.correct_res(p, val[0]),)
     except Exception as e:
         bus.close()
         raise ValueError('Fail to communicate with the RTD card with message: \"' + str(e) + '\"')
@@ -43,6 +52,10 @@ def getRes(stack, channel):
     return val[0]
 
 
+# c0..c5 of the 5th order fit used by get_poly5() and poly5_batch()
+POLY5_PT100 = (-2.42522E+02, 2.24745E+00, 2.38589E-03, -8.20888E-06, 2.27311E-08, -2.10678E-11)
+
+
 def get_poly5(stack: int, channel: int) -> float:
     """
     Convert RTD reading to Temperature, using 5th order polynomial fit of Temperature as a function of Resistance.
@@ -59,12 +72,7 @@ def get_poly5(stack: int, channel: int) -> float:
     """
 
     # coeffs for 5th order fit
-    c5 = -2.10678E-11
-    c4 = 2.27311E-08
-    c3 = -8.20888E-06
-    c2 = 2.38589E-03
-    c1 = 2.24745E+00
-    c0 = -2.42522E+02
+    c0, c1, c2, c3, c4, c5 = POLY5_PT100
 
     # get RTD resistance
     res = getRes(stack, channel)
@@ -87,3 +95,26 @@ def get_poly5(stack: int, channel: int) -> float:
     temp_C += c0
 
     return temp_C
+
+
+def poly5_batch(res, coeffs=POLY5_PT100):
+    """
+    Convert many resistances at once with the 5th order polynomial of get_poly5(), for recorded logs.
+    With numpy the whole array is evaluated in vector form (float32, like rtd_poly5_batch in C).
+
+    :param res: sequence or numpy array of resistances in ohms
+    :param coeffs: (c0, c1, c2, c3, c4, c5), default POLY5_PT100
+    :return: numpy float32 array, or a list of floats without numpy
+    """
+    c0, c1, c2, c3, c4, c5 = coeffs
+    try:
+        import numpy as np
+        r = np.asarray(res, dtype=np.float32)
+        c = np.asarray(coeffs, dtype=np.float32)
+        t = r * c[5] + c[4]
+        for k in (3, 2, 1, 0):
+            t *= r
+            t += c[k]
+        return t
+    except ImportError:
+        return [((((r * c5 + c4) * r + c3) * r + c2) * r + c1) * r + c0 for r in res]
@@ -0,0 +1,103 @@
+import mmap
+import struct
+
+# Binary capture written by "rtd <id> stream ... -bin" and "rtd -batch -bin", described in src/rtdbin.h
+MAGIC = 0x42445452
+VERSION = 1
+HEADER = struct.Struct('<IHHHHIq')
+COLUMN = struct.Struct('<BBBB')
+TS_END = 0xffffffffffffffff
+
+DEGC = 0
+OHM = 1
+
+
+class Segment:
+    """
+    Records sharing the same columns.
+
+    columns: list of (bus, stack, channel, unit) tuples
+    real_offset: seconds to add to a record time to get the wall clock
+    ts: CLOCK_MONOTONIC time of every record (seconds)
+    values: one row per record, one value per column
+    With numpy installed ts and values are arrays, values views the capture buffer without any copy.
+    """
+
+    def __init__(self, columns, real_offset, buff, offset, count, rec_size):
+        self.columns = columns
+        self.real_offset = real_offset
+        try:
+            import numpy as np
+            dtype = np.dtype({'names': ['ts', 'val'],
+                              'formats': ['<u8', ('<f4', (len(columns),))],
+                              'offsets': [0, 8], 'itemsize': rec_size})
+            rec = np.frombuffer(buff, dtype=dtype, count=count, offset=offset)
+            self.ts = rec['ts'] / 1e9
+            self.values = rec['val']
+        except ImportError:
+            fmt = struct.Struct('<Q%df' % len(columns))
+            rows = [fmt.unpack_from(buff, offset + i * rec_size) for i in range(count)]
+            self.ts = [r[0] / 1e9 for r in rows]
+            self.values = [r[1:] for r in rows]
+
+    def __len__(self):
+        return len(self.ts)
+
+
+def _count(buff, off, rec_size):
+    # records up to the end of segment marker or the end of the data
+    n = (len(buff) - off) // rec_size
+    try:
+        import numpy as np
+        ts = np.ndarray((n,), dtype='<u8', buffer=buff, offset=off, strides=(rec_size,))
+        end = np.flatnonzero(ts == TS_END)
+        return int(end[0]) if len(end) else n
+    except ImportError:
+        for i in range(n):
+            if struct.unpack_from('<Q', buff, off + i * rec_size)[0] == TS_END:
+                return i
+        return n
+
+
+def decode(buff):
+    """
+    Split a capture into segments.
+
+    :param buff: bytes, bytearray, mmap or memoryview holding the capture
+    :return: (list of Segment, number of trailing bytes of an incomplete record)
+    """
+    segments = []
+    off = 0
+    size = len(buff)
+    while off < size:
+        if size - off < HEADER.size:
+            break
+        magic, version, hdr_size, cols, rec_size, _, real_offset = HEADER.unpack_from(buff, off)
+        if magic != MAGIC or version < VERSION or hdr_size < HEADER.size or cols == 0 \
+                or rec_size < 8 + 4 * cols:
+            raise ValueError('Not a capture or corrupted at byte %d' % off)
+        if size - off < hdr_size + cols * COLUMN.size:
+            break
+        columns = [COLUMN.unpack_from(buff, off + hdr_size + i * COLUMN.size) for i in range(cols)]
+        off += hdr_size + cols * COLUMN.size
+        first = off
+        count = _count(buff, off, rec_size)
+        off += count * rec_size
+        segments.append(Segment(columns, real_offset / 1e9, buff, first, count, rec_size))
+        if size - off >= rec_size:
+            off += rec_size  # end of segment marker
+        else:
+            break
+    return segments, size - off
+
+
+def read(path):
+    """
+    Map a capture file and decode it, the records are not copied.
+
+    :param path: capture file name
+    :return: list of Segment
+    """
+    with open(path, 'rb') as f:
+        m = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+    return decode(m)[0]
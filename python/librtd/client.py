@@ -0,0 +1,93 @@
+import os
+import socket
+import struct
+
+# Binary query protocol of the rtdd daemon, described in src/rtdd.h
+SOCKET_PATH = os.environ.get('RTDD_SOCKET') or '/run/rtdd.sock'
+FRAME = struct.Struct('=IIHbB')
+ITEM = struct.Struct('=BBBB')
+VALUE = struct.Struct('=bBxxfQ')
+ITEMS_MAX = 2048
+
+TEMP = 0
+RES = 1
+TEMP_FILT = 2  # through the filter chain of the channel, see librtd.filter
+RES_FILT = 3
+
+
+class Client:
+    """
+    Connection to the rtdd daemon. query() is one round trip for any set of
+    (stack, channel, quantity[, bus]) tuples; send() and recv() let several
+    requests be in flight on the same connection.
+    """
+
+    def __init__(self, path=SOCKET_PATH):
+        self._sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self._sock.connect(path)
+        self._tag = 0
+
+    def close(self):
+        self._sock.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def send(self, items):
+        """
+        Write one request without waiting for the response.
+
+        :param items: list of (stack, channel, quantity) or (stack, channel, quantity, bus) tuples
+        :return: tag echoed by the matching recv()
+        """
+        if len(items) > ITEMS_MAX:
+            raise ValueError('Too many items')
+        self._tag = (self._tag + 1) & 0xffffffff
+        buff = bytearray(FRAME.pack(FRAME.size + len(items) * ITEM.size, self._tag, len(items), 0, 0))
+        for it in items:
+            bus = it[3] if len(it) > 3 else 1
+            buff += ITEM.pack(bus, it[0], it[1], it[2])
+        self._sock.sendall(buff)
+        return self._tag
+
+    def _read(self, size):
+        buff = bytearray()
+        while len(buff) < size:
+            chunk = self._sock.recv(size - len(buff))
+            if not chunk:
+                raise ConnectionError('rtdd closed the connection')
+            buff += chunk
+        return buff
+
+    def recv(self, with_fault=False):
+        """
+        Read the next response.
+
+        :param with_fault: add the sensor fault of the channel to every value, see shm.FAULTS
+        :return: (tag, values), values is a list of (value, ts) tuples in the request order,
+                 value is None if the board is not polled, ts is CLOCK_MONOTONIC seconds
+        """
+        length, tag, count, status, _ = FRAME.unpack(self._read(FRAME.size))
+        if length != FRAME.size + count * VALUE.size:
+            raise ConnectionError('Invalid rtdd response')
+        raw = self._read(count * VALUE.size)
+        if status != 0:
+            raise ValueError('Request refused by rtdd')
+        values = []
+        for i in range(count):
+            st, fault, val, ts = VALUE.unpack_from(raw, i * VALUE.size)
+            if with_fault:
+                values.append((val if st == 0 else None, ts / 1e9, fault))
+            else:
+                values.append((val if st == 0 else None, ts / 1e9))
+        return tag, values
+
+    def query(self, items, with_fault=False):
+        """
+        Send one request and wait for its response, see send() and recv().
+        """
+        self.send(items)
+        return self.recv(with_fault)[1]
@@ -0,0 +1,132 @@
+import math
+import os
+import tempfile
+
+# Per channel filter chains set by "rtd <id> filterwr", applied by rtdd and "rtd <id> stream",
+# file format and filter definitions in src/filter.h
+FILTER_PATH = os.environ.get('RTD_FILTERS') or '/etc/rtd-filters'
+FILTER_STAGES = 4
+FILTER_WIN_MAX = 16
+
+
+def parse(spec):
+    """
+    Filter chain from its text, "median:5,boxcar:8,ema:0.2" or "none".
+
+    :return: list of (name, parameter) stages
+    """
+    if spec.lower() == 'none':
+        return []
+    chain = []
+    for tok in spec.split(','):
+        name, _, arg = tok.partition(':')
+        name = name.lower()
+        if name == 'ema':
+            alpha = float(arg)
+            if not 0 < alpha <= 1:
+                raise ValueError('Invalid ema factor')
+            chain.append((name, alpha))
+        elif name in ('median', 'boxcar'):
+            n = int(arg)
+            if n < 2 or n > FILTER_WIN_MAX or (name == 'median' and not n & 1):
+                raise ValueError('Invalid window')
+            chain.append((name, n))
+        else:
+            raise ValueError('Unknown filter ' + name)
+    if not chain or len(chain) > FILTER_STAGES:
+        raise ValueError('Invalid filter chain')
+    return chain
+
+
+def format(chain):
+    if not chain:
+        return 'none'
+    return ','.join('%s:%g' % (name, arg) for name, arg in chain)
+
+
+def _read():
+    chains = {}
+    try:
+        with open(FILTER_PATH) as f:
+            for line in f:
+                items = line.split()
+                if len(items) != 4:
+                    continue
+                try:
+                    chains[(int(items[0]), int(items[1]), int(items[2]))] = parse(items[3])
+                except ValueError:
+                    pass
+    except OSError:
+        pass
+    return chains
+
+
+def chain(stack, channel, bus=1):
+    """
+    Filter chain of one channel, [] without filter.
+    """
+    return _read().get((bus, stack, channel), [])
+
+
+def set_chain(stack, channel, spec, bus=1):
+    """
+    Set the filter chain of one channel, "none" removes it. A running rtdd resets its filters.
+    """
+    if stack < 0 or stack > 7:
+        raise ValueError('Invalid stack level')
+    if channel < 1 or channel > 8:
+        raise ValueError('Invalid channel number')
+    stages = parse(spec)
+    lines = []
+    try:
+        with open(FILTER_PATH) as f:
+            for line in f:
+                items = line.split()
+                if len(items) >= 3 and items[:3] == [str(bus), str(stack), str(channel)]:
+                    continue
+                lines.append(line)
+    except OSError:
+        pass
+    if stages:
+        lines.append('%d %d %d %s\n' % (bus, stack, channel, format(stages)))
+    fd, tmp = tempfile.mkstemp(prefix='.rtd-filters.', dir=os.path.dirname(FILTER_PATH) or '.')
+    try:
+        os.fchmod(fd, 0o644)
+        with os.fdopen(fd, 'w') as f:
+            f.writelines(lines)
+        os.rename(tmp, FILTER_PATH)
+    except OSError:
+        os.unlink(tmp)
+        raise
+
+
+class Filter:
+    """
+    One filter chain with its state, gives the same output as rtdFilterRun().
+
+    f = Filter(chain(0, 2))
+    y = f.run(x)
+    """
+
+    def __init__(self, stages):
+        self.stages = [(name, arg, []) for name, arg in stages]
+        self.y = [None] * len(stages)
+
+    def run(self, x):
+        if math.isnan(x):
+            return x
+        for i, (name, arg, win) in enumerate(self.stages):
+            if name == 'ema':
+                self.y[i] = x if self.y[i] is None else self.y[i] + arg * (x - self.y[i])
+                x = self.y[i]
+                continue
+            win.append(x)
+            if len(win) > arg:
+                del win[0]
+            if name == 'boxcar':
+                x = sum(win) / len(win)
+            else:
+                s = sorted(win)
+                n = len(s)
+                x = s[n // 2] if n & 1 else (s[n // 2 - 1] + s[n // 2]) / 2
+        return x
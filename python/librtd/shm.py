@@ -0,0 +1,129 @@
+import mmap
+import os
+import struct
+import time
+
+# Latest readings published by the rtdd daemon, layout described in src/rtdshm.h
+SHM_PATH = '/dev/shm/rtdd-snapshot'
+SHM_MAGIC = 0x50534452
+SHM_VERSION = 2
+HEADER = struct.Struct('<IIIIQ')
+BOARD = struct.Struct('<IBBBBQffiiQQ')
+CHANNEL = struct.Struct('<ffQIiff')
+BOARD_SIZE = BOARD.size + 8 * CHANNEL.size
+READ_TRIES = 10000  # a writer that died in the middle of an update leaves the entry odd
+# channel status codes above 0, the sensor faults found by rtdd (src/fault.h)
+FAULTS = ('ok', 'open', 'short', 'rate', 'stuck', 'invalid')
+
+_map = None
+
+
+def _open():
+    global _map
+    if _map is None:
+        with open(SHM_PATH, 'rb') as f:
+            if os.fstat(f.fileno()).st_uid not in (0, os.geteuid()):
+                raise ValueError('rtdd snapshot not owned by root')
+            m = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        magic, version, board_size, boards_max, _ = HEADER.unpack_from(m, 0)
+        if magic != SHM_MAGIC or version != SHM_VERSION or board_size != BOARD_SIZE:
+            m.close()
+            raise ValueError('Unknown rtdd snapshot format')
+        _map = m
+    return _map
+
+
+def read_board(stack, bus=1):
+    """
+    Consistent copy of one board from the rtdd snapshot, no i2c access.
+
+    :param stack: 0-7, card stack level
+    :param bus: i2c bus number
+    :return: dict with 'ts' (CLOCK_MONOTONIC seconds), 'vin', 'vrasp', 'cpu_temp', 'wdt_resets' and
+             'channels', a list of 8 (temperature, resistance, ts, seq, status, filtered temperature,
+             filtered resistance) tuples, status is 0 for a valid reading, -1 if the board was not
+             read, else an index in FAULTS. The filtered values are the output of the filter chain of
+             the channel (librtd.filter), the readings themselves without one
+    """
+    if stack < 0 or stack > 7:
+        raise ValueError('Invalid stack level')
+    m = _open()
+    off = HEADER.size + (bus * 8 + stack) * BOARD_SIZE
+    for _ in range(READ_TRIES):
+        seq1 = struct.unpack_from('<I', m, off)[0]
+        if seq1 & 1:
+            continue
+        raw = m[off:off + BOARD_SIZE]
+        seq2 = struct.unpack_from('<I', m, off)[0]
+        if seq1 == seq2:
+            break
+    else:
+        raise ValueError('rtdd snapshot entry never settles')
+    b = BOARD.unpack_from(raw, 0)
+    if not b[1]:
+        raise ValueError('Board not polled by rtdd')
+    channels = [CHANNEL.unpack_from(raw, BOARD.size + i * CHANNEL.size) for i in range(8)]
+    return {'ts': b[5] / 1e9, 'vin': b[6], 'vrasp': b[7], 'cpu_temp': b[8], 'wdt_resets': b[9],
+            'channels': channels}
+
+
+def _valid(stack, channel, bus, max_age):
+    if channel < 1 or channel > 8:
+        raise ValueError('Invalid channel number')
+    ch = read_board(stack, bus)['channels'][channel - 1]
+    status = ch[4]
+    if status > 0:
+        raise ValueError('Sensor fault: ' + fault_name(status))
+    if status != 0 or time.clock_gettime(time.CLOCK_MONOTONIC) - ch[2] / 1e9 > max_age:
+        raise ValueError('No valid reading')
+    return ch
+
+
+def get(stack, channel, bus=1, max_age=5.0):
+    """
+    Temperature of one channel from the rtdd snapshot.
+
+    :param stack: 0-7, card stack level
+    :param channel: 1-8
+    :param bus: i2c bus number
+    :param max_age: raise ValueError if the reading is older than this (seconds)
+    :return: temperature in deg Celsius
+    """
+    return _valid(stack, channel, bus, max_age)[0]
+
+
+def getRes(stack, channel, bus=1, max_age=5.0):
+    """
+    Resistance of one channel from the rtdd snapshot, see get().
+    """
+    return _valid(stack, channel, bus, max_age)[1]
+
+
+def getFilt(stack, channel, bus=1, max_age=5.0):
+    """
+    Temperature of one channel through its filter chain, from the rtdd snapshot, see get().
+    """
+    return _valid(stack, channel, bus, max_age)[5]
+
+
+def getResFilt(stack, channel, bus=1, max_age=5.0):
+    """
+    Resistance of one channel through its filter chain, from the rtdd snapshot, see get().
+    """
+    return _valid(stack, channel, bus, max_age)[6]
+
+
+def fault_name(status):
+    return FAULTS[status] if 0 <= status < len(FAULTS) else 'unknown'
+
+
+def fault(stack, channel, bus=1):
+    """
+    Sensor fault of one channel found by rtdd: 'ok', 'open', 'short', 'rate', 'stuck' or 'invalid'.
+    """
+    if channel < 1 or channel > 8:
+        raise ValueError('Invalid channel number')
+    status = read_board(stack, bus)['channels'][channel - 1][4]
+    if status < 0:
+        raise ValueError('No valid reading')
+    return fault_name(status)
@@ -0,0 +1,632 @@
+/*
+ * board.c:
+ *	Card access routines shared by the command line and the daemon
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ *	Author: Alexandru Burcea
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "rtd.h"
+#include "comm.h"
+#include "topo.h"
+#include "calib.h"
+
+static int gProbeCache = 0;
+static u8 gProbed[I2C_BUS_MAX * 8];
+
+/*
+ * boardProbeCache:
+ *	When enabled, doBoardInit() checks every card only once per process,
+ *	for the long running modes
+ */
+void boardProbeCache(int enable)
+{
+	gProbeCache = enable;
+	memset(gProbed, 0, sizeof(gProbed));
+}
+
+/* rev: the 4 bytes at REVISION_HW_MAJOR_MEM_ADD */
+static void boardTopoRecord(int bus, int stack, const u8 *rev)
+{
+	RtdTopoType topo;
+
+	memset(&topo, 0, sizeof(topo));
+	topo.hwMajor = rev[0];
+	topo.hwMinor = rev[1];
+	topo.fwMajor = rev[2];
+	topo.fwMinor = rev[3];
+	topo.hwType = TOPO_UNSET; // read when first needed
+	topo.sensorType = TOPO_UNSET;
+	topoPut(bus, stack, &topo);
+}
+
+/*
+ * doBoardInit:
+ *	Open the card and check it answers, unless the topology cache saw it
+ *	recently. The check reads the revisions so they can be cached
+ */
+int doBoardInit(int stack)
+{
+	RtdTopoType topo;
+	int bus = i2cBusGet();
+	int dev = 0;
+	int add = 0;
+	int idx = 0;
+	uint8_t buff[4];
+
+	if ( (stack < 0) || (stack > 7))
+	{
+		printf("Invalid stack level [0..7]!");
+		return ERROR;
+	}
+	add = stack + SLAVE_OWN_ADDRESS_BASE;
+	dev = i2cSetup(add);
+	if (dev < 0)
+	{
+		return ERROR;
+	}
+	idx = bus * 8 + stack;
+	if (gProbeCache && (idx < I2C_BUS_MAX * 8) && gProbed[idx])
+	{
+		return dev;
+	}
+	switch (topoGet(bus, stack, &topo))
+	{
+	case TOPO_PRESENT:
+		break;
+	case TOPO_ABSENT:
+		printf("MEGA-RTD id %d not detected\n", stack);
+		return ERROR;
+	default:
+		if (ERROR == i2cMem8Read(dev, REVISION_HW_MAJOR_MEM_ADD, buff, 4))
+		{
+			topoAbsent(bus, stack);
+			printf("MEGA-RTD id %d not detected\n", stack);
+			return ERROR;
+		}
+		boardTopoRecord(bus, stack, buff);
+		break;
+	}
+	if (idx < I2C_BUS_MAX * 8)
+	{
+		gProbed[idx] = 1;
+	}
+	return dev;
+}
+
+/*
+ * boardHwTypeGet:
+ *	Card type of an initialized card, from the topology cache if known
+ */
+int boardHwTypeGet(int stack, int dev, int *hw)
+{
+	RtdTopoType topo;
+	int bus = i2cBusGet();
+
+	if ( (TOPO_PRESENT == topoGet(bus, stack, &topo)) && (topo.hwType != TOPO_UNSET))
+	{
+		*hw = topo.hwType;
+		return OK;
+	}
+	if (OK != rtdHwTypeGet(dev, hw))
+	{
+		return ERROR;
+	}
+	if (TOPO_PRESENT == topoGet(bus, stack, &topo))
+	{
+		topo.hwType = *hw;
+		topoPut(bus, stack, &topo);
+	}
+	return OK;
+}
+
+/*
+ * boardSensorTypeGet:
+ *	PT100 (0) or PT1000 (1), from the topology cache if known
+ */
+int boardSensorTypeGet(int stack, int dev, int *val)
+{
+	RtdTopoType topo;
+	int bus = i2cBusGet();
+
+	if ( (TOPO_PRESENT == topoGet(bus, stack, &topo))
+		&& (topo.sensorType != TOPO_UNSET))
+	{
+		*val = topo.sensorType;
+		return OK;
+	}
+	if (OK != sensorRead(dev, val))
+	{
+		return ERROR;
+	}
+	boardSensorTypeSet(bus, stack, *val);
+	return OK;
+}
+
+/*
+ * boardSensorTypeSet:
+ *	Keep the topology cache in line after the sensor type was written
+ */
+void boardSensorTypeSet(int bus, int stack, int val)
+{
+	RtdTopoType topo;
+
+	if (TOPO_PRESENT == topoGet(bus, stack, &topo))
+	{
+		topo.sensorType = val;
+		topoPut(bus, stack, &topo);
+	}
+}
+
+/*
+ * boardCheck:
+ *	Presence of the card at the given address, answered by the topology
+ *	cache when it knows the card. A probe records its result there
+ */
+int boardCheck(u8 add)
+{
+	RtdTopoType topo;
+	int stack = add - SLAVE_OWN_ADDRESS_BASE;
+	int bus = i2cBusGet();
+	int dev;
+	u8 buff[4];
+
+	switch (topoGet(bus, stack, &topo))
+	{
+	case TOPO_PRESENT:
+		return OK;
+	case TOPO_ABSENT:
+		return ERROR;
+	default:
+		break;
+	}
+	dev = i2cSetup(add);
+	if (dev < 0)
+	{
+		return ERROR;
+	}
+	if (OK != i2cMem8Probe(dev, REVISION_HW_MAJOR_MEM_ADD, buff, 4))
+	{
+		topoAbsent(bus, stack);
+		return ERROR;
+	}
+	boardTopoRecord(bus, stack, buff);
+	return OK;
+}
+
+typedef struct
+{
+	int bus;
+	int cnt;
+	const u8 *known; // bus * 8 + stack, NULL if none
+	RtdBoardInfoType info[8];
+} DiscoverBusType;
+
+static void* discoverBus(void *arg)
+{
+	DiscoverBusType *pBus = (DiscoverBusType*)arg;
+	RtdBoardInfoType *pInfo = NULL;
+	int stack = 0;
+	int known = 0;
+	int dev = 0;
+	int ret = 0;
+	u8 buff[4];
+
+	i2cQuietSet(1);
+	for (stack = 0; stack < 8; stack++)
+	{
+		dev = i2cSetupBus(pBus->bus, SLAVE_OWN_ADDRESS_BASE + stack);
+		if (dev == COMM_SETUP_BUS)
+		{
+			break; // bus not usable
+		}
+		if (dev < 0)
+		{
+			continue; // address owned by a kernel driver
+		}
+		known = (NULL != pBus->known) && (pBus->bus < I2C_BUS_MAX)
+			&& pBus->known[pBus->bus * 8 + stack];
+		if (known)
+		{
+			// the handle is in use by the caller, retried and never closed
+			ret = i2cMem8Read(dev, REVISION_HW_MAJOR_MEM_ADD, buff, 4);
+		}
+		else
+		{
+			ret = i2cMem8Probe(dev, REVISION_HW_MAJOR_MEM_ADD, buff, 4);
+		}
+		if (FAIL == ret)
+		{
+			if (!known)
+			{
+				i2cClose(dev);
+			}
+			continue;
+		}
+		pInfo = &pBus->info[pBus->cnt++];
+		pInfo->bus = pBus->bus;
+		pInfo->stack = stack;
+		pInfo->hwMajor = buff[0];
+		pInfo->hwMinor = buff[1];
+		pInfo->fwMajor = buff[2];
+		pInfo->fwMinor = buff[3];
+		if (OK != rtdHwTypeGet(dev, &pInfo->hwType))
+		{
+			pInfo->hwType = -1;
+		}
+	}
+	i2cQuietSet(0);
+	return NULL;
+}
+
+/*
+ * rtdDiscover:
+ *	Probe all stack levels on every i2c adapter, one thread per adapter.
+ *	Return the number of cards found, sorted by bus and stack level
+ */
+int rtdDiscover(RtdBoardInfoType *info, int max)
+{
+	return rtdDiscoverKnown(info, max, NULL);
+}
+
+/*
+ * rtdDiscoverKnown:
+ *	rtdDiscover() for a caller that already uses some cards, known[bus * 8
+ *	+ stack] set for them. Those are read with the usual retries and their
+ *	handles stay open when they do not answer
+ */
+int rtdDiscoverKnown(RtdBoardInfoType *info, int max, const u8 *known)
+{
+	int buses[I2C_BUS_MAX];
+	DiscoverBusType scan[I2C_BUS_MAX];
+	pthread_t threads[I2C_BUS_MAX];
+	int started[I2C_BUS_MAX];
+	int busCnt = 0;
+	int cnt = 0;
+	int i = 0;
+	int j = 0;
+
+	if (NULL == info)
+	{
+		return ERROR;
+	}
+	busCnt = i2cBusList(buses, I2C_BUS_MAX);
+	for (i = 0, j = 0; i < busCnt; i++)
+	{
+		if ( (buses[i] >= 0) && (buses[i] < I2C_BUS_MAX))
+		{
+			buses[j++] = buses[i]; // the callers index by bus * 8 + stack
+		}
+	}
+	busCnt = j;
+	for (i = 0; i < busCnt; i++)
+	{
+		scan[i].bus = buses[i];
+		scan[i].cnt = 0;
+		scan[i].known = known;
+		started[i] = (0 == pthread_create(&threads[i], NULL, discoverBus, &scan[i]));
+		if (!started[i])
+		{
+			discoverBus(&scan[i]);
+		}
+	}
+	for (i = 0; i < busCnt; i++)
+	{
+		if (started[i])
+		{
+			pthread_join(threads[i], NULL);
+		}
+		for (j = 0; (j < scan[i].cnt) && (cnt < max); j++)
+		{
+			info[cnt++] = scan[i].info[j];
+		}
+	}
+	return cnt;
+}
+
+typedef struct
+{
+	RtdFleetType *board;
+	int cnt;
+	int res;
+} FleetBusType;
+
+static void* fleetReadBus(void *arg)
+{
+	FleetBusType *pBus = (FleetBusType*)arg;
+	RtdFleetType *b = NULL;
+	struct timespec ts;
+	int dev = 0;
+	int i = 0;
+
+	for (i = 0; i < pBus->cnt; i++)
+	{
+		b = &pBus->board[i];
+		dev = i2cSetupBus(b->info.bus, SLAVE_OWN_ADDRESS_BASE + b->info.stack);
+		b->status = FAIL;
+		if (dev >= 0)
+		{
+			b->status = pBus->res ? rtdChGetRAll(dev, b->val) : rtdChGetAll(dev, b->val);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		b->tsNs = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+	}
+	return NULL;
+}
+
+/*
+ * rtdFleetRead:
+ *	Discover the cards and read all the channels of every card, one block
+ *	read per card, the buses in parallel. Return the number of cards, in
+ *	the rtdDiscover() order
+ */
+int rtdFleetRead(int res, RtdFleetType *fleet, int max)
+{
+	RtdBoardInfoType info[RTD_DISCOVER_MAX];
+	FleetBusType bus[I2C_BUS_MAX];
+	pthread_t threads[I2C_BUS_MAX];
+	int started[I2C_BUS_MAX];
+	int busCnt = 0;
+	int cnt = 0;
+	int i = 0;
+
+	if (NULL == fleet)
+	{
+		return ERROR;
+	}
+	cnt = rtdDiscover(info, max < RTD_DISCOVER_MAX ? max : RTD_DISCOVER_MAX);
+	for (i = 0; i < cnt; i++)
+	{
+		memset(&fleet[i], 0, sizeof(RtdFleetType));
+		fleet[i].info = info[i];
+		if ( (i == 0) || (info[i].bus != info[i - 1].bus))
+		{
+			bus[busCnt].board = &fleet[i];
+			bus[busCnt].cnt = 0;
+			bus[busCnt].res = res;
+			busCnt++;
+		}
+		bus[busCnt - 1].cnt++;
+	}
+	for (i = 0; i < busCnt; i++)
+	{
+		started[i] = (0 == pthread_create(&threads[i], NULL, fleetReadBus, &bus[i]));
+		if (!started[i])
+		{
+			fleetReadBus(&bus[i]);
+		}
+	}
+	for (i = 0; i < busCnt; i++)
+	{
+		if (started[i])
+		{
+			pthread_join(threads[i], NULL);
+		}
+	}
+	return cnt;
+}
+
+int rtdHwTypeGet(int dev, int* hw)
+{
+	u8 buff;
+	if (FAIL == i2cMem8Read(dev, RTD_CARD_TYPE, &buff, 1))
+	{
+		return ERROR;
+	}
+	*hw = buff;
+	return OK;
+}
+
+/*
+ * boardOfDev:
+ *	Bus and stack of a card handle, for the calibration store lookup
+ */
+static int boardOfDev(int dev, int *bus, int *stack)
+{
+	int addr = 0;
+
+	if (0 != i2cDevAddr(dev, bus, &addr))
+	{
+		return ERROR;
+	}
+	*stack = addr - SLAVE_OWN_ADDRESS_BASE;
+	return OK;
+}
+
+static int rtdBlockRead(int dev, int add, float *val)
+{
+	u8 buff[sizeof(float) * RTD_CH_NR_MAX];
+
+	if (FAIL == i2cMem8Read(dev, add, buff, sizeof(buff)))
+	{
+		return ERROR;
+	}
+	memcpy(val, buff, sizeof(buff));
+	return OK;
+}
+
+/*
+ * rtdChGet / rtdChGetR and the block versions below return the readings
+ * corrected with the host calibration profiles (calib.h). A corrected
+ * temperature needs the raw resistance, read only for the cards that have
+ * a profile
+ */
+int rtdChGet(int dev, u8 channel, float *temperature)
+{
+	u8 buff[sizeof(float)];
+	RtdCalibType c;
+	float res = 0;
+	int bus = 0;
+	int stack = 0;
+
+	if (NULL == temperature)
+	{
+		return ERROR;
+	}
+
+	if ( (channel < CHANNEL_NR_MIN) || (channel > RTD_CH_NR_MAX))
+	{
+		printf("Invalid rtd channel nr!\n");
+		return ERROR;
+	}
+
+	if (FAIL
+		== i2cMem8Read(dev, RTD_VAL1_ADD + sizeof(float) * (channel - 1), buff,
+			sizeof(float)))
+	{
+		return ERROR;
+	}
+
+	memcpy(temperature, buff, sizeof(float));
+	if ( (OK == boardOfDev(dev, &bus, &stack))
+		&& (OK == rtdCalibGet(bus, stack, channel, &c)))
+	{
+		if (FAIL
+			== i2cMem8Read(dev, RTD_RES1_ADD + sizeof(float) * (channel - 1), buff,
+				sizeof(float)))
+		{
+			return ERROR;
+		}
+		memcpy(&res, buff, sizeof(float));
+		*temperature = rtdCalibTemp(&c, *temperature, res);
+	}
+	return OK;
+}
+
+int rtdChGetR(int dev, u8 channel, float *resistance)
+{
+	u8 buff[sizeof(float)];
+	RtdCalibType c;
+	int bus = 0;
+	int stack = 0;
+
+	if (NULL == resistance)
+	{
+		return ERROR;
+	}
+
+	if ( (channel < CHANNEL_NR_MIN) || (channel > RTD_CH_NR_MAX))
+	{
+		printf("Invalid rtd channel nr!\n");
+		return ERROR;
+	}
+
+	if (FAIL
+		== i2cMem8Read(dev, RTD_RES1_ADD + sizeof(float) * (channel - 1), buff,
+			sizeof(float)))
+	{
+		return ERROR;
+	}
+
+	memcpy(resistance, buff, sizeof(float));
+	if ( (OK == boardOfDev(dev, &bus, &stack))
+		&& (OK == rtdCalibGet(bus, stack, channel, &c)))
+	{
+		*resistance = rtdCalibRes(&c, *resistance);
+	}
+	return OK;
+}
+
+/*
+ * rtdChGetAll / rtdChGetRAll:
+ *	Read all channels values in a single block transfer, the values are
+ *	contiguous in the card memory so one bus transaction is enough
+ ******************************************************************************************
+ */
+int rtdChGetAll(int dev, float *temperature)
+{
+	float res[RTD_CH_NR_MAX];
+	int bus = 0;
+	int stack = 0;
+
+	if (NULL == temperature)
+	{
+		return ERROR;
+	}
+	if (OK != rtdBlockRead(dev, RTD_VAL1_ADD, temperature))
+	{
+		return ERROR;
+	}
+	if ( (OK == boardOfDev(dev, &bus, &stack))
+		&& (0 != rtdCalibBoard(bus, stack, NULL, NULL)))
+	{
+		if (OK != rtdBlockRead(dev, RTD_RES1_ADD, res))
+		{
+			return ERROR;
+		}
+		rtdCalibBoard(bus, stack, temperature, res);
+	}
+	return OK;
+}
+
+int rtdChGetRAll(int dev, float *resistance)
+{
+	int bus = 0;
+	int stack = 0;
+
+	if (NULL == resistance)
+	{
+		return ERROR;
+	}
+	if (OK != rtdBlockRead(dev, RTD_RES1_ADD, resistance))
+	{
+		return ERROR;
+	}
+	if (OK == boardOfDev(dev, &bus, &stack))
+	{
+		rtdCalibBoard(bus, stack, NULL, resistance);
+	}
+	return OK;
+}
+
+/*
+ * rtdChGetBoth:
+ *	Temperatures and resistances of all the channels, two block transfers
+ *	whatever the calibration
+ */
+int rtdChGetBoth(int dev, float *temperature, float *resistance)
+{
+	int bus = 0;
+	int stack = 0;
+
+	if ( (NULL == temperature) || (NULL == resistance))
+	{
+		return ERROR;
+	}
+	if ( (OK != rtdBlockRead(dev, RTD_VAL1_ADD, temperature))
+		|| (OK != rtdBlockRead(dev, RTD_RES1_ADD, resistance)))
+	{
+		return ERROR;
+	}
+	if (OK == boardOfDev(dev, &bus, &stack))
+	{
+		rtdCalibBoard(bus, stack, temperature, resistance);
+	}
+	return OK;
+}
+
+int sensorRead(int dev, int* val)
+{
+	u8 buff;
+
+	if (NULL == val)
+	{
+		return ERROR;
+	}
+
+	if (FAIL == i2cMem8Read(dev, I2C_MEM_PT1000, &buff, 1))
+	{
+		return ERROR;
+	}
+
+	*val = 0x0f & buff;
+	return OK;
+}
@@ -0,0 +1,261 @@
+/*
+ * buslock.c:
+ *	Fair (FIFO) arbitration of an i2c bus between processes, see buslock.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#define _GNU_SOURCE // secure_getenv
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "comm.h"
+#include "buslock.h"
+
+#define BUS_LOCK_POLL_NS	1000000 // re-check for a stuck holder every 1ms
+
+static BusLockShmType *gBusLock[I2C_BUS_MAX];
+static int gBusLockEnable = -1;
+static pthread_mutex_t gBusLockMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t busLockNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void busLockEnable(int enable)
+{
+	gBusLockEnable = enable ? 1 : 0;
+}
+
+/*
+ * busLockEnabled:
+ *	Arbitration is opt-in, busLockEnable() or RTD_BUS_LOCK=1
+ */
+int busLockEnabled(void)
+{
+	char *env = NULL;
+
+	if (gBusLockEnable < 0)
+	{
+		env = secure_getenv("RTD_BUS_LOCK");
+		gBusLockEnable = ( (NULL != env) && (atoi(env) != 0)) ? 1 : 0;
+	}
+	return gBusLockEnable;
+}
+
+/*
+ * busLockOpen:
+ *	Open the lock object of a bus, creating it for the users of the bus
+ */
+static int busLockOpen(int bus)
+{
+	struct stat st;
+	char name[32];
+	int fd = 0;
+
+	sprintf(name, "/rtd-i2c-%d", bus);
+	fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (fd >= 0)
+	{
+		sprintf(name, "/dev/i2c-%d", bus);
+		if ( (0 == stat(name, &st)) && (0 == fchown(fd, -1, st.st_gid)))
+		{
+			fchmod(fd, 0660); // shared by the group of the adapter, ignore the umask
+		}
+		if (0 != ftruncate(fd, sizeof(BusLockShmType)))
+		{
+			close(fd);
+			return -1;
+		}
+		return fd;
+	}
+	fd = shm_open(name, O_RDWR | O_NOFOLLOW, 0);
+	if (fd < 0)
+	{
+		return -1;
+	}
+	if ( (0 != fstat(fd, &st)) || ( (st.st_uid != 0) && (st.st_uid != geteuid()))
+		|| (st.st_size < (off_t)sizeof(BusLockShmType)))
+	{
+		close(fd); // not ours to trust, or still being created
+		return -1;
+	}
+	return fd;
+}
+
+static BusLockShmType* busLockMap(int bus)
+{
+	BusLockShmType *pLock = NULL;
+	int fd = 0;
+
+	if ( (bus < 0) || (bus >= I2C_BUS_MAX))
+	{
+		return NULL;
+	}
+	pthread_mutex_lock(&gBusLockMutex);
+	if (NULL != gBusLock[bus])
+	{
+		pthread_mutex_unlock(&gBusLockMutex);
+		return gBusLock[bus];
+	}
+	fd = busLockOpen(bus);
+	if (fd >= 0)
+	{
+		pLock = mmap(NULL, sizeof(BusLockShmType), PROT_READ | PROT_WRITE,
+		MAP_SHARED, fd, 0);
+		if (MAP_FAILED == pLock)
+		{
+			pLock = NULL;
+		}
+		close(fd);
+	}
+	if (NULL != pLock)
+	{
+		// a new object is all zero, first user fills the header
+		if (__atomic_load_n(&pLock->magic, __ATOMIC_ACQUIRE) != BUS_LOCK_MAGIC)
+		{
+			pLock->version = BUS_LOCK_VERSION;
+			pLock->holdMaxNs = BUS_LOCK_HOLD_MAX_NS;
+			__atomic_store_n(&pLock->magic, BUS_LOCK_MAGIC, __ATOMIC_RELEASE);
+		}
+		gBusLock[bus] = pLock;
+	}
+	pthread_mutex_unlock(&gBusLockMutex);
+	return pLock;
+}
+
+static void busLockMax(uint64_t *max, uint64_t val)
+{
+	uint64_t old = __atomic_load_n(max, __ATOMIC_RELAXED);
+
+	while ( (val > old)
+		&& !__atomic_compare_exchange_n(max, &old, val, 0, __ATOMIC_RELAXED,
+			__ATOMIC_RELAXED))
+	{
+	}
+}
+
+static void busLockWake(BusLockShmType *pLock)
+{
+	syscall(SYS_futex, &pLock->serving, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+/*
+ * busLockAcquire:
+ *	Wait for our turn on the bus. Return 0 with the ticket and the grant
+ *	stamp to release, or -1 if the lock is not available (the caller goes
+ *	ahead unarbitrated)
+ */
+int busLockAcquire(int bus, uint32_t *ticket, uint64_t *grant)
+{
+	BusLockShmType *pLock = busLockMap(bus);
+	struct timespec to;
+	uint32_t serving = 0;
+	uint64_t start = 0;
+	uint64_t now = 0;
+	uint64_t stamp = 0;
+
+	if (NULL == pLock)
+	{
+		return -1;
+	}
+	start = busLockNow();
+	*ticket = __atomic_fetch_add(&pLock->next, 1, __ATOMIC_ACQ_REL);
+	while (1)
+	{
+		serving = __atomic_load_n(&pLock->serving, __ATOMIC_ACQUIRE);
+		if (serving == *ticket)
+		{
+			break;
+		}
+		now = busLockNow();
+		stamp = __atomic_load_n(&pLock->stampNs, __ATOMIC_ACQUIRE);
+		if (serving != __atomic_load_n(&pLock->serving, __ATOMIC_ACQUIRE))
+		{
+			continue;
+		}
+		if ( (now > stamp) && (now - stamp > pLock->holdMaxNs))
+		{
+			// the holder (or a waiter that left) blocks the queue, skip it;
+			// the stamp always changes before "serving" so nobody else sees
+			// the new ticket with the old stamp and skips it again
+			__atomic_store_n(&pLock->stampNs, now, __ATOMIC_RELEASE);
+			if (__atomic_compare_exchange_n(&pLock->serving, &serving,
+				serving + 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			{
+				__atomic_fetch_add(&pLock->forced, 1, __ATOMIC_RELAXED);
+				busLockWake(pLock);
+			}
+			continue;
+		}
+		to.tv_sec = 0;
+		to.tv_nsec = BUS_LOCK_POLL_NS;
+		syscall(SYS_futex, &pLock->serving, FUTEX_WAIT, serving, &to, NULL, 0);
+	}
+	now = busLockNow();
+	__atomic_store_n(&pLock->stampNs, now, __ATOMIC_RELEASE);
+	*grant = now;
+	__atomic_fetch_add(&pLock->grants, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&pLock->waitNsTotal, now - start, __ATOMIC_RELAXED);
+	busLockMax(&pLock->waitNsMax, now - start);
+	return 0;
+}
+
+void busLockRelease(int bus, uint32_t ticket, uint64_t grant)
+{
+	BusLockShmType *pLock = busLockMap(bus);
+	uint32_t expected = ticket;
+	uint64_t stamp = grant;
+	uint64_t now = busLockNow();
+
+	if (NULL == pLock)
+	{
+		return;
+	}
+	__atomic_fetch_add(&pLock->holdNsTotal, now - grant, __ATOMIC_RELAXED);
+	busLockMax(&pLock->holdNsMax, now - grant);
+	// if we were skipped for holding too long the queue already moved on and
+	// the stamp belongs to the next holder, both are left alone
+	if (__atomic_compare_exchange_n(&pLock->stampNs, &stamp, now, 0,
+		__ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+		&& __atomic_compare_exchange_n(&pLock->serving, &expected, ticket + 1, 0,
+			__ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+	{
+		busLockWake(pLock);
+	}
+}
+
+int busLockStatsGet(int bus, BusLockStatsType *stats)
+{
+	BusLockShmType *pLock = busLockMap(bus);
+
+	if ( (NULL == pLock) || (NULL == stats))
+	{
+		return -1;
+	}
+	stats->grants = __atomic_load_n(&pLock->grants, __ATOMIC_RELAXED);
+	stats->waitNsTotal = __atomic_load_n(&pLock->waitNsTotal, __ATOMIC_RELAXED);
+	stats->waitNsMax = __atomic_load_n(&pLock->waitNsMax, __ATOMIC_RELAXED);
+	stats->holdNsTotal = __atomic_load_n(&pLock->holdNsTotal, __ATOMIC_RELAXED);
+	stats->holdNsMax = __atomic_load_n(&pLock->holdNsMax, __ATOMIC_RELAXED);
+	stats->forced = __atomic_load_n(&pLock->forced, __ATOMIC_RELAXED);
+	return 0;
+}
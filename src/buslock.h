@@ -0,0 +1,59 @@
+#ifndef BUSLOCK_H_
+#define BUSLOCK_H_
+
+#include <stdint.h>
+
+/*
+ * Cross process i2c bus arbitration, a ticket lock in the POSIX shared
+ * memory object "/rtd-i2c-<bus>" so every program driving the bus gets it
+ * in request order. Any client can take part by mapping the object and
+ * following the same protocol: atomically increment "next" to take a
+ * ticket, wait until "serving" equals the ticket (futex wait on "serving"),
+ * do the transfer, then compare-and-swap "stampNs" from the value set at
+ * the grant to the current time and "serving" to ticket + 1, and futex
+ * wake all waiters. A holder that keeps the bus longer than holdMaxNs (or
+ * dies) is skipped by the waiters, its stamp is no longer the one of the
+ * grant and it leaves both alone.
+ *
+ * The object is created mode 0660 with the group of /dev/i2c-<bus>, the
+ * users allowed on the bus, and only used if it belongs to root or to the
+ * process. Only rtd takes the lock for now, the python library and the
+ * Node-RED node go to the bus directly.
+ */
+#define BUS_LOCK_MAGIC	0x4b4c4452 // "RDLK"
+#define BUS_LOCK_VERSION	1
+#define BUS_LOCK_HOLD_MAX_NS	100000000ull // 100ms
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t next; // next ticket to hand out
+	uint32_t serving; // ticket allowed on the bus
+	uint64_t stampNs; // CLOCK_MONOTONIC time "serving" last changed
+	uint64_t holdMaxNs;
+	uint64_t grants;
+	uint64_t waitNsTotal;
+	uint64_t waitNsMax;
+	uint64_t holdNsTotal;
+	uint64_t holdNsMax;
+	uint64_t forced; // holders skipped for exceeding holdMaxNs
+} BusLockShmType;
+
+typedef struct
+{
+	uint64_t grants;
+	uint64_t waitNsTotal;
+	uint64_t waitNsMax;
+	uint64_t holdNsTotal;
+	uint64_t holdNsMax;
+	uint64_t forced;
+} BusLockStatsType;
+
+void busLockEnable(int enable);
+int busLockEnabled(void);
+int busLockAcquire(int bus, uint32_t *ticket, uint64_t *grant);
+void busLockRelease(int bus, uint32_t ticket, uint64_t grant);
+int busLockStatsGet(int bus, BusLockStatsType *stats);
+
+#endif //BUSLOCK_H_
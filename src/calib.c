@@ -0,0 +1,344 @@
+/*
+ * calib.c:
+ *	Host side calibration profiles, see calib.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#define _GNU_SOURCE // secure_getenv
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <math.h>
+#include <pthread.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "rtd.h"
+#include "rtdconv.h"
+#include "calib.h"
+
+#define CALIB_RETRY_NS	1000000000ull // look for a missing file once a second
+
+static const RtdCalibFileType *gCalib = NULL;
+static uint64_t gCalibTryNs = 0;
+static int gCalibTried = 0;
+static pthread_mutex_t gCalibMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t calibNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static const char* calibPath(void)
+{
+	const char *path = secure_getenv("RTD_CALIB");
+
+	return ( (NULL == path) || (*path == 0)) ? RTD_CALIB_PATH : path;
+}
+
+static int calibIndex(int bus, int stack, int ch)
+{
+	int idx = (bus * 8 + stack) * RTD_CH_NR_MAX + ch - 1;
+
+	if ( (bus < 0) || (stack < 0) || (stack > 7) || (ch < CHANNEL_NR_MIN)
+		|| (ch > RTD_CH_NR_MAX) || (idx >= RTD_CALIB_ENTRIES))
+	{
+		return -1;
+	}
+	return idx;
+}
+
+static int calibValid(const RtdCalibFileType *f)
+{
+	return (__atomic_load_n(&f->magic, __ATOMIC_ACQUIRE) == RTD_CALIB_MAGIC)
+		&& (f->version == RTD_CALIB_VERSION) && (f->entrySize == sizeof(RtdCalibType))
+		&& (f->entries == RTD_CALIB_ENTRIES);
+}
+
+/*
+ * calibMap:
+ *	Map the store read only once per process. A missing or foreign file
+ *	means no profile, looked for again after CALIB_RETRY_NS so a running
+ *	daemon sees a store created later
+ */
+static const RtdCalibFileType* calibMap(void)
+{
+	const RtdCalibFileType *f = __atomic_load_n(&gCalib, __ATOMIC_ACQUIRE);
+	struct stat st;
+	uint64_t now = 0;
+	int fd = 0;
+
+	if (NULL != f)
+	{
+		return f;
+	}
+	pthread_mutex_lock(&gCalibMutex);
+	now = calibNow();
+	if ( (NULL != gCalib) || (gCalibTried && (now - gCalibTryNs < CALIB_RETRY_NS)))
+	{
+		pthread_mutex_unlock(&gCalibMutex);
+		return gCalib;
+	}
+	gCalibTried = 1;
+	gCalibTryNs = now;
+	fd = open(calibPath(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+	if ( (fd >= 0) && (0 == fstat(fd, &st)) && S_ISREG(st.st_mode)
+		&& (st.st_size >= (off_t)sizeof(RtdCalibFileType)))
+	{
+		f = mmap(NULL, sizeof(RtdCalibFileType), PROT_READ, MAP_SHARED, fd, 0);
+		if (MAP_FAILED == f)
+		{
+			f = NULL;
+		}
+		else if (!calibValid(f))
+		{
+			munmap((void*)f, sizeof(RtdCalibFileType));
+			f = NULL;
+		}
+	}
+	if (fd >= 0)
+	{
+		close(fd);
+	}
+	__atomic_store_n(&gCalib, f, __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&gCalibMutex);
+	return f;
+}
+
+static int calibCopy(const RtdCalibType *src, RtdCalibType *c)
+{
+	uint32_t seq1 = 0;
+	uint32_t seq2 = 0;
+	int tries = 0;
+
+	do
+	{
+		if (tries++ >= RTD_CALIB_READ_TRIES)
+		{
+			return ERROR;
+		}
+		seq1 = __atomic_load_n(&src->seqlock, __ATOMIC_ACQUIRE);
+		if (seq1 & 1)
+		{
+			continue; // writer in progress
+		}
+		memcpy(c, src, sizeof(RtdCalibType));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		seq2 = __atomic_load_n(&src->seqlock, __ATOMIC_RELAXED);
+	} while ( (seq1 & 1) || (seq1 != seq2));
+	return OK;
+}
+
+/*
+ * rtdCalibGet:
+ *	Profile of a channel, ERROR if none is active
+ */
+int rtdCalibGet(int bus, int stack, int ch, RtdCalibType *c)
+{
+	const RtdCalibFileType *f = calibMap();
+	int idx = calibIndex(bus, stack, ch);
+
+	if ( (NULL == f) || (idx < 0) || (NULL == c))
+	{
+		return ERROR;
+	}
+	if (!(__atomic_load_n(&f->entry[idx].flags, __ATOMIC_RELAXED) & RTD_CALIB_ACTIVE))
+	{
+		return ERROR;
+	}
+	if (OK != calibCopy(&f->entry[idx], c))
+	{
+		return ERROR;
+	}
+	return (c->flags & RTD_CALIB_ACTIVE) ? OK : ERROR;
+}
+
+/*
+ * calibWrite:
+ *	Replace one entry, creating the store if needed. The file keeps its
+ *	size and place so every mapping stays valid. Only an empty file is
+ *	initialized, anything else that is not a store is left untouched
+ */
+static int calibWrite(int idx, const RtdCalibType *c)
+{
+	RtdCalibFileType *f = NULL;
+	RtdCalibType *pE = NULL;
+	struct stat st;
+	uint32_t seq = 0;
+	mode_t mask = 0;
+	int fd = 0;
+
+	mask = umask(0);
+	fd = open(calibPath(), O_RDWR | O_CREAT | O_NOFOLLOW | O_CLOEXEC, 0644);
+	umask(mask);
+	if (fd < 0)
+	{
+		return ERROR;
+	}
+	if ( (0 != flock(fd, LOCK_EX)) || (0 != fstat(fd, &st)) || !S_ISREG(st.st_mode)
+		|| ( (st.st_uid != 0) && (st.st_uid != geteuid())))
+	{
+		close(fd);
+		return ERROR;
+	}
+	if (st.st_size == 0)
+	{
+		if (0 != ftruncate(fd, sizeof(RtdCalibFileType)))
+		{
+			close(fd);
+			return ERROR;
+		}
+	}
+	else if (st.st_size < (off_t)sizeof(RtdCalibFileType))
+	{
+		close(fd);
+		return ERROR;
+	}
+	f = mmap(NULL, sizeof(RtdCalibFileType), PROT_READ | PROT_WRITE, MAP_SHARED,
+		fd, 0);
+	if (MAP_FAILED == f)
+	{
+		close(fd);
+		return ERROR;
+	}
+	if ( (st.st_size != 0) && !calibValid(f))
+	{
+		munmap(f, sizeof(RtdCalibFileType));
+		close(fd);
+		return ERROR;
+	}
+	if (st.st_size == 0)
+	{
+		memset(f, 0, sizeof(RtdCalibFileType));
+		f->version = RTD_CALIB_VERSION;
+		f->entrySize = sizeof(RtdCalibType);
+		f->entries = RTD_CALIB_ENTRIES;
+		__atomic_store_n(&f->magic, RTD_CALIB_MAGIC, __ATOMIC_RELEASE);
+	}
+	pE = &f->entry[idx];
+	seq = (pE->seqlock + 1) & ~1u; // even again after a writer that died
+	__atomic_store_n(&pE->seqlock, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memcpy((u8*)pE + sizeof(uint32_t), (const u8*)c + sizeof(uint32_t),
+		sizeof(RtdCalibType) - sizeof(uint32_t));
+	__atomic_store_n(&pE->seqlock, seq + 2, __ATOMIC_RELEASE);
+	msync(f, sizeof(RtdCalibFileType), MS_SYNC);
+	munmap(f, sizeof(RtdCalibFileType));
+	close(fd); // releases the lock
+	pthread_mutex_lock(&gCalibMutex);
+	gCalibTried = 0; // a store just created is mapped at the next read
+	pthread_mutex_unlock(&gCalibMutex);
+	return OK;
+}
+
+int rtdCalibSet(int bus, int stack, int ch, const RtdCalibType *c)
+{
+	RtdCalibType e;
+	int idx = calibIndex(bus, stack, ch);
+
+	if ( (idx < 0) || (NULL == c) || !isfinite(c->lead) || !isfinite(c->offset)
+		|| !isfinite(c->gain) || !isfinite(c->quad) || (c->gain <= 0))
+	{
+		return ERROR;
+	}
+	e = *c;
+	e.flags |= RTD_CALIB_ACTIVE;
+	e.setTime = (uint64_t)time(NULL);
+	return calibWrite(idx, &e);
+}
+
+int rtdCalibClear(int bus, int stack, int ch)
+{
+	RtdCalibType e;
+	int idx = calibIndex(bus, stack, ch);
+
+	if (idx < 0)
+	{
+		return ERROR;
+	}
+	memset(&e, 0, sizeof(e));
+	e.setTime = (uint64_t)time(NULL);
+	return calibWrite(idx, &e);
+}
+
+float rtdCalibRes(const RtdCalibType *c, float res)
+{
+	float r = res - c->lead;
+
+	return c->offset + r * (c->gain + r * c->quad);
+}
+
+/*
+ * rtdCalibTemp:
+ *	Card temperature corrected as the resistance. R0 is recovered from the
+ *	card reading (R / W(temp)), so the same code serves PT100 and PT1000,
+ *	and the difference of the two conversions cancels any offset between
+ *	the card and the host Callendar-Van Dusen tables
+ */
+float rtdCalibTemp(const RtdCalibType *c, float temp, float res)
+{
+	double w = rtdCvdRes(temp, 1);
+	float r0 = 0;
+
+	if (!(w > 0))
+	{
+		return temp;
+	}
+	r0 = res / w;
+	return temp + rtdCvd(rtdCalibRes(c, res), r0, RTD_CVD_CUBIC)
+		- rtdCvd(res, r0, RTD_CVD_CUBIC);
+}
+
+/*
+ * rtdCalibBoard:
+ *	Correct the readings of all the channels of a card, temp (may be NULL)
+ *	needs the raw resistances in res. Return the mask of the channels
+ *	with a profile, 0 without any memory access beyond the flags when the
+ *	card has none
+ */
+int rtdCalibBoard(int bus, int stack, float *temp, float *res)
+{
+	const RtdCalibFileType *f = calibMap();
+	RtdCalibType c;
+	int idx = calibIndex(bus, stack, CHANNEL_NR_MIN);
+	int mask = 0;
+	int i = 0;
+
+	if ( (NULL == f) || (idx < 0))
+	{
+		return 0;
+	}
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		if (!(__atomic_load_n(&f->entry[idx + i].flags, __ATOMIC_RELAXED)
+			& RTD_CALIB_ACTIVE))
+		{
+			continue;
+		}
+		if ( (OK != calibCopy(&f->entry[idx + i], &c))
+			|| !(c.flags & RTD_CALIB_ACTIVE))
+		{
+			continue;
+		}
+		mask |= 1 << i;
+		if (NULL != temp)
+		{
+			temp[i] = rtdCalibTemp(&c, temp[i], res[i]);
+		}
+		if (NULL != res)
+		{
+			res[i] = rtdCalibRes(&c, res[i]);
+		}
+	}
+	return mask;
+}
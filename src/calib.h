@@ -0,0 +1,75 @@
+#ifndef CALIB_H_
+#define CALIB_H_
+
+#include <stdint.h>
+
+#include "rtd.h"
+
+/*
+ * Host side calibration profiles, one per channel of every card, on top of
+ * the card's own two point calibration (cal / calrst). A profile corrects
+ * the measured resistance R:
+ *
+ *	r = R - lead
+ *	R' = offset + gain * r + quad * r^2
+ *
+ * and the card temperature by the same amount converted through the
+ * platinum sensitivity at that temperature (see rtdCalibTemp). Nickel and
+ * copper sensors should be read with their curve (readcurve), which
+ * converts the corrected resistance.
+ *
+ * The profiles live in the file /var/lib/rtd-calib (RTD_CALIB environment
+ * variable), mmap()ed by every process, so the read path costs one lookup
+ * in memory. Fixed little-endian layout, no implicit padding:
+ *
+ *	RtdCalibFileType header          16 bytes
+ *	RtdCalibType entry[2048]         48 bytes each,
+ *	                                 index = (bus * 8 + stack) * 8 + channel - 1
+ *
+ * Every entry is protected by a seqlock as the rtdd snapshot (rtdshm.h),
+ * the writers are serialized with flock(). A writer that crashed leaves the
+ * sequence odd in the file: readers give up after RTD_CALIB_READ_TRIES and
+ * see no profile, the next writer starts again from an even sequence.
+ * RTD_CALIB is ignored by the setuid rtd, and a file that is not a valid
+ * store is never overwritten.
+ */
+#define RTD_CALIB_PATH	"/var/lib/rtd-calib"
+#define RTD_CALIB_MAGIC	0x43445452 // "RTDC"
+#define RTD_CALIB_VERSION	1
+#define RTD_CALIB_ENTRIES	(I2C_BUS_MAX * 8 * RTD_CH_NR_MAX)
+#define RTD_CALIB_PROBE_MAX	16
+#define RTD_CALIB_READ_TRIES	10000
+
+#define RTD_CALIB_ACTIVE	0x01
+
+typedef struct
+{
+	uint32_t seqlock;
+	uint32_t flags; // RTD_CALIB_*
+	float lead; // ohm, lead wire resistance
+	float offset; // ohm
+	float gain;
+	float quad; // 1/ohm
+	uint64_t setTime; // unix time of the last change
+	char probe[RTD_CALIB_PROBE_MAX]; // probe id, not 0 terminated if full
+} RtdCalibType;
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entrySize; // sizeof(RtdCalibType)
+	uint32_t entries;
+	RtdCalibType entry[RTD_CALIB_ENTRIES];
+} RtdCalibFileType;
+
+_Static_assert(sizeof(RtdCalibType) == 48, "calib layout");
+
+int rtdCalibGet(int bus, int stack, int ch, RtdCalibType *c);
+int rtdCalibSet(int bus, int stack, int ch, const RtdCalibType *c);
+int rtdCalibClear(int bus, int stack, int ch);
+float rtdCalibRes(const RtdCalibType *c, float res);
+float rtdCalibTemp(const RtdCalibType *c, float temp, float res);
+int rtdCalibBoard(int bus, int stack, float *temp, float *res);
+
+#endif //CALIB_H_
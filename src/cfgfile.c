@@ -0,0 +1,145 @@
+/*
+ * cfgfile.c:
+ *	Per channel host configuration files, see cfgfile.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#define _GNU_SOURCE // secure_getenv
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <sys/stat.h>
+
+#include "rtd.h"
+#include "cfgfile.h"
+
+#define CFG_LINE_MAX	256
+
+/*
+ * cfgFilePath:
+ *	Path from the environment variable env, def if it is not set or if the
+ *	process runs setuid
+ */
+const char* cfgFilePath(const char *env, const char *def)
+{
+	const char *path = secure_getenv(env);
+
+	return ( (NULL == path) || (*path == 0)) ? def : path;
+}
+
+/*
+ * cfgFileOpen:
+ *	Open a file for reading, NULL if it is missing or not a regular file
+ */
+FILE* cfgFileOpen(const char *path)
+{
+	struct stat st;
+	FILE *in = NULL;
+	int fd = open(path, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+
+	if (fd < 0)
+	{
+		return NULL;
+	}
+	if ( (0 != fstat(fd, &st)) || !S_ISREG(st.st_mode) || (NULL == (in = fdopen(fd, "r"))))
+	{
+		close(fd);
+		return NULL;
+	}
+	return in;
+}
+
+/*
+ * cfgFileChanged:
+ *	Return 1 and update the stamp if the file changed since it was taken,
+ *	a file removed counts as a change
+ */
+int cfgFileChanged(const char *path, CfgFileStampType *stamp)
+{
+	struct stat st;
+
+	if (0 != stat(path, &st))
+	{
+		st.st_size = -1;
+		memset(&st.st_mtim, 0, sizeof(st.st_mtim));
+	}
+	if (stamp->valid && (st.st_size == stamp->size)
+		&& (st.st_mtim.tv_sec == stamp->mtime.tv_sec)
+		&& (st.st_mtim.tv_nsec == stamp->mtime.tv_nsec))
+	{
+		return 0;
+	}
+	stamp->valid = 1;
+	stamp->size = st.st_size;
+	stamp->mtime = st.st_mtim;
+	return 1;
+}
+
+/*
+ * cfgFileSet:
+ *	Set the value of a channel, NULL removes its line. The other lines are
+ *	kept as they are
+ */
+int cfgFileSet(const char *path, int bus, int stack, int ch, const char *value)
+{
+	char line[CFG_LINE_MAX];
+	char dir[256];
+	char base[256];
+	char tmp[520];
+	struct stat st;
+	FILE *in = NULL;
+	FILE *out = NULL;
+	int fd = 0;
+	int b = 0;
+	int s = 0;
+	int c = 0;
+
+	if ( (strlen(path) >= sizeof(dir))
+		|| ( (0 == lstat(path, &st)) && !S_ISREG(st.st_mode)))
+	{
+		return ERROR;
+	}
+	strcpy(dir, path);
+	strcpy(base, path);
+	snprintf(tmp, sizeof(tmp), "%s/.%s.XXXXXX", dirname(dir), basename(base));
+	fd = mkstemp(tmp);
+	if (fd < 0)
+	{
+		return ERROR;
+	}
+	if ( (0 != fchmod(fd, 0644)) || (NULL == (out = fdopen(fd, "w"))))
+	{
+		close(fd);
+		unlink(tmp);
+		return ERROR;
+	}
+	in = cfgFileOpen(path);
+	while ( (NULL != in) && (NULL != fgets(line, sizeof(line), in)))
+	{
+		if ( (3 == sscanf(line, "%d %d %d", &b, &s, &c)) && (b == bus) && (s == stack)
+			&& (c == ch))
+		{
+			continue; // replaced below
+		}
+		fputs(line, out);
+	}
+	if (NULL != in)
+	{
+		fclose(in);
+	}
+	if (NULL != value)
+	{
+		fprintf(out, "%d %d %d %s\n", bus, stack, ch, value);
+	}
+	if ( (0 != fclose(out)) || (0 != rename(tmp, path)))
+	{
+		unlink(tmp);
+		return ERROR;
+	}
+	return OK;
+}
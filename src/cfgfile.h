@@ -0,0 +1,31 @@
+#ifndef CFGFILE_H_
+#define CFGFILE_H_
+
+#include <time.h>
+#include <sys/types.h>
+
+/*
+ * Host configuration files made of "<bus> <stack> <channel> <value>" lines,
+ * the curve bindings and the filter chains. They are written by the setuid
+ * rtd, so the path of a file only comes from the environment for a normal
+ * process (secure_getenv), a file is only read if it is a regular one and
+ * not through a symbolic link, and it is replaced by a new file created
+ * with mkstemp() next to it and renamed over it. Readers never see a half
+ * written file.
+ *
+ * CfgFileStampType remembers the size and the modification time of a file
+ * read, to parse it again only when it changed.
+ */
+typedef struct
+{
+	int valid;
+	off_t size; // -1 if missing
+	struct timespec mtime;
+} CfgFileStampType;
+
+const char* cfgFilePath(const char *env, const char *def);
+FILE* cfgFileOpen(const char *path);
+int cfgFileChanged(const char *path, CfgFileStampType *stamp);
+int cfgFileSet(const char *path, int bus, int stack, int ch, const char *value);
+
+#endif //CFGFILE_H_
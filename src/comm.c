@@ -8,14 +8,23 @@
  *	Author: Alexandru Burcea
  ***********************************************************************
  */
+#define _GNU_SOURCE // secure_getenv
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <dirent.h>
+#include <pthread.h>
 #include <sys/ioctl.h>
+#include <linux/i2c.h>
 #include <linux/i2c-dev.h>
+#include "rtd.h"
 #include "comm.h"
+#include "sim.h"
+#include "buslock.h"
 
 #define I2C_SLAVE	0x0703
 #define I2C_SMBUS	0x0720	/* SMBus-level access */
@@ -40,30 +49,173 @@
 #define I2C_SMBUS_BLOCK_MAX	32	/* As specified in SMBus standard */
 #define I2C_SMBUS_I2C_BLOCK_MAX	32	/* Not specified but we use same structure */
 
+#define I2C_DEV_MAX	(I2C_BUS_MAX * 8) // every stack level of every bus
 
-int i2cSetup(int addr)
+/*
+ * Slave address and adapter capabilities for every opened device, needed
+ * to build I2C_RDWR messages (the address is part of each message). The
+ * table is changed when a device is opened or closed, from any thread,
+ * so it is only accessed with gI2cDevMutex held and the transfers work on
+ * a copy of the entry
+ */
+typedef struct
+{
+	int dev;
+	int addr;
+	int rdwr;
+} I2cDevType;
+
+static I2cDevType gI2cDev[I2C_DEV_MAX];
+static int gI2cDevCount = 0;
+static pthread_mutex_t gI2cDevMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static I2cDevType* i2cDevFind(int dev)
+{
+	int i;
+
+	for (i = 0; i < gI2cDevCount; i++)
+	{
+		if (gI2cDev[i].dev == dev)
+		{
+			return &gI2cDev[i];
+		}
+	}
+	return NULL;
+}
+
+/*
+ * i2cDevGet:
+ *	Copy of the entry of a device, -1 if it has none
+ */
+static int i2cDevGet(int dev, I2cDevType *out)
+{
+	I2cDevType *pDev = NULL;
+
+	pthread_mutex_lock(&gI2cDevMutex);
+	pDev = i2cDevFind(dev);
+	if (NULL != pDev)
+	{
+		*out = *pDev;
+	}
+	pthread_mutex_unlock(&gI2cDevMutex);
+	return (NULL != pDev) ? 0 : -1;
+}
+
+/*
+ * i2cDevNoRdwr:
+ *	The adapter of a device turned out not to support I2C_RDWR
+ */
+static void i2cDevNoRdwr(int dev)
+{
+	I2cDevType *pDev = NULL;
+
+	pthread_mutex_lock(&gI2cDevMutex);
+	pDev = i2cDevFind(dev);
+	if (NULL != pDev)
+	{
+		pDev->rdwr = 0;
+	}
+	pthread_mutex_unlock(&gI2cDevMutex);
+}
+
+static void i2cDevRemove(int dev)
+{
+	I2cDevType *pDev = NULL;
+
+	pthread_mutex_lock(&gI2cDevMutex);
+	pDev = i2cDevFind(dev);
+	if (NULL != pDev)
+	{
+		*pDev = gI2cDev[--gI2cDevCount];
+	}
+	pthread_mutex_unlock(&gI2cDevMutex);
+}
+
+static void i2cDevAdd(int dev, int addr)
+{
+	I2cDevType *pDev = NULL;
+	unsigned long funcs = 0;
+	int rdwr = 0;
+
+	if ( (ioctl(dev, I2C_FUNCS, &funcs) >= 0) && (funcs & I2C_FUNC_I2C))
+	{
+		rdwr = 1;
+	}
+	pthread_mutex_lock(&gI2cDevMutex);
+	pDev = i2cDevFind(dev);
+	if ( (NULL == pDev) && (gI2cDevCount < I2C_DEV_MAX))
+	{
+		pDev = &gI2cDev[gI2cDevCount++];
+	}
+	if (NULL != pDev) // else no RDWR for this one, the write/read path still works
+	{
+		pDev->dev = dev;
+		pDev->addr = addr;
+		pDev->rdwr = rdwr;
+	}
+	pthread_mutex_unlock(&gI2cDevMutex);
+}
+
+
+static int i2cDevSetup(int bus, int addr)
 {
 	int file;
 	char filename[40];
-	sprintf(filename, "/dev/i2c-1");
+	sprintf(filename, "/dev/i2c-%d", bus);
 
 	if ( (file = open(filename, O_RDWR)) < 0)
 	{
-		printf("Failed to open the bus.");
-		return -1;
+		return COMM_SETUP_BUS;
 	}
 	if (ioctl(file, I2C_SLAVE, addr) < 0)
 	{
-		printf("Failed to acquire bus access and/or talk to slave.\n");
-		return -1;
+		close(file);
+		return COMM_SETUP_ADDR;
 	}
+	i2cDevAdd(file, addr);
 
 	return file;
 }
 
-int i2cMem8Read(int dev, int add, uint8_t* buff, int size)
+/*
+ * i2cMem8RdWr:
+ *	Register address write and data read in a single transfer with repeated
+ *	start, so no other master can move the register pointer in between.
+ *	Return 1 if the adapter does not support it and the caller must fall back.
+ */
+static int i2cMem8RdWr(const I2cDevType *pDev, uint8_t add, uint8_t* buff, int size)
+{
+	struct i2c_msg msgs[2];
+	struct i2c_rdwr_ioctl_data data;
+
+	msgs[0].addr = pDev->addr;
+	msgs[0].flags = 0;
+	msgs[0].len = 1;
+	msgs[0].buf = &add;
+	msgs[1].addr = pDev->addr;
+	msgs[1].flags = I2C_M_RD;
+	msgs[1].len = size;
+	msgs[1].buf = buff;
+	data.msgs = msgs;
+	data.nmsgs = 2;
+
+	if (ioctl(pDev->dev, I2C_RDWR, &data) == 2)
+	{
+		return 0;
+	}
+	if ( (errno == EOPNOTSUPP) || (errno == ENOTTY) || (errno == EINVAL))
+	{
+		i2cDevNoRdwr(pDev->dev);
+		return 1;
+	}
+	return -1;
+}
+
+static int i2cDevRead(int dev, int add, uint8_t* buff, int size)
 {
 	uint8_t intBuff[I2C_SMBUS_BLOCK_MAX];
+	I2cDevType devEntry;
+	int ret = 0;
 
 	if (NULL == buff)
 	{
@@ -75,6 +227,15 @@ int i2cMem8Read(int dev, int add, uint8_t* buff, int size)
 		return -1;
 	}
 
+	if ( (0 == i2cDevGet(dev, &devEntry)) && devEntry.rdwr)
+	{
+		ret = i2cMem8RdWr(&devEntry, 0xff & add, buff, size);
+		if (ret <= 0)
+		{
+			return ret;
+		}
+	}
+
 	intBuff[0] = 0xff & add;
 
 	if (write(dev, intBuff, 1) != 1)
@@ -90,7 +251,7 @@ int i2cMem8Read(int dev, int add, uint8_t* buff, int size)
 	return 0; //OK
 }
 
-int i2cMem8Write(int dev, int add, uint8_t* buff, int size)
+static int i2cDevWrite(int dev, int add, uint8_t* buff, int size)
 {
 	uint8_t intBuff[I2C_SMBUS_BLOCK_MAX];
 
@@ -115,5 +276,510 @@ int i2cMem8Write(int dev, int add, uint8_t* buff, int size)
 	return 0;
 }
 
+static void i2cDevClose(int dev)
+{
+	i2cDevRemove(dev);
+	close(dev);
+}
+
+/*
+ * i2cDevBusList:
+ *	Enumerate the /dev/i2c-* adapters, sorted by bus number
+ */
+static int i2cDevBusList(int *buses, int max)
+{
+	DIR *dir = NULL;
+	struct dirent *ent = NULL;
+	char *end = NULL;
+	int cnt = 0;
+	int bus = 0;
+	int i = 0;
+
+	dir = opendir("/dev");
+	if (NULL == dir)
+	{
+		return 0;
+	}
+	while ( (cnt < max) && (NULL != (ent = readdir(dir))))
+	{
+		if (strncmp(ent->d_name, "i2c-", 4) != 0)
+		{
+			continue;
+		}
+		bus = (int)strtol(ent->d_name + 4, &end, 10);
+		if ( (end == ent->d_name + 4) || (*end != 0) || (bus < 0) || (bus >= I2C_BUS_MAX))
+		{
+			continue; // the tables are indexed by bus * 8 + stack
+		}
+		for (i = cnt; (i > 0) && (buses[i - 1] > bus); i--)
+		{
+			buses[i] = buses[i - 1];
+		}
+		buses[i] = bus;
+		cnt++;
+	}
+	closedir(dir);
+	return cnt;
+}
+
+const CommTransportType gI2cDevTransport =
+{
+	"i2c",
+	&i2cDevSetup,
+	&i2cDevRead,
+	&i2cDevWrite,
+	&i2cDevClose,
+	&i2cDevBusList};
+
+static const CommTransportType *gTransports[] =
+{
+	&gI2cDevTransport,
+	&gSimTransport,
+	NULL};
+
+static const CommTransportType *gTransport = NULL;
 
+/*
+ * commTransportSet:
+ *	Select the backend by name, "i2c" (default) or "sim". If not called
+ *	the RTD_TRANSPORT environment variable is used on the first access.
+ */
+int commTransportSet(const char *name)
+{
+	int i = 0;
+
+	while (NULL != gTransports[i])
+	{
+		if (strcasecmp(name, gTransports[i]->name) == 0)
+		{
+			gTransport = gTransports[i];
+			return 0;
+		}
+		i++;
+	}
+	return -1;
+}
 
+const CommTransportType* commTransportGet(void)
+{
+	char *env = NULL;
+
+	if (NULL == gTransport)
+	{
+		gTransport = &gI2cDevTransport;
+		env = secure_getenv("RTD_TRANSPORT");
+		if ( (NULL != env) && (0 != commTransportSet(env)))
+		{
+			printf("Unknown transport \"%s\", using i2c\n", env);
+		}
+	}
+	return gTransport;
+}
+
+/*
+ * Connection cache, one handle for every (bus, address) pair so the device
+ * is opened and the slave address selected only once per process
+ */
+typedef struct
+{
+	int bus;
+	int addr;
+	int dev;
+	const CommTransportType *transport;
+	CommStatsType stats;
+} I2cConnType;
+
+static I2cConnType gI2cConn[I2C_DEV_MAX];
+static int gI2cConnCount = 0;
+static int gI2cAtExit = 0;
+static int gI2cBus = I2C_BUS_DEFAULT;
+static __thread int gI2cQuiet = 0;
+static pthread_mutex_t gI2cConnMutex = PTHREAD_MUTEX_INITIALIZER;
+static void (*gI2cFailHook)(int bus, int addr) = NULL;
+
+/*
+ * i2cBusSet:
+ *	Select the adapter used by i2cSetup(), /dev/i2c-1 if never called
+ */
+void i2cBusSet(int bus)
+{
+	gI2cBus = bus;
+}
+
+int i2cBusGet(void)
+{
+	return gI2cBus;
+}
+
+int i2cBusList(int *buses, int max)
+{
+	return commTransportGet()->busList(buses, max);
+}
+
+/*
+ * i2cQuietSet:
+ *	Turn off the setup error messages of the calling thread, for the
+ *	discovery that expects most addresses to fail
+ */
+void i2cQuietSet(int quiet)
+{
+	gI2cQuiet = quiet;
+}
+
+int i2cSetup(int addr)
+{
+	return i2cSetupBus(gI2cBus, addr);
+}
+
+int i2cSetupBus(int bus, int addr)
+{
+	const CommTransportType *transport = commTransportGet();
+	int dev = -1;
+	int i;
+
+	pthread_mutex_lock(&gI2cConnMutex);
+	for (i = 0; i < gI2cConnCount; i++)
+	{
+		if ( (gI2cConn[i].bus == bus) && (gI2cConn[i].addr == addr)
+			&& (gI2cConn[i].transport == transport))
+		{
+			dev = gI2cConn[i].dev;
+			pthread_mutex_unlock(&gI2cConnMutex);
+			return dev;
+		}
+	}
+	dev = transport->setup(bus, addr);
+	if ( (dev == COMM_SETUP_BUS) && !gI2cQuiet)
+	{
+		printf("Failed to open the bus.");
+	}
+	else if ( (dev == COMM_SETUP_ADDR) && !gI2cQuiet)
+	{
+		printf("Failed to acquire bus access and/or talk to slave.\n");
+	}
+	if ( (dev >= 0) && (gI2cConnCount >= I2C_DEV_MAX))
+	{
+		// a handle out of the cache could never be closed by i2cClose()
+		transport->close(dev);
+		dev = COMM_SETUP_FULL;
+		if (!gI2cQuiet)
+		{
+			printf("Too many open devices!\n");
+		}
+	}
+	if (dev >= 0)
+	{
+		gI2cConn[gI2cConnCount].bus = bus;
+		gI2cConn[gI2cConnCount].addr = addr;
+		gI2cConn[gI2cConnCount].dev = dev;
+		gI2cConn[gI2cConnCount].transport = transport;
+		memset(&gI2cConn[gI2cConnCount].stats, 0, sizeof(CommStatsType));
+		gI2cConnCount++;
+		if (!gI2cAtExit)
+		{
+			gI2cAtExit = 1;
+			atexit(i2cCloseAll);
+		}
+	}
+	pthread_mutex_unlock(&gI2cConnMutex);
+	return dev;
+}
+
+void i2cClose(int dev)
+{
+	int i;
+
+	pthread_mutex_lock(&gI2cConnMutex);
+	for (i = 0; i < gI2cConnCount; i++)
+	{
+		if (gI2cConn[i].dev == dev)
+		{
+			gI2cConn[i].transport->close(dev);
+			gI2cConn[i] = gI2cConn[--gI2cConnCount];
+			break;
+		}
+	}
+	pthread_mutex_unlock(&gI2cConnMutex);
+}
+
+void i2cCloseAll(void)
+{
+	pthread_mutex_lock(&gI2cConnMutex);
+	while (gI2cConnCount > 0)
+	{
+		gI2cConnCount--;
+		gI2cConn[gI2cConnCount].transport->close(gI2cConn[gI2cConnCount].dev);
+	}
+	pthread_mutex_unlock(&gI2cConnMutex);
+}
+
+/*
+ * Retry policy: failed transfers are repeated with exponential backoff and
+ * jitter when the error is transient (NACK, timeout, busy bus)
+ */
+static CommRetryType gI2cRetry =
+{
+	COMM_RETRY_ATTEMPTS,
+	COMM_RETRY_BASE_US,
+	COMM_RETRY_MAX_US};
+static int gI2cRetryLoaded = 0;
+static __thread unsigned int gI2cRetrySeed = 0;
+
+static void i2cRetryLoad(void)
+{
+	char *env = NULL;
+
+	if (gI2cRetryLoaded)
+	{
+		return;
+	}
+	gI2cRetryLoaded = 1;
+	env = secure_getenv("RTD_RETRY"); // attempts[,base_us[,max_us]]
+	if (NULL != env)
+	{
+		sscanf(env, "%d,%d,%d", &gI2cRetry.attempts, &gI2cRetry.baseUs,
+			&gI2cRetry.maxUs);
+		i2cRetrySet(&gI2cRetry);
+	}
+}
+
+void i2cRetrySet(const CommRetryType *retry)
+{
+	gI2cRetryLoaded = 1;
+	gI2cRetry = *retry;
+	if (gI2cRetry.attempts < 1)
+	{
+		gI2cRetry.attempts = 1;
+	}
+	if (gI2cRetry.attempts > RETRY_TIMES)
+	{
+		gI2cRetry.attempts = RETRY_TIMES;
+	}
+	if (gI2cRetry.baseUs < 0)
+	{
+		gI2cRetry.baseUs = 0;
+	}
+	if (gI2cRetry.maxUs < gI2cRetry.baseUs)
+	{
+		gI2cRetry.maxUs = gI2cRetry.baseUs;
+	}
+}
+
+void i2cRetryGet(CommRetryType *retry)
+{
+	i2cRetryLoad();
+	*retry = gI2cRetry;
+}
+
+static void i2cBackoff(int attempt)
+{
+	struct timespec ts;
+	long delay = gI2cRetry.baseUs;
+
+	while ( (attempt-- > 0) && (delay < gI2cRetry.maxUs))
+	{
+		delay *= 2;
+	}
+	if (delay > gI2cRetry.maxUs)
+	{
+		delay = gI2cRetry.maxUs;
+	}
+	if (0 == gI2cRetrySeed)
+	{
+		gI2cRetrySeed = (unsigned int)getpid() ^ (unsigned int)(uintptr_t)&ts;
+	}
+	// half fixed, half random so concurrent clients do not retry in lockstep
+	delay = delay / 2 + rand_r(&gI2cRetrySeed) % (delay / 2 + 1);
+	ts.tv_sec = delay / 1000000;
+	ts.tv_nsec = (delay % 1000000) * 1000;
+	nanosleep(&ts, NULL);
+}
+
+static I2cConnType* i2cConnFind(int dev)
+{
+	int i;
+
+	for (i = 0; i < gI2cConnCount; i++)
+	{
+		if (gI2cConn[i].dev == dev)
+		{
+			return &gI2cConn[i];
+		}
+	}
+	return NULL;
+}
+
+/*
+ * i2cXfer:
+ *	One register read or write, arbitrated and retried as configured.
+ *	Every attempt takes the bus lock separately so a retry does not keep
+ *	other programs waiting.
+ */
+static int i2cXfer(int dev, int add, uint8_t* buff, int size, int wr,
+	int attempts)
+{
+	const CommTransportType *transport = commTransportGet();
+	I2cConnType *pConn = NULL;
+	uint32_t ticket = 0;
+	uint64_t grant = 0;
+	int locked = 0;
+	int bus = -1;
+	int addr = -1;
+	int err = 0;
+	int ret = 0;
+	int i = 0;
+
+	pthread_mutex_lock(&gI2cConnMutex);
+	pConn = i2cConnFind(dev);
+	if (NULL != pConn)
+	{
+		bus = pConn->bus;
+		addr = pConn->addr;
+	}
+	pthread_mutex_unlock(&gI2cConnMutex);
+
+	for (i = 0; i < attempts; i++)
+	{
+		if (i > 0)
+		{
+			i2cBackoff(i - 1);
+		}
+		locked = (bus >= 0) && busLockEnabled()
+			&& (0 == busLockAcquire(bus, &ticket, &grant));
+		errno = 0;
+		if (wr)
+		{
+			ret = transport->write(dev, add, buff, size);
+		}
+		else
+		{
+			ret = transport->read(dev, add, buff, size);
+		}
+		err = errno;
+		if (locked)
+		{
+			busLockRelease(bus, ticket, grant);
+		}
+		if (ret == 0)
+		{
+			break;
+		}
+		pthread_mutex_lock(&gI2cConnMutex);
+		pConn = i2cConnFind(dev); // the table may have changed meanwhile
+		if (NULL != pConn)
+		{
+			switch (err)
+			{
+			case EREMOTEIO:
+			case ENXIO:
+				pConn->stats.nack++;
+				break;
+			case ETIMEDOUT:
+				pConn->stats.timeout++;
+				break;
+			case EAGAIN:
+			case EBUSY:
+				pConn->stats.again++;
+				break;
+			default:
+				pConn->stats.other++;
+				break;
+			}
+		}
+		pthread_mutex_unlock(&gI2cConnMutex);
+		if ( (err != EREMOTEIO) && (err != ENXIO) && (err != ETIMEDOUT)
+			&& (err != EAGAIN) && (err != EBUSY))
+		{
+			break; // not transient, a retry will not help
+		}
+	}
+	pthread_mutex_lock(&gI2cConnMutex);
+	pConn = i2cConnFind(dev);
+	if (NULL != pConn)
+	{
+		pConn->stats.xfers++;
+		pConn->stats.retries += (i < attempts) ? i : attempts - 1;
+		if (ret != 0)
+		{
+			pConn->stats.failures++;
+		}
+	}
+	pthread_mutex_unlock(&gI2cConnMutex);
+	if ( (ret != 0) && (attempts > 1) && (NULL != gI2cFailHook) && (bus >= 0))
+	{
+		gI2cFailHook(bus, addr); // not for the probes, a NACK is expected there
+	}
+	errno = err;
+	return ret;
+}
+
+int i2cMem8Read(int dev, int add, uint8_t* buff, int size)
+{
+	i2cRetryLoad();
+	return i2cXfer(dev, add, buff, size, 0, gI2cRetry.attempts);
+}
+
+int i2cMem8Write(int dev, int add, uint8_t* buff, int size)
+{
+	i2cRetryLoad();
+	return i2cXfer(dev, add, buff, size, 1, gI2cRetry.attempts);
+}
+
+/*
+ * i2cMem8Probe:
+ *	Single attempt read, for scanning addresses where a NACK is expected
+ */
+int i2cMem8Probe(int dev, int add, uint8_t* buff, int size)
+{
+	return i2cXfer(dev, add, buff, size, 0, 1);
+}
+
+/*
+ * i2cFailHookSet:
+ *	Called after a transfer failed all its attempts, with the bus and the
+ *	slave address
+ */
+void i2cFailHookSet(void (*hook)(int bus, int addr))
+{
+	gI2cFailHook = hook;
+}
+
+/*
+ * i2cDevAddr:
+ *	Bus and slave address of a handle returned by i2cSetupBus()
+ */
+int i2cDevAddr(int dev, int *bus, int *addr)
+{
+	I2cConnType *pConn = NULL;
+	int ret = -1;
+
+	pthread_mutex_lock(&gI2cConnMutex);
+	pConn = i2cConnFind(dev);
+	if (NULL != pConn)
+	{
+		*bus = pConn->bus;
+		*addr = pConn->addr;
+		ret = 0;
+	}
+	pthread_mutex_unlock(&gI2cConnMutex);
+	return ret;
+}
+
+int i2cStatsGet(int bus, int addr, CommStatsType *stats)
+{
+	int ret = -1;
+	int i;
+
+	pthread_mutex_lock(&gI2cConnMutex);
+	for (i = 0; i < gI2cConnCount; i++)
+	{
+		if ( (gI2cConn[i].bus == bus) && (gI2cConn[i].addr == addr))
+		{
+			*stats = gI2cConn[i].stats;
+			ret = 0;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&gI2cConnMutex);
+	return ret;
+}
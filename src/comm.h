@@ -3,9 +3,72 @@
 
 #include <stdint.h>
 
+/*
+ * Bus access backend, selected at runtime (see commTransportSet)
+ */
+typedef struct
+{
+	const char *name;
+	int (*setup)(int bus, int addr); // handle, COMM_SETUP_BUS or COMM_SETUP_ADDR
+	int (*read)(int dev, int add, uint8_t* buff, int size);
+	int (*write)(int dev, int add, uint8_t* buff, int size);
+	void (*close)(int dev);
+	int (*busList)(int *buses, int max);
+} CommTransportType;
+
+#define COMM_SETUP_BUS	-1 // the adapter could not be opened
+#define COMM_SETUP_ADDR	-2 // the slave address could not be selected
+#define COMM_SETUP_FULL	-3 // no room left in the connection cache
+
+#define I2C_BUS_DEFAULT	1
+#define I2C_BUS_MAX	32
+
+#define COMM_RETRY_ATTEMPTS	3
+#define COMM_RETRY_BASE_US	200
+#define COMM_RETRY_MAX_US	5000
+
+typedef struct
+{
+	int attempts; // total tries per transfer [1..RETRY_TIMES]
+	int baseUs; // first backoff delay, doubled on every retry
+	int maxUs; // backoff delay cap
+} CommRetryType;
+
+/*
+ * Per board transfer counters, failed attempts are counted by errno class
+ */
+typedef struct
+{
+	uint64_t xfers;
+	uint64_t retries;
+	uint64_t failures; // transfers failed after all the attempts
+	uint64_t nack; // EREMOTEIO, ENXIO
+	uint64_t timeout; // ETIMEDOUT
+	uint64_t again; // EAGAIN, EBUSY
+	uint64_t other;
+} CommStatsType;
+
+extern const CommTransportType gI2cDevTransport;
+
+int commTransportSet(const char *name);
+const CommTransportType* commTransportGet(void);
+
+void i2cBusSet(int bus);
+int i2cBusGet(void);
+int i2cBusList(int *buses, int max);
 int i2cSetup(int addr);
+int i2cSetupBus(int bus, int addr);
+void i2cQuietSet(int quiet);
+void i2cClose(int dev);
+void i2cCloseAll(void);
 int i2cMem8Read(int dev, int add, uint8_t* buff, int size);
 int i2cMem8Write(int dev, int add, uint8_t* buff, int size);
+int i2cMem8Probe(int dev, int add, uint8_t* buff, int size);
+void i2cRetrySet(const CommRetryType *retry);
+void i2cRetryGet(CommRetryType *retry);
+int i2cStatsGet(int bus, int addr, CommStatsType *stats);
+void i2cFailHookSet(void (*hook)(int bus, int addr));
+int i2cDevAddr(int dev, int *bus, int *addr);
 
 
 #endif //COMM_H_
@@ -0,0 +1,216 @@
+/*
+ * curve.c:
+ *	Sensor curve registry and per channel bindings, see curve.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "rtd.h"
+#include "curve.h"
+#include "cfgfile.h"
+#include "curvetab.h" // generated by curvegen
+
+#define CURVE_LINE_MAX	128
+#define CURVE_BIND_MAX	512 // channels bound to a curve
+
+typedef struct
+{
+	u8 bus;
+	u8 stack;
+	u8 ch;
+	int id;
+} CurveBindType;
+
+static CurveBindType gCurveBind[CURVE_BIND_MAX];
+static int gCurveBinds = 0;
+static CfgFileStampType gCurveStamp;
+static pthread_mutex_t gCurveMutex = PTHREAD_MUTEX_INITIALIZER;
+
+int rtdCurveCount(void)
+{
+	return sizeof(gCurveList) / sizeof(gCurveList[0]);
+}
+
+const RtdCurveType* rtdCurveGet(int id)
+{
+	if ( (id < 0) || (id >= rtdCurveCount()))
+	{
+		return NULL;
+	}
+	return &gCurveList[id];
+}
+
+/*
+ * rtdCurveFind:
+ *	Curve id from its name, "auto" gives RTD_CURVE_AUTO, RTD_CURVE_NONE if
+ *	unknown
+ */
+int rtdCurveFind(const char *name)
+{
+	int i = 0;
+
+	if (0 == strcasecmp(name, "auto"))
+	{
+		return RTD_CURVE_AUTO;
+	}
+	for (i = 0; i < rtdCurveCount(); i++)
+	{
+		if (0 == strcasecmp(name, gCurveList[i].name))
+		{
+			return i;
+		}
+	}
+	return RTD_CURVE_NONE;
+}
+
+/*
+ * rtdCurveTemp:
+ *	Table index and 4 point Lagrange interpolation, linear on the first and
+ *	the last interval and beyond the table ends
+ */
+float rtdCurveTemp(const RtdCurveType *c, float res)
+{
+	const float *y = NULL;
+	double x = (res - c->rMin) * c->rScale;
+	double u = 0;
+	int i = 0;
+
+	if (isnan(x))
+	{
+		return NAN;
+	}
+	if ( (x < 1) || (x >= c->size - 2))
+	{
+		i = (x < 1) ? 0 : c->size - 2;
+		u = x - i;
+		return c->tab[i] + u * (c->tab[i + 1] - c->tab[i]);
+	}
+	i = (int)x;
+	u = x - i;
+	y = c->tab + i;
+	return ( (u - 1) * (u - 2) * ( (u + 1) * y[0] / 2 - u * y[-1] / 6)
+		- u * (u + 1) * ( (u - 2) * y[1] / 2 - (u - 1) * y[2] / 6));
+}
+
+void rtdCurveBatch(const RtdCurveType *c, const float *res, float *out, int n)
+{
+	int i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		out[i] = rtdCurveTemp(c, res[i]);
+	}
+}
+
+/*
+ * rtdCurveResolve:
+ *	Curve of a channel bound to RTD_CURVE_AUTO, from the card sensor type
+ */
+int rtdCurveResolve(int id, int sensorType)
+{
+	if (id != RTD_CURVE_AUTO)
+	{
+		return id;
+	}
+	return rtdCurveFind( (sensorType == 1) ? "pt1000" : "pt100");
+}
+
+static const char* curveBindPath(void)
+{
+	return cfgFilePath("RTD_CURVES", RTD_CURVE_BIND_PATH);
+}
+
+/*
+ * curveBindLoad:
+ *	Read the bindings file again if it changed, called with gCurveMutex
+ *	held. A later line of a channel wins, as the writer keeps one
+ */
+static void curveBindLoad(void)
+{
+	char line[CURVE_LINE_MAX];
+	char name[CURVE_LINE_MAX];
+	FILE *in = NULL;
+	int id = 0;
+	int b = 0;
+	int s = 0;
+	int c = 0;
+
+	if (!cfgFileChanged(curveBindPath(), &gCurveStamp))
+	{
+		return;
+	}
+	gCurveBinds = 0;
+	in = cfgFileOpen(curveBindPath());
+	if (NULL == in)
+	{
+		return;
+	}
+	while ( (NULL != fgets(line, sizeof(line), in)) && (gCurveBinds < CURVE_BIND_MAX))
+	{
+		if ( (4 != sscanf(line, "%d %d %d %127s", &b, &s, &c, name)) || (b < 0)
+			|| (b >= I2C_BUS_MAX) || (s < 0) || (s > 7) || (c < CHANNEL_NR_MIN)
+			|| (c > RTD_CH_NR_MAX))
+		{
+			continue;
+		}
+		id = rtdCurveFind(name);
+		gCurveBind[gCurveBinds].bus = b;
+		gCurveBind[gCurveBinds].stack = s;
+		gCurveBind[gCurveBinds].ch = c;
+		gCurveBind[gCurveBinds++].id = (id == RTD_CURVE_NONE) ? RTD_CURVE_AUTO : id;
+	}
+	fclose(in);
+}
+
+/*
+ * rtdCurveBindGet:
+ *	Curve bound to a channel, RTD_CURVE_AUTO if none or if the bound curve
+ *	is not in this build. The file is only parsed again when it changed
+ */
+int rtdCurveBindGet(int bus, int stack, int ch)
+{
+	int id = RTD_CURVE_AUTO;
+	int i = 0;
+
+	pthread_mutex_lock(&gCurveMutex);
+	curveBindLoad();
+	for (i = 0; i < gCurveBinds; i++)
+	{
+		if ( (gCurveBind[i].bus == bus) && (gCurveBind[i].stack == stack)
+			&& (gCurveBind[i].ch == ch))
+		{
+			id = gCurveBind[i].id;
+		}
+	}
+	pthread_mutex_unlock(&gCurveMutex);
+	return id;
+}
+
+/*
+ * rtdCurveBindSet:
+ *	Bind a channel to a curve, RTD_CURVE_AUTO removes the binding
+ */
+int rtdCurveBindSet(int bus, int stack, int ch, int id)
+{
+	if ( (id != RTD_CURVE_AUTO) && (NULL == rtdCurveGet(id)))
+	{
+		return ERROR;
+	}
+	if (OK != cfgFileSet(curveBindPath(), bus, stack, ch,
+		(id != RTD_CURVE_AUTO) ? gCurveList[id].name : NULL))
+	{
+		return ERROR;
+	}
+	pthread_mutex_lock(&gCurveMutex);
+	gCurveStamp.valid = 0; // seen by this process at once
+	pthread_mutex_unlock(&gCurveMutex);
+	return OK;
+}
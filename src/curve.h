@@ -0,0 +1,44 @@
+#ifndef CURVE_H_
+#define CURVE_H_
+
+/*
+ * Registry of the sensor curves. Every curve is a table of the temperature
+ * at RTD_CURVE_POINTS resistances evenly spaced over its range, generated
+ * at build time by curvegen.c: the built-in PT100, PT1000 (IEC 60751),
+ * Ni120 (DIN 43760 equation, R0 = 120 ohm) and Cu10 (alpha 0.00427,
+ * 10 ohm at 25 degC), plus the curve files listed in the CURVES make
+ * variable. A conversion is one index and a 4 point interpolation, the
+ * table ends are extended linearly.
+ *
+ * Every channel of every card is bound to a curve by name in the file
+ * /etc/rtd-curves (RTD_CURVES environment variable), one
+ * "<bus> <stack> <channel> <curve>" line each. Unbound channels follow the
+ * sensor type of the card (RTD_CURVE_AUTO).
+ */
+#define RTD_CURVE_POINTS	1024
+#define RTD_CURVE_NAME_MAX	16
+#define RTD_CURVE_BIND_PATH	"/etc/rtd-curves"
+#define RTD_CURVE_AUTO	-1
+#define RTD_CURVE_NONE	-2
+
+typedef struct
+{
+	const char *name;
+	const char *desc;
+	double rMin; // ohm at tab[0]
+	double rScale; // points per ohm
+	int size;
+	const float *tab;
+} RtdCurveType;
+
+int rtdCurveCount(void);
+const RtdCurveType* rtdCurveGet(int id);
+int rtdCurveFind(const char *name);
+float rtdCurveTemp(const RtdCurveType *c, float res);
+void rtdCurveBatch(const RtdCurveType *c, const float *res, float *out, int n);
+
+int rtdCurveBindGet(int bus, int stack, int ch);
+int rtdCurveBindSet(int bus, int stack, int ch, int id);
+int rtdCurveResolve(int id, int sensorType);
+
+#endif //CURVE_H_
@@ -0,0 +1,345 @@
+/*
+ * curvegen.c:
+ *	Build time generator of the sensor curve tables used by curve.c
+ *	Usage: curvegen [curve files] > curvetab.h
+ *
+ *	A curve file holds "name=", optional "desc=", then either
+ *	"poly=c0,c1,..." (temperature as a polynomial of the resistance) with
+ *	"range=<ohm min>,<ohm max>", or "<ohm>,<degC>" lines with increasing
+ *	resistances. Empty lines and lines starting with '#' are ignored.
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+
+#include "rtdconv.h"
+#include "curve.h"
+
+#define CURVES_MAX	32
+#define CSV_POINTS_MAX	4096
+#define POLY_MAX	8
+#define LINE_MAX	256
+
+typedef struct
+{
+	char name[RTD_CURVE_NAME_MAX];
+	char desc[64];
+	double rMin;
+	double rMax;
+	double (*temp)(const void *ctx, double r);
+	double (*res)(double t); // forward equations, inverted by bisection
+	double tMin;
+	double tMax;
+	double r0; // Callendar-Van Dusen
+	int polyNr;
+	double poly[POLY_MAX];
+	int points;
+	double pr[CSV_POINTS_MAX];
+	double pt[CSV_POINTS_MAX];
+} CurveDefType;
+
+static CurveDefType gDef[CURVES_MAX];
+static int gDefNr = 0;
+
+static double ni120Res(double t)
+{
+	double t2 = t * t;
+
+	return 120 * (1 + 5.485e-3 * t + 6.65e-6 * t2 + 2.805e-11 * t2 * t2 - 2e-17 * t2 * t2 * t2);
+}
+
+static double cu10Res(double t)
+{
+	return 10 / (1 + 25 * 4.27e-3) * (1 + 4.27e-3 * t);
+}
+
+static double cvdTemp(const void *ctx, double r)
+{
+	return rtdCvdTempExact(r, ((const CurveDefType*)ctx)->r0);
+}
+
+static double forwardTemp(const void *ctx, double r)
+{
+	const CurveDefType *d = ctx;
+	double lo = d->tMin;
+	double hi = d->tMax;
+	double mid = 0;
+	int i = 0;
+
+	for (i = 0; i < 100; i++)
+	{
+		mid = (lo + hi) / 2;
+		if (d->res(mid) < r)
+		{
+			lo = mid;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	return (lo + hi) / 2;
+}
+
+static double polyTemp(const void *ctx, double r)
+{
+	const CurveDefType *d = ctx;
+	double t = 0;
+	int i = 0;
+
+	for (i = d->polyNr - 1; i >= 0; i--)
+	{
+		t = t * r + d->poly[i];
+	}
+	return t;
+}
+
+static double csvTemp(const void *ctx, double r)
+{
+	const CurveDefType *d = ctx;
+	int i = 1;
+
+	while ( (i < d->points - 1) && (d->pr[i] < r))
+	{
+		i++;
+	}
+	return d->pt[i - 1] + (r - d->pr[i - 1]) * (d->pt[i] - d->pt[i - 1])
+		/ (d->pr[i] - d->pr[i - 1]);
+}
+
+static CurveDefType* curveNew(const char *name, const char *desc)
+{
+	CurveDefType *d = NULL;
+
+	if (gDefNr >= CURVES_MAX)
+	{
+		fprintf(stderr, "curvegen: too many curves\n");
+		exit(1);
+	}
+	d = &gDef[gDefNr++];
+	memset(d, 0, sizeof(*d));
+	snprintf(d->name, sizeof(d->name), "%s", name);
+	snprintf(d->desc, sizeof(d->desc), "%s", desc);
+	return d;
+}
+
+static void curveForward(const char *name, const char *desc, double (*res)(double),
+	double tMin, double tMax)
+{
+	CurveDefType *d = curveNew(name, desc);
+
+	d->res = res;
+	d->tMin = tMin;
+	d->tMax = tMax;
+	d->rMin = res(tMin);
+	d->rMax = res(tMax);
+	d->temp = forwardTemp;
+}
+
+static void curveCvd(const char *name, const char *desc, double r0)
+{
+	CurveDefType *d = curveNew(name, desc);
+
+	d->r0 = r0;
+	d->rMin = rtdCvdRes(-200, r0);
+	d->rMax = rtdCvdRes(850, r0);
+	d->temp = cvdTemp;
+}
+
+static void fail(const char *file, int line, const char *msg)
+{
+	fprintf(stderr, "%s:%d: %s\n", file, line, msg);
+	exit(1);
+}
+
+static int parseList(char *str, double *val, int max)
+{
+	char *end = NULL;
+	int n = 0;
+
+	while (n < max)
+	{
+		val[n] = strtod(str, &end);
+		if (end == str)
+		{
+			return -1;
+		}
+		n++;
+		while (isspace((unsigned char)*end))
+		{
+			end++;
+		}
+		if (*end != ',')
+		{
+			return (*end == 0) ? n : -1;
+		}
+		str = end + 1;
+	}
+	return -1;
+}
+
+static void curveFile(const char *file)
+{
+	char line[LINE_MAX];
+	double v[POLY_MAX];
+	CurveDefType *d = NULL;
+	FILE *in = fopen(file, "r");
+	char *p = NULL;
+	int lineNr = 0;
+	int n = 0;
+	int i = 0;
+
+	if (NULL == in)
+	{
+		fail(file, 0, "can not open");
+	}
+	d = curveNew("", "user curve");
+	while (NULL != fgets(line, sizeof(line), in))
+	{
+		lineNr++;
+		line[strcspn(line, "\r\n")] = 0;
+		p = line;
+		while (isspace((unsigned char)*p))
+		{
+			p++;
+		}
+		if ( (*p == 0) || (*p == '#'))
+		{
+			continue;
+		}
+		if (0 == strncmp(p, "name=", 5))
+		{
+			snprintf(d->name, sizeof(d->name), "%s", p + 5);
+		}
+		else if (0 == strncmp(p, "desc=", 5))
+		{
+			snprintf(d->desc, sizeof(d->desc), "%s", p + 5);
+			for (i = 0; d->desc[i]; i++)
+			{
+				if ( (d->desc[i] == '"') || (d->desc[i] == '\\'))
+				{
+					d->desc[i] = '\''; // goes in a C string
+				}
+			}
+		}
+		else if (0 == strncmp(p, "poly=", 5))
+		{
+			d->polyNr = parseList(p + 5, d->poly, POLY_MAX);
+			if (d->polyNr <= 0)
+			{
+				fail(file, lineNr, "poly= expects up to 8 comma separated coefficients");
+			}
+		}
+		else if (0 == strncmp(p, "range=", 6))
+		{
+			if ( (2 != parseList(p + 6, v, 2)) || (v[0] >= v[1]))
+			{
+				fail(file, lineNr, "range= expects <ohm min>,<ohm max>");
+			}
+			d->rMin = v[0];
+			d->rMax = v[1];
+		}
+		else
+		{
+			n = d->points;
+			if ( (n >= CSV_POINTS_MAX) || (2 != parseList(p, v, 2)))
+			{
+				fail(file, lineNr, "expected <ohm>,<degC>");
+			}
+			if ( (n > 0) && (v[0] <= d->pr[n - 1]))
+			{
+				fail(file, lineNr, "the resistances must increase");
+			}
+			d->pr[n] = v[0];
+			d->pt[n] = v[1];
+			d->points++;
+		}
+	}
+	fclose(in);
+	if ( (d->polyNr > 0) == (d->points > 0))
+	{
+		fail(file, lineNr, "a curve is either poly= or a list of points");
+	}
+	if (d->polyNr > 0)
+	{
+		if (d->rMin >= d->rMax)
+		{
+			fail(file, lineNr, "poly= needs range=");
+		}
+		d->temp = polyTemp;
+	}
+	else
+	{
+		if (d->points < 2)
+		{
+			fail(file, lineNr, "at least 2 points needed");
+		}
+		d->rMin = d->pr[0];
+		d->rMax = d->pr[d->points - 1];
+		d->temp = csvTemp;
+	}
+	if (d->name[0] == 0)
+	{
+		fail(file, lineNr, "name= missing");
+	}
+	for (i = 0; d->name[i]; i++)
+	{
+		if (!isalnum((unsigned char)d->name[i]) && (d->name[i] != '_'))
+		{
+			fail(file, lineNr, "the name may only hold letters, digits and '_'");
+		}
+	}
+	for (i = 0; i < gDefNr - 1; i++)
+	{
+		if (0 == strcasecmp(gDef[i].name, d->name))
+		{
+			fail(file, lineNr, "duplicate curve name");
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	CurveDefType *d = NULL;
+	double step = 0;
+	int i = 0;
+	int k = 0;
+
+	curveCvd("pt100", "IEC 60751, R0 = 100 ohm", RTD_CVD_R0_PT100);
+	curveCvd("pt1000", "IEC 60751, R0 = 1000 ohm", RTD_CVD_R0_PT1000);
+	curveForward("ni120", "DIN 43760 equation, R0 = 120 ohm", ni120Res, -60, 180);
+	curveForward("cu10", "alpha 0.00427, 10 ohm at 25 degC", cu10Res, -100, 260);
+	for (i = 1; i < argc; i++)
+	{
+		curveFile(argv[i]);
+	}
+
+	printf("/* generated by curvegen, do not edit */\n");
+	for (k = 0; k < gDefNr; k++)
+	{
+		d = &gDef[k];
+		step = (d->rMax - d->rMin) / (RTD_CURVE_POINTS - 1);
+		printf("static const float gCurveTab%d[%d] =\n{\n", k, RTD_CURVE_POINTS);
+		for (i = 0; i < RTD_CURVE_POINTS; i++)
+		{
+			printf("\t%.9g,\n", d->temp(d, d->rMin + i * step));
+		}
+		printf("};\n\n");
+	}
+	printf("static const RtdCurveType gCurveList[%d] =\n{\n", gDefNr);
+	for (k = 0; k < gDefNr; k++)
+	{
+		d = &gDef[k];
+		printf("\t{\"%s\", \"%s\", %.17g, %.17g, %d, gCurveTab%d},\n", d->name, d->desc,
+			d->rMin, (RTD_CURVE_POINTS - 1) / (d->rMax - d->rMin), RTD_CURVE_POINTS, k);
+	}
+	printf("};\n");
+	return 0;
+}
@@ -0,0 +1,4120 @@
+/* generated by curvegen, do not edit */
+static const float gCurveTab0[1024] =
+{
+	-200,
+	-199.15869,
+	-198.316783,
+	-197.47428,
+	-196.631183,
+	-195.787493,
+	-194.943213,
+	-194.098345,
+	-193.25289,
+	-192.40685,
+	-191.560227,
+	-190.713024,
+	-189.865241,
+	-189.016881,
+	-188.167945,
+	-187.318436,
+	-186.468356,
+	-185.617706,
+	-184.766488,
+	-183.914704,
+	-183.062357,
+	-182.209447,
+	-181.355978,
+	-180.50195,
+	-179.647366,
+	-178.792228,
+	-177.936537,
+	-177.080296,
+	-176.223507,
+	-175.366171,
+	-174.508291,
+	-173.649868,
+	-172.790904,
+	-171.931402,
+	-171.071364,
+	-170.21079,
+	-169.349684,
+	-168.488047,
+	-167.625881,
+	-166.763188,
+	-165.899971,
+	-165.036231,
+	-164.171969,
+	-163.307189,
+	-162.441892,
+	-161.57608,
+	-160.709756,
+	-159.84292,
+	-158.975575,
+	-158.107723,
+	-157.239367,
+	-156.370507,
+	-155.501146,
+	-154.631286,
+	-153.76093,
+	-152.890078,
+	-152.018733,
+	-151.146897,
+	-150.274572,
+	-149.40176,
+	-148.528463,
+	-147.654683,
+	-146.780422,
+	-145.905681,
+	-145.030464,
+	-144.154771,
+	-143.278605,
+	-142.401968,
+	-141.524862,
+	-140.647289,
+	-139.76925,
+	-138.890748,
+	-138.011785,
+	-137.132362,
+	-136.252482,
+	-135.372147,
+	-134.491358,
+	-133.610118,
+	-132.728429,
+	-131.846291,
+	-130.963708,
+	-130.080682,
+	-129.197214,
+	-128.313306,
+	-127.42896,
+	-126.544178,
+	-125.658962,
+	-124.773315,
+	-123.887237,
+	-123.000731,
+	-122.113798,
+	-121.226442,
+	-120.338662,
+	-119.450463,
+	-118.561844,
+	-117.672809,
+	-116.783359,
+	-115.893495,
+	-115.003221,
+	-114.112538,
+	-113.221446,
+	-112.32995,
+	-111.43805,
+	-110.545747,
+	-109.653045,
+	-108.759945,
+	-107.866448,
+	-106.972557,
+	-106.078273,
+	-105.183598,
+	-104.288534,
+	-103.393083,
+	-102.497246,
+	-101.601025,
+	-100.704423,
+	-99.8074397,
+	-98.9100784,
+	-98.0123404,
+	-97.1142274,
+	-96.2157412,
+	-95.3168835,
+	-94.417656,
+	-93.5180604,
+	-92.6180984,
+	-91.7177717,
+	-90.8170821,
+	-89.9160311,
+	-89.0146204,
+	-88.1128518,
+	-87.2107268,
+	-86.3082471,
+	-85.4054143,
+	-84.50223,
+	-83.5986959,
+	-82.6948136,
+	-81.7905846,
+	-80.8860105,
+	-79.9810929,
+	-79.0758334,
+	-78.1702336,
+	-77.2642948,
+	-76.3580188,
+	-75.451407,
+	-74.5444609,
+	-73.637182,
+	-72.7295718,
+	-71.8216318,
+	-70.9133635,
+	-70.0047683,
+	-69.0958477,
+	-68.186603,
+	-67.2770358,
+	-66.3671474,
+	-65.4569392,
+	-64.5464127,
+	-63.6355691,
+	-62.7244098,
+	-61.8129363,
+	-60.9011498,
+	-59.9890517,
+	-59.0766433,
+	-58.1639259,
+	-57.2509007,
+	-56.3375691,
+	-55.4239323,
+	-54.5099916,
+	-53.5957482,
+	-52.6812033,
+	-51.7663581,
+	-50.851214,
+	-49.9357719,
+	-49.0200331,
+	-48.1039988,
+	-47.1876701,
+	-46.2710482,
+	-45.3541341,
+	-44.436929,
+	-43.5194339,
+	-42.6016499,
+	-41.6835781,
+	-40.7652196,
+	-39.8465753,
+	-38.9276463,
+	-38.0084336,
+	-37.0889382,
+	-36.169161,
+	-35.2491031,
+	-34.3287653,
+	-33.4081486,
+	-32.4872539,
+	-31.5660821,
+	-30.644634,
+	-29.7229107,
+	-28.8009128,
+	-27.8786413,
+	-26.956097,
+	-26.0332806,
+	-25.1101931,
+	-24.186835,
+	-23.2632073,
+	-22.3393106,
+	-21.4151457,
+	-20.4907133,
+	-19.566014,
+	-18.6410486,
+	-17.7158178,
+	-16.7903221,
+	-15.8645622,
+	-14.9385387,
+	-14.0122522,
+	-13.0857033,
+	-12.1588925,
+	-11.2318204,
+	-10.3044876,
+	-9.37689448,
+	-8.44904158,
+	-7.52092938,
+	-6.59255834,
+	-5.6639289,
+	-4.73504148,
+	-3.80589649,
+	-2.87649432,
+	-1.94683533,
+	-1.01691989,
+	-0.0867483226,
+	0.843679116,
+	1.77436252,
+	2.70530211,
+	3.63649809,
+	4.56795067,
+	5.49966007,
+	6.4316265,
+	7.36385017,
+	8.29633129,
+	9.22907009,
+	10.1620668,
+	11.0953215,
+	12.0288346,
+	12.9626062,
+	13.8966366,
+	14.8309258,
+	15.7654743,
+	16.7002822,
+	17.6353496,
+	18.5706769,
+	19.5062642,
+	20.4421118,
+	21.3782198,
+	22.3145885,
+	23.2512181,
+	24.1881089,
+	25.125261,
+	26.0626746,
+	27.00035,
+	27.9382875,
+	28.8764871,
+	29.8149492,
+	30.7536739,
+	31.6926616,
+	32.6319123,
+	33.5714263,
+	34.5112039,
+	35.4512453,
+	36.3915506,
+	37.3321202,
+	38.2729542,
+	39.2140528,
+	40.1554163,
+	41.097045,
+	42.0389389,
+	42.9810984,
+	43.9235237,
+	44.866215,
+	45.8091725,
+	46.7523965,
+	47.6958871,
+	48.6396447,
+	49.5836694,
+	50.5279614,
+	51.472521,
+	52.4173485,
+	53.362444,
+	54.3078077,
+	55.25344,
+	56.1993409,
+	57.1455109,
+	58.09195,
+	59.0386585,
+	59.9856367,
+	60.9328848,
+	61.8804029,
+	62.8281915,
+	63.7762505,
+	64.7245804,
+	65.6731813,
+	66.6220535,
+	67.5711972,
+	68.5206126,
+	69.4703,
+	70.4202596,
+	71.3704916,
+	72.3209963,
+	73.2717739,
+	74.2228246,
+	75.1741487,
+	76.1257464,
+	77.077618,
+	78.0297636,
+	78.9821836,
+	79.9348781,
+	80.8878474,
+	81.8410918,
+	82.7946114,
+	83.7484065,
+	84.7024774,
+	85.6568243,
+	86.6114474,
+	87.566347,
+	88.5215232,
+	89.4769765,
+	90.4327069,
+	91.3887147,
+	92.3450002,
+	93.3015637,
+	94.2584053,
+	95.2155252,
+	96.1729239,
+	97.1306014,
+	98.0885581,
+	99.0467941,
+	100.00531,
+	100.964105,
+	101.923181,
+	102.882537,
+	103.842173,
+	104.802091,
+	105.762289,
+	106.722769,
+	107.683531,
+	108.644574,
+	109.605899,
+	110.567507,
+	111.529397,
+	112.49157,
+	113.454027,
+	114.416766,
+	115.379789,
+	116.343096,
+	117.306687,
+	118.270563,
+	119.234723,
+	120.199167,
+	121.163897,
+	122.128913,
+	123.094213,
+	124.0598,
+	125.025673,
+	125.991832,
+	126.958278,
+	127.92501,
+	128.89203,
+	129.859337,
+	130.826932,
+	131.794815,
+	132.762986,
+	133.731445,
+	134.700193,
+	135.66923,
+	136.638556,
+	137.608171,
+	138.578076,
+	139.548271,
+	140.518757,
+	141.489532,
+	142.460599,
+	143.431957,
+	144.403605,
+	145.375546,
+	146.347778,
+	147.320302,
+	148.293119,
+	149.266228,
+	150.23963,
+	151.213325,
+	152.187313,
+	153.161596,
+	154.136172,
+	155.111042,
+	156.086206,
+	157.061666,
+	158.03742,
+	159.01347,
+	159.989815,
+	160.966456,
+	161.943392,
+	162.920626,
+	163.898155,
+	164.875982,
+	165.854106,
+	166.832527,
+	167.811246,
+	168.790263,
+	169.769578,
+	170.749191,
+	171.729104,
+	172.709315,
+	173.689825,
+	174.670636,
+	175.651746,
+	176.633156,
+	177.614866,
+	178.596878,
+	179.57919,
+	180.561803,
+	181.544718,
+	182.527935,
+	183.511454,
+	184.495275,
+	185.479399,
+	186.463826,
+	187.448556,
+	188.433589,
+	189.418926,
+	190.404567,
+	191.390513,
+	192.376763,
+	193.363318,
+	194.350178,
+	195.337343,
+	196.324815,
+	197.312592,
+	198.300675,
+	199.289066,
+	200.277763,
+	201.266767,
+	202.256078,
+	203.245698,
+	204.235625,
+	205.225861,
+	206.216405,
+	207.207258,
+	208.19842,
+	209.189892,
+	210.181673,
+	211.173765,
+	212.166167,
+	213.158879,
+	214.151903,
+	215.145237,
+	216.138883,
+	217.132841,
+	218.127111,
+	219.121693,
+	220.116588,
+	221.111796,
+	222.107317,
+	223.103152,
+	224.099301,
+	225.095763,
+	226.092541,
+	227.089633,
+	228.08704,
+	229.084762,
+	230.0828,
+	231.081154,
+	232.079824,
+	233.078811,
+	234.078114,
+	235.077735,
+	236.077673,
+	237.077929,
+	238.078503,
+	239.079395,
+	240.080606,
+	241.082136,
+	242.083985,
+	243.086154,
+	244.088643,
+	245.091452,
+	246.094581,
+	247.098031,
+	248.101802,
+	249.105895,
+	250.11031,
+	251.115046,
+	252.120105,
+	253.125486,
+	254.131191,
+	255.137218,
+	256.14357,
+	257.150245,
+	258.157244,
+	259.164568,
+	260.172217,
+	261.180191,
+	262.188491,
+	263.197116,
+	264.206067,
+	265.215345,
+	266.224949,
+	267.234881,
+	268.24514,
+	269.255727,
+	270.266641,
+	271.277884,
+	272.289456,
+	273.301356,
+	274.313586,
+	275.326146,
+	276.339035,
+	277.352255,
+	278.365805,
+	279.379687,
+	280.393899,
+	281.408443,
+	282.423319,
+	283.438527,
+	284.454068,
+	285.469941,
+	286.486148,
+	287.502688,
+	288.519562,
+	289.53677,
+	290.554313,
+	291.572191,
+	292.590404,
+	293.608952,
+	294.627836,
+	295.647056,
+	296.666613,
+	297.686506,
+	298.706737,
+	299.727305,
+	300.748211,
+	301.769456,
+	302.791038,
+	303.81296,
+	304.835221,
+	305.857821,
+	306.880761,
+	307.904041,
+	308.927662,
+	309.951624,
+	310.975927,
+	312.000571,
+	313.025558,
+	314.050886,
+	315.076558,
+	316.102572,
+	317.128929,
+	318.15563,
+	319.182675,
+	320.210065,
+	321.237799,
+	322.265878,
+	323.294302,
+	324.323072,
+	325.352188,
+	326.38165,
+	327.41146,
+	328.441616,
+	329.47212,
+	330.502971,
+	331.534171,
+	332.565719,
+	333.597616,
+	334.629862,
+	335.662458,
+	336.695404,
+	337.7287,
+	338.762347,
+	339.796344,
+	340.830693,
+	341.865394,
+	342.900447,
+	343.935852,
+	344.97161,
+	346.007721,
+	347.044186,
+	348.081004,
+	349.118177,
+	350.155705,
+	351.193587,
+	352.231825,
+	353.270418,
+	354.309367,
+	355.348673,
+	356.388336,
+	357.428356,
+	358.468733,
+	359.509468,
+	360.550562,
+	361.592014,
+	362.633825,
+	363.675995,
+	364.718525,
+	365.761416,
+	366.804667,
+	367.848278,
+	368.892251,
+	369.936586,
+	370.981283,
+	372.026342,
+	373.071763,
+	374.117548,
+	375.163696,
+	376.210209,
+	377.257085,
+	378.304326,
+	379.351933,
+	380.399904,
+	381.448242,
+	382.496945,
+	383.546015,
+	384.595452,
+	385.645257,
+	386.695429,
+	387.745969,
+	388.796878,
+	389.848155,
+	390.899802,
+	391.951819,
+	393.004205,
+	394.056962,
+	395.11009,
+	396.163589,
+	397.21746,
+	398.271703,
+	399.326318,
+	400.381306,
+	401.436667,
+	402.492401,
+	403.54851,
+	404.604993,
+	405.661851,
+	406.719084,
+	407.776692,
+	408.834677,
+	409.893038,
+	410.951775,
+	412.01089,
+	413.070383,
+	414.130253,
+	415.190502,
+	416.25113,
+	417.312137,
+	418.373523,
+	419.43529,
+	420.497437,
+	421.559965,
+	422.622874,
+	423.686165,
+	424.749837,
+	425.813893,
+	426.878331,
+	427.943153,
+	429.008358,
+	430.073947,
+	431.139921,
+	432.20628,
+	433.273024,
+	434.340155,
+	435.407671,
+	436.475574,
+	437.543864,
+	438.612542,
+	439.681607,
+	440.751061,
+	441.820904,
+	442.891136,
+	443.961757,
+	445.032768,
+	446.10417,
+	447.175963,
+	448.248147,
+	449.320723,
+	450.393691,
+	451.467052,
+	452.540806,
+	453.614953,
+	454.689494,
+	455.764429,
+	456.839759,
+	457.915485,
+	458.991606,
+	460.068123,
+	461.145037,
+	462.222347,
+	463.300055,
+	464.378161,
+	465.456665,
+	466.535568,
+	467.61487,
+	468.694571,
+	469.774673,
+	470.855175,
+	471.936078,
+	473.017383,
+	474.099089,
+	475.181198,
+	476.263709,
+	477.346623,
+	478.429941,
+	479.513664,
+	480.59779,
+	481.682322,
+	482.767259,
+	483.852602,
+	484.938352,
+	486.024508,
+	487.111071,
+	488.198043,
+	489.285422,
+	490.37321,
+	491.461407,
+	492.550014,
+	493.639031,
+	494.728458,
+	495.818296,
+	496.908546,
+	497.999207,
+	499.090281,
+	500.181768,
+	501.273668,
+	502.365982,
+	503.45871,
+	504.551853,
+	505.645411,
+	506.739384,
+	507.833774,
+	508.92858,
+	510.023803,
+	511.119444,
+	512.215503,
+	513.311981,
+	514.408877,
+	515.506193,
+	516.603929,
+	517.702086,
+	518.800663,
+	519.899662,
+	520.999082,
+	522.098925,
+	523.199191,
+	524.29988,
+	525.400993,
+	526.502531,
+	527.604493,
+	528.70688,
+	529.809694,
+	530.912933,
+	532.0166,
+	533.120693,
+	534.225215,
+	535.330165,
+	536.435543,
+	537.541351,
+	538.647589,
+	539.754257,
+	540.861355,
+	541.968885,
+	543.076847,
+	544.185241,
+	545.294068,
+	546.403328,
+	547.513022,
+	548.623151,
+	549.733714,
+	550.844713,
+	551.956147,
+	553.068018,
+	554.180326,
+	555.293071,
+	556.406254,
+	557.519875,
+	558.633936,
+	559.748436,
+	560.863376,
+	561.978756,
+	563.094578,
+	564.210841,
+	565.327546,
+	566.444694,
+	567.562285,
+	568.68032,
+	569.798799,
+	570.917722,
+	572.037091,
+	573.156906,
+	574.277167,
+	575.397875,
+	576.51903,
+	577.640634,
+	578.762685,
+	579.885186,
+	581.008136,
+	582.131537,
+	583.255388,
+	584.37969,
+	585.504444,
+	586.62965,
+	587.755309,
+	588.881421,
+	590.007987,
+	591.135008,
+	592.262484,
+	593.390415,
+	594.518803,
+	595.647647,
+	596.776948,
+	597.906707,
+	599.036924,
+	600.167601,
+	601.298736,
+	602.430332,
+	603.562388,
+	604.694906,
+	605.827885,
+	606.961326,
+	608.095231,
+	609.229598,
+	610.36443,
+	611.499726,
+	612.635487,
+	613.771714,
+	614.908407,
+	616.045567,
+	617.183195,
+	618.32129,
+	619.459854,
+	620.598887,
+	621.73839,
+	622.878363,
+	624.018807,
+	625.159723,
+	626.30111,
+	627.44297,
+	628.585304,
+	629.728111,
+	630.871393,
+	632.015149,
+	633.159381,
+	634.30409,
+	635.449275,
+	636.594938,
+	637.741078,
+	638.887697,
+	640.034795,
+	641.182373,
+	642.330432,
+	643.478971,
+	644.627992,
+	645.777495,
+	646.927481,
+	648.077951,
+	649.228904,
+	650.380342,
+	651.532265,
+	652.684674,
+	653.83757,
+	654.990952,
+	656.144823,
+	657.299181,
+	658.454029,
+	659.609366,
+	660.765193,
+	661.921512,
+	663.078321,
+	664.235623,
+	665.393417,
+	666.551705,
+	667.710487,
+	668.869763,
+	670.029534,
+	671.189802,
+	672.350565,
+	673.511826,
+	674.673585,
+	675.835842,
+	676.998598,
+	678.161854,
+	679.32561,
+	680.489868,
+	681.654626,
+	682.819888,
+	683.985652,
+	685.151919,
+	686.318691,
+	687.485968,
+	688.65375,
+	689.822039,
+	690.990834,
+	692.160137,
+	693.329948,
+	694.500268,
+	695.671097,
+	696.842437,
+	698.014288,
+	699.18665,
+	700.359524,
+	701.532911,
+	702.706811,
+	703.881226,
+	705.056156,
+	706.231601,
+	707.407563,
+	708.584041,
+	709.761037,
+	710.938551,
+	712.116585,
+	713.295138,
+	714.474211,
+	715.653805,
+	716.833921,
+	718.01456,
+	719.195722,
+	720.377407,
+	721.559617,
+	722.742352,
+	723.925613,
+	725.109401,
+	726.293716,
+	727.478559,
+	728.66393,
+	729.849832,
+	731.036263,
+	732.223225,
+	733.410719,
+	734.598745,
+	735.787304,
+	736.976397,
+	738.166024,
+	739.356186,
+	740.546885,
+	741.738119,
+	742.929892,
+	744.122202,
+	745.315051,
+	746.50844,
+	747.702368,
+	748.896838,
+	750.09185,
+	751.287404,
+	752.483501,
+	753.680142,
+	754.877328,
+	756.075059,
+	757.273337,
+	758.472161,
+	759.671533,
+	760.871454,
+	762.071924,
+	763.272943,
+	764.474514,
+	765.676635,
+	766.879309,
+	768.082536,
+	769.286317,
+	770.490652,
+	771.695543,
+	772.900989,
+	774.106992,
+	775.313553,
+	776.520672,
+	777.728351,
+	778.936589,
+	780.145388,
+	781.354748,
+	782.564671,
+	783.775157,
+	784.986206,
+	786.197821,
+	787.41,
+	788.622746,
+	789.836059,
+	791.049939,
+	792.264388,
+	793.479407,
+	794.694995,
+	795.911155,
+	797.127886,
+	798.34519,
+	799.563068,
+	800.78152,
+	802.000546,
+	803.220149,
+	804.440328,
+	805.661085,
+	806.88242,
+	808.104334,
+	809.326828,
+	810.549903,
+	811.773559,
+	812.997798,
+	814.22262,
+	815.448027,
+	816.674018,
+	817.900595,
+	819.127758,
+	820.355509,
+	821.583849,
+	822.812777,
+	824.042296,
+	825.272405,
+	826.503106,
+	827.7344,
+	828.966287,
+	830.198768,
+	831.431845,
+	832.665517,
+	833.899787,
+	835.134654,
+	836.370119,
+	837.606185,
+	838.84285,
+	840.080117,
+	841.317986,
+	842.556457,
+	843.795533,
+	845.035213,
+	846.275499,
+	847.516392,
+	848.757892,
+	850,
+};
+
+static const float gCurveTab1[1024] =
+{
+	-200,
+	-199.15869,
+	-198.316783,
+	-197.47428,
+	-196.631183,
+	-195.787493,
+	-194.943213,
+	-194.098345,
+	-193.25289,
+	-192.40685,
+	-191.560227,
+	-190.713024,
+	-189.865241,
+	-189.016881,
+	-188.167945,
+	-187.318436,
+	-186.468356,
+	-185.617706,
+	-184.766488,
+	-183.914704,
+	-183.062357,
+	-182.209447,
+	-181.355978,
+	-180.50195,
+	-179.647366,
+	-178.792228,
+	-177.936537,
+	-177.080296,
+	-176.223507,
+	-175.366171,
+	-174.508291,
+	-173.649868,
+	-172.790904,
+	-171.931402,
+	-171.071364,
+	-170.21079,
+	-169.349684,
+	-168.488047,
+	-167.625881,
+	-166.763188,
+	-165.899971,
+	-165.036231,
+	-164.171969,
+	-163.307189,
+	-162.441892,
+	-161.57608,
+	-160.709756,
+	-159.84292,
+	-158.975575,
+	-158.107723,
+	-157.239367,
+	-156.370507,
+	-155.501146,
+	-154.631286,
+	-153.76093,
+	-152.890078,
+	-152.018733,
+	-151.146897,
+	-150.274572,
+	-149.40176,
+	-148.528463,
+	-147.654683,
+	-146.780422,
+	-145.905681,
+	-145.030464,
+	-144.154771,
+	-143.278605,
+	-142.401968,
+	-141.524862,
+	-140.647289,
+	-139.76925,
+	-138.890748,
+	-138.011785,
+	-137.132362,
+	-136.252482,
+	-135.372147,
+	-134.491358,
+	-133.610118,
+	-132.728429,
+	-131.846291,
+	-130.963708,
+	-130.080682,
+	-129.197214,
+	-128.313306,
+	-127.42896,
+	-126.544178,
+	-125.658962,
+	-124.773315,
+	-123.887237,
+	-123.000731,
+	-122.113798,
+	-121.226442,
+	-120.338662,
+	-119.450463,
+	-118.561844,
+	-117.672809,
+	-116.783359,
+	-115.893495,
+	-115.003221,
+	-114.112538,
+	-113.221446,
+	-112.32995,
+	-111.43805,
+	-110.545747,
+	-109.653045,
+	-108.759945,
+	-107.866448,
+	-106.972557,
+	-106.078273,
+	-105.183598,
+	-104.288534,
+	-103.393083,
+	-102.497246,
+	-101.601025,
+	-100.704423,
+	-99.8074397,
+	-98.9100784,
+	-98.0123404,
+	-97.1142274,
+	-96.2157412,
+	-95.3168835,
+	-94.417656,
+	-93.5180604,
+	-92.6180984,
+	-91.7177717,
+	-90.8170821,
+	-89.9160311,
+	-89.0146204,
+	-88.1128518,
+	-87.2107268,
+	-86.3082471,
+	-85.4054143,
+	-84.50223,
+	-83.5986959,
+	-82.6948136,
+	-81.7905846,
+	-80.8860105,
+	-79.9810929,
+	-79.0758334,
+	-78.1702336,
+	-77.2642948,
+	-76.3580188,
+	-75.451407,
+	-74.5444609,
+	-73.637182,
+	-72.7295718,
+	-71.8216318,
+	-70.9133635,
+	-70.0047683,
+	-69.0958477,
+	-68.186603,
+	-67.2770358,
+	-66.3671474,
+	-65.4569392,
+	-64.5464127,
+	-63.6355691,
+	-62.7244098,
+	-61.8129363,
+	-60.9011498,
+	-59.9890517,
+	-59.0766433,
+	-58.1639259,
+	-57.2509007,
+	-56.3375691,
+	-55.4239323,
+	-54.5099916,
+	-53.5957482,
+	-52.6812033,
+	-51.7663581,
+	-50.851214,
+	-49.9357719,
+	-49.0200331,
+	-48.1039988,
+	-47.1876701,
+	-46.2710482,
+	-45.3541341,
+	-44.436929,
+	-43.5194339,
+	-42.6016499,
+	-41.6835781,
+	-40.7652196,
+	-39.8465753,
+	-38.9276463,
+	-38.0084336,
+	-37.0889382,
+	-36.169161,
+	-35.2491031,
+	-34.3287653,
+	-33.4081486,
+	-32.4872539,
+	-31.5660821,
+	-30.644634,
+	-29.7229107,
+	-28.8009128,
+	-27.8786413,
+	-26.956097,
+	-26.0332806,
+	-25.1101931,
+	-24.186835,
+	-23.2632073,
+	-22.3393106,
+	-21.4151457,
+	-20.4907133,
+	-19.566014,
+	-18.6410486,
+	-17.7158178,
+	-16.7903221,
+	-15.8645622,
+	-14.9385387,
+	-14.0122522,
+	-13.0857033,
+	-12.1588925,
+	-11.2318204,
+	-10.3044876,
+	-9.37689448,
+	-8.44904158,
+	-7.52092938,
+	-6.59255834,
+	-5.6639289,
+	-4.73504148,
+	-3.80589649,
+	-2.87649432,
+	-1.94683533,
+	-1.01691989,
+	-0.0867483226,
+	0.843679116,
+	1.77436252,
+	2.70530211,
+	3.63649809,
+	4.56795067,
+	5.49966007,
+	6.4316265,
+	7.36385017,
+	8.29633129,
+	9.22907009,
+	10.1620668,
+	11.0953215,
+	12.0288346,
+	12.9626062,
+	13.8966366,
+	14.8309258,
+	15.7654743,
+	16.7002822,
+	17.6353496,
+	18.5706769,
+	19.5062642,
+	20.4421118,
+	21.3782198,
+	22.3145885,
+	23.2512181,
+	24.1881089,
+	25.125261,
+	26.0626746,
+	27.00035,
+	27.9382875,
+	28.8764871,
+	29.8149492,
+	30.7536739,
+	31.6926616,
+	32.6319123,
+	33.5714263,
+	34.5112039,
+	35.4512453,
+	36.3915506,
+	37.3321202,
+	38.2729542,
+	39.2140528,
+	40.1554163,
+	41.097045,
+	42.0389389,
+	42.9810984,
+	43.9235237,
+	44.866215,
+	45.8091725,
+	46.7523965,
+	47.6958871,
+	48.6396447,
+	49.5836694,
+	50.5279614,
+	51.472521,
+	52.4173485,
+	53.362444,
+	54.3078077,
+	55.25344,
+	56.1993409,
+	57.1455109,
+	58.09195,
+	59.0386585,
+	59.9856367,
+	60.9328848,
+	61.8804029,
+	62.8281915,
+	63.7762505,
+	64.7245804,
+	65.6731813,
+	66.6220535,
+	67.5711972,
+	68.5206126,
+	69.4703,
+	70.4202596,
+	71.3704916,
+	72.3209963,
+	73.2717739,
+	74.2228246,
+	75.1741487,
+	76.1257464,
+	77.077618,
+	78.0297636,
+	78.9821836,
+	79.9348781,
+	80.8878474,
+	81.8410918,
+	82.7946114,
+	83.7484065,
+	84.7024774,
+	85.6568243,
+	86.6114474,
+	87.566347,
+	88.5215232,
+	89.4769765,
+	90.4327069,
+	91.3887147,
+	92.3450002,
+	93.3015637,
+	94.2584053,
+	95.2155252,
+	96.1729239,
+	97.1306014,
+	98.0885581,
+	99.0467941,
+	100.00531,
+	100.964105,
+	101.923181,
+	102.882537,
+	103.842173,
+	104.802091,
+	105.762289,
+	106.722769,
+	107.683531,
+	108.644574,
+	109.605899,
+	110.567507,
+	111.529397,
+	112.49157,
+	113.454027,
+	114.416766,
+	115.379789,
+	116.343096,
+	117.306687,
+	118.270563,
+	119.234723,
+	120.199167,
+	121.163897,
+	122.128913,
+	123.094213,
+	124.0598,
+	125.025673,
+	125.991832,
+	126.958278,
+	127.92501,
+	128.89203,
+	129.859337,
+	130.826932,
+	131.794815,
+	132.762986,
+	133.731445,
+	134.700193,
+	135.66923,
+	136.638556,
+	137.608171,
+	138.578076,
+	139.548271,
+	140.518757,
+	141.489532,
+	142.460599,
+	143.431957,
+	144.403605,
+	145.375546,
+	146.347778,
+	147.320302,
+	148.293119,
+	149.266228,
+	150.23963,
+	151.213325,
+	152.187313,
+	153.161596,
+	154.136172,
+	155.111042,
+	156.086206,
+	157.061666,
+	158.03742,
+	159.01347,
+	159.989815,
+	160.966456,
+	161.943392,
+	162.920626,
+	163.898155,
+	164.875982,
+	165.854106,
+	166.832527,
+	167.811246,
+	168.790263,
+	169.769578,
+	170.749191,
+	171.729104,
+	172.709315,
+	173.689825,
+	174.670636,
+	175.651746,
+	176.633156,
+	177.614866,
+	178.596878,
+	179.57919,
+	180.561803,
+	181.544718,
+	182.527935,
+	183.511454,
+	184.495275,
+	185.479399,
+	186.463826,
+	187.448556,
+	188.433589,
+	189.418926,
+	190.404567,
+	191.390513,
+	192.376763,
+	193.363318,
+	194.350178,
+	195.337343,
+	196.324815,
+	197.312592,
+	198.300675,
+	199.289066,
+	200.277763,
+	201.266767,
+	202.256078,
+	203.245698,
+	204.235625,
+	205.225861,
+	206.216405,
+	207.207258,
+	208.19842,
+	209.189892,
+	210.181673,
+	211.173765,
+	212.166167,
+	213.158879,
+	214.151903,
+	215.145237,
+	216.138883,
+	217.132841,
+	218.127111,
+	219.121693,
+	220.116588,
+	221.111796,
+	222.107317,
+	223.103152,
+	224.099301,
+	225.095763,
+	226.092541,
+	227.089633,
+	228.08704,
+	229.084762,
+	230.0828,
+	231.081154,
+	232.079824,
+	233.078811,
+	234.078114,
+	235.077735,
+	236.077673,
+	237.077929,
+	238.078503,
+	239.079395,
+	240.080606,
+	241.082136,
+	242.083985,
+	243.086154,
+	244.088643,
+	245.091452,
+	246.094581,
+	247.098031,
+	248.101802,
+	249.105895,
+	250.11031,
+	251.115046,
+	252.120105,
+	253.125486,
+	254.131191,
+	255.137218,
+	256.14357,
+	257.150245,
+	258.157244,
+	259.164568,
+	260.172217,
+	261.180191,
+	262.188491,
+	263.197116,
+	264.206067,
+	265.215345,
+	266.224949,
+	267.234881,
+	268.24514,
+	269.255727,
+	270.266641,
+	271.277884,
+	272.289456,
+	273.301356,
+	274.313586,
+	275.326146,
+	276.339035,
+	277.352255,
+	278.365805,
+	279.379687,
+	280.393899,
+	281.408443,
+	282.423319,
+	283.438527,
+	284.454068,
+	285.469941,
+	286.486148,
+	287.502688,
+	288.519562,
+	289.53677,
+	290.554313,
+	291.572191,
+	292.590404,
+	293.608952,
+	294.627836,
+	295.647056,
+	296.666613,
+	297.686506,
+	298.706737,
+	299.727305,
+	300.748211,
+	301.769456,
+	302.791038,
+	303.81296,
+	304.835221,
+	305.857821,
+	306.880761,
+	307.904041,
+	308.927662,
+	309.951624,
+	310.975927,
+	312.000571,
+	313.025558,
+	314.050886,
+	315.076558,
+	316.102572,
+	317.128929,
+	318.15563,
+	319.182675,
+	320.210065,
+	321.237799,
+	322.265878,
+	323.294302,
+	324.323072,
+	325.352188,
+	326.38165,
+	327.41146,
+	328.441616,
+	329.47212,
+	330.502971,
+	331.534171,
+	332.565719,
+	333.597616,
+	334.629862,
+	335.662458,
+	336.695404,
+	337.7287,
+	338.762347,
+	339.796344,
+	340.830693,
+	341.865394,
+	342.900447,
+	343.935852,
+	344.97161,
+	346.007721,
+	347.044186,
+	348.081004,
+	349.118177,
+	350.155705,
+	351.193587,
+	352.231825,
+	353.270418,
+	354.309367,
+	355.348673,
+	356.388336,
+	357.428356,
+	358.468733,
+	359.509468,
+	360.550562,
+	361.592014,
+	362.633825,
+	363.675995,
+	364.718525,
+	365.761416,
+	366.804667,
+	367.848278,
+	368.892251,
+	369.936586,
+	370.981283,
+	372.026342,
+	373.071763,
+	374.117548,
+	375.163696,
+	376.210209,
+	377.257085,
+	378.304326,
+	379.351933,
+	380.399904,
+	381.448242,
+	382.496945,
+	383.546015,
+	384.595452,
+	385.645257,
+	386.695429,
+	387.745969,
+	388.796878,
+	389.848155,
+	390.899802,
+	391.951819,
+	393.004205,
+	394.056962,
+	395.11009,
+	396.163589,
+	397.21746,
+	398.271703,
+	399.326318,
+	400.381306,
+	401.436667,
+	402.492401,
+	403.54851,
+	404.604993,
+	405.661851,
+	406.719084,
+	407.776692,
+	408.834677,
+	409.893038,
+	410.951775,
+	412.01089,
+	413.070383,
+	414.130253,
+	415.190502,
+	416.25113,
+	417.312137,
+	418.373523,
+	419.43529,
+	420.497437,
+	421.559965,
+	422.622874,
+	423.686165,
+	424.749837,
+	425.813893,
+	426.878331,
+	427.943153,
+	429.008358,
+	430.073947,
+	431.139921,
+	432.20628,
+	433.273024,
+	434.340155,
+	435.407671,
+	436.475574,
+	437.543864,
+	438.612542,
+	439.681607,
+	440.751061,
+	441.820904,
+	442.891136,
+	443.961757,
+	445.032768,
+	446.10417,
+	447.175963,
+	448.248147,
+	449.320723,
+	450.393691,
+	451.467052,
+	452.540806,
+	453.614953,
+	454.689494,
+	455.764429,
+	456.839759,
+	457.915485,
+	458.991606,
+	460.068123,
+	461.145037,
+	462.222347,
+	463.300055,
+	464.378161,
+	465.456665,
+	466.535568,
+	467.61487,
+	468.694571,
+	469.774673,
+	470.855175,
+	471.936078,
+	473.017383,
+	474.099089,
+	475.181198,
+	476.263709,
+	477.346623,
+	478.429941,
+	479.513664,
+	480.59779,
+	481.682322,
+	482.767259,
+	483.852602,
+	484.938352,
+	486.024508,
+	487.111071,
+	488.198043,
+	489.285422,
+	490.37321,
+	491.461407,
+	492.550014,
+	493.639031,
+	494.728458,
+	495.818296,
+	496.908546,
+	497.999207,
+	499.090281,
+	500.181768,
+	501.273668,
+	502.365982,
+	503.45871,
+	504.551853,
+	505.645411,
+	506.739384,
+	507.833774,
+	508.92858,
+	510.023803,
+	511.119444,
+	512.215503,
+	513.311981,
+	514.408877,
+	515.506193,
+	516.603929,
+	517.702086,
+	518.800663,
+	519.899662,
+	520.999082,
+	522.098925,
+	523.199191,
+	524.29988,
+	525.400993,
+	526.502531,
+	527.604493,
+	528.70688,
+	529.809694,
+	530.912933,
+	532.0166,
+	533.120693,
+	534.225215,
+	535.330165,
+	536.435543,
+	537.541351,
+	538.647589,
+	539.754257,
+	540.861355,
+	541.968885,
+	543.076847,
+	544.185241,
+	545.294068,
+	546.403328,
+	547.513022,
+	548.623151,
+	549.733714,
+	550.844713,
+	551.956147,
+	553.068018,
+	554.180326,
+	555.293071,
+	556.406254,
+	557.519875,
+	558.633936,
+	559.748436,
+	560.863376,
+	561.978756,
+	563.094578,
+	564.210841,
+	565.327546,
+	566.444694,
+	567.562285,
+	568.68032,
+	569.798799,
+	570.917722,
+	572.037091,
+	573.156906,
+	574.277167,
+	575.397875,
+	576.51903,
+	577.640634,
+	578.762685,
+	579.885186,
+	581.008136,
+	582.131537,
+	583.255388,
+	584.37969,
+	585.504444,
+	586.62965,
+	587.755309,
+	588.881421,
+	590.007987,
+	591.135008,
+	592.262484,
+	593.390415,
+	594.518803,
+	595.647647,
+	596.776948,
+	597.906707,
+	599.036924,
+	600.167601,
+	601.298736,
+	602.430332,
+	603.562388,
+	604.694906,
+	605.827885,
+	606.961326,
+	608.095231,
+	609.229598,
+	610.36443,
+	611.499726,
+	612.635487,
+	613.771714,
+	614.908407,
+	616.045567,
+	617.183195,
+	618.32129,
+	619.459854,
+	620.598887,
+	621.73839,
+	622.878363,
+	624.018807,
+	625.159723,
+	626.30111,
+	627.44297,
+	628.585304,
+	629.728111,
+	630.871393,
+	632.015149,
+	633.159381,
+	634.30409,
+	635.449275,
+	636.594938,
+	637.741078,
+	638.887697,
+	640.034795,
+	641.182373,
+	642.330432,
+	643.478971,
+	644.627992,
+	645.777495,
+	646.927481,
+	648.077951,
+	649.228904,
+	650.380342,
+	651.532265,
+	652.684674,
+	653.83757,
+	654.990952,
+	656.144823,
+	657.299181,
+	658.454029,
+	659.609366,
+	660.765193,
+	661.921512,
+	663.078321,
+	664.235623,
+	665.393417,
+	666.551705,
+	667.710487,
+	668.869763,
+	670.029534,
+	671.189802,
+	672.350565,
+	673.511826,
+	674.673585,
+	675.835842,
+	676.998598,
+	678.161854,
+	679.32561,
+	680.489868,
+	681.654626,
+	682.819888,
+	683.985652,
+	685.151919,
+	686.318691,
+	687.485968,
+	688.65375,
+	689.822039,
+	690.990834,
+	692.160137,
+	693.329948,
+	694.500268,
+	695.671097,
+	696.842437,
+	698.014288,
+	699.18665,
+	700.359524,
+	701.532911,
+	702.706811,
+	703.881226,
+	705.056156,
+	706.231601,
+	707.407563,
+	708.584041,
+	709.761037,
+	710.938551,
+	712.116585,
+	713.295138,
+	714.474211,
+	715.653805,
+	716.833921,
+	718.01456,
+	719.195722,
+	720.377407,
+	721.559617,
+	722.742352,
+	723.925613,
+	725.109401,
+	726.293716,
+	727.478559,
+	728.66393,
+	729.849832,
+	731.036263,
+	732.223225,
+	733.410719,
+	734.598745,
+	735.787304,
+	736.976397,
+	738.166024,
+	739.356186,
+	740.546885,
+	741.738119,
+	742.929892,
+	744.122202,
+	745.315051,
+	746.50844,
+	747.702368,
+	748.896838,
+	750.09185,
+	751.287404,
+	752.483501,
+	753.680142,
+	754.877328,
+	756.075059,
+	757.273337,
+	758.472161,
+	759.671533,
+	760.871454,
+	762.071924,
+	763.272943,
+	764.474514,
+	765.676635,
+	766.879309,
+	768.082536,
+	769.286317,
+	770.490652,
+	771.695543,
+	772.900989,
+	774.106992,
+	775.313553,
+	776.520672,
+	777.728351,
+	778.936589,
+	780.145388,
+	781.354748,
+	782.564671,
+	783.775157,
+	784.986206,
+	786.197821,
+	787.41,
+	788.622746,
+	789.836059,
+	791.049939,
+	792.264388,
+	793.479407,
+	794.694995,
+	795.911155,
+	797.127886,
+	798.34519,
+	799.563068,
+	800.78152,
+	802.000546,
+	803.220149,
+	804.440328,
+	805.661085,
+	806.88242,
+	808.104334,
+	809.326828,
+	810.549903,
+	811.773559,
+	812.997798,
+	814.22262,
+	815.448027,
+	816.674018,
+	817.900595,
+	819.127758,
+	820.355509,
+	821.583849,
+	822.812777,
+	824.042296,
+	825.272405,
+	826.503106,
+	827.7344,
+	828.966287,
+	830.198768,
+	831.431845,
+	832.665517,
+	833.899787,
+	835.134654,
+	836.370119,
+	837.606185,
+	838.84285,
+	840.080117,
+	841.317986,
+	842.556457,
+	843.795533,
+	845.035213,
+	846.275499,
+	847.516392,
+	848.757892,
+	850,
+};
+
+static const float gCurveTab2[1024] =
+{
+	-60,
+	-59.6780879,
+	-59.3564971,
+	-59.0352265,
+	-58.7142749,
+	-58.393641,
+	-58.0733236,
+	-57.7533214,
+	-57.4336334,
+	-57.1142583,
+	-56.7951948,
+	-56.476442,
+	-56.1579985,
+	-55.8398633,
+	-55.5220351,
+	-55.2045129,
+	-54.8872955,
+	-54.5703818,
+	-54.2537707,
+	-53.9374611,
+	-53.6214518,
+	-53.3057418,
+	-52.9903301,
+	-52.6752154,
+	-52.3603968,
+	-52.0458732,
+	-51.7316435,
+	-51.4177067,
+	-51.1040618,
+	-50.7907077,
+	-50.4776434,
+	-50.1648679,
+	-49.8523801,
+	-49.5401791,
+	-49.2282639,
+	-48.9166334,
+	-48.6052868,
+	-48.2942229,
+	-47.9834409,
+	-47.6729398,
+	-47.3627186,
+	-47.0527763,
+	-46.7431121,
+	-46.433725,
+	-46.1246141,
+	-45.8157784,
+	-45.507217,
+	-45.198929,
+	-44.8909134,
+	-44.5831695,
+	-44.2756963,
+	-43.9684929,
+	-43.6615584,
+	-43.3548919,
+	-43.0484926,
+	-42.7423597,
+	-42.4364921,
+	-42.1308892,
+	-41.82555,
+	-41.5204737,
+	-41.2156595,
+	-40.9111065,
+	-40.6068139,
+	-40.3027809,
+	-39.9990066,
+	-39.6954903,
+	-39.3922311,
+	-39.0892283,
+	-38.786481,
+	-38.4839885,
+	-38.1817499,
+	-37.8797645,
+	-37.5780316,
+	-37.2765503,
+	-36.9753198,
+	-36.6743395,
+	-36.3736085,
+	-36.0731261,
+	-35.7728916,
+	-35.4729043,
+	-35.1731632,
+	-34.8736679,
+	-34.5744174,
+	-34.2754112,
+	-33.9766484,
+	-33.6781284,
+	-33.3798504,
+	-33.0818138,
+	-32.7840178,
+	-32.4864617,
+	-32.189145,
+	-31.8920667,
+	-31.5952264,
+	-31.2986232,
+	-31.0022566,
+	-30.7061258,
+	-30.4102302,
+	-30.1145691,
+	-29.8191419,
+	-29.5239479,
+	-29.2289864,
+	-28.9342568,
+	-28.6397585,
+	-28.3454908,
+	-28.0514531,
+	-27.7576447,
+	-27.4640651,
+	-27.1707135,
+	-26.8775894,
+	-26.5846922,
+	-26.2920212,
+	-25.9995759,
+	-25.7073556,
+	-25.4153597,
+	-25.1235876,
+	-24.8320388,
+	-24.5407126,
+	-24.2496085,
+	-23.9587258,
+	-23.668064,
+	-23.3776225,
+	-23.0874007,
+	-22.7973981,
+	-22.5076141,
+	-22.2180481,
+	-21.9286996,
+	-21.639568,
+	-21.3506527,
+	-21.0619532,
+	-20.773469,
+	-20.4851995,
+	-20.1971441,
+	-19.9093024,
+	-19.6216737,
+	-19.3342576,
+	-19.0470536,
+	-18.760061,
+	-18.4732794,
+	-18.1867082,
+	-17.900347,
+	-17.6141952,
+	-17.3282523,
+	-17.0425178,
+	-16.7569912,
+	-16.471672,
+	-16.1865597,
+	-15.9016537,
+	-15.6169537,
+	-15.3324591,
+	-15.0481693,
+	-14.764084,
+	-14.4802027,
+	-14.1965248,
+	-13.9130499,
+	-13.6297775,
+	-13.3467072,
+	-13.0638384,
+	-12.7811707,
+	-12.4987036,
+	-12.2164367,
+	-11.9343696,
+	-11.6525016,
+	-11.3708325,
+	-11.0893617,
+	-10.8080889,
+	-10.5270134,
+	-10.246135,
+	-9.96545311,
+	-9.68496736,
+	-9.40467729,
+	-9.12458246,
+	-8.84468246,
+	-8.56497683,
+	-8.28546516,
+	-8.00614702,
+	-7.72702199,
+	-7.44808964,
+	-7.16934955,
+	-6.89080132,
+	-6.61244452,
+	-6.33427874,
+	-6.05630358,
+	-5.77851861,
+	-5.50092345,
+	-5.22351768,
+	-4.94630091,
+	-4.66927273,
+	-4.39243274,
+	-4.11578056,
+	-3.83931579,
+	-3.56303804,
+	-3.28694692,
+	-3.01104204,
+	-2.73532302,
+	-2.45978948,
+	-2.18444103,
+	-1.9092773,
+	-1.63429791,
+	-1.35950249,
+	-1.08489066,
+	-0.810462058,
+	-0.536216309,
+	-0.262153047,
+	0.0117280917,
+	0.28542747,
+	0.558945449,
+	0.832282389,
+	1.10543864,
+	1.37841457,
+	1.65121053,
+	1.92382686,
+	2.19626392,
+	2.46852206,
+	2.74060162,
+	3.01250295,
+	3.28422638,
+	3.55577227,
+	3.82714095,
+	4.09833275,
+	4.36934802,
+	4.64018708,
+	4.91085028,
+	5.18133793,
+	5.45165038,
+	5.72178794,
+	5.99175095,
+	6.26153972,
+	6.53115458,
+	6.80059585,
+	7.06986384,
+	7.33895889,
+	7.6078813,
+	7.87663138,
+	8.14520945,
+	8.41361583,
+	8.68185081,
+	8.94991471,
+	9.21780784,
+	9.4855305,
+	9.75308299,
+	10.0204656,
+	10.2876787,
+	10.5547225,
+	10.8215973,
+	11.0883035,
+	11.3548413,
+	11.621211,
+	11.8874129,
+	12.1534473,
+	12.4193145,
+	12.6850147,
+	12.9505484,
+	13.2159156,
+	13.4811169,
+	13.7461523,
+	14.0110222,
+	14.2757269,
+	14.5402666,
+	14.8046416,
+	15.0688523,
+	15.3328988,
+	15.5967815,
+	15.8605006,
+	16.1240563,
+	16.3874491,
+	16.650679,
+	16.9137465,
+	17.1766516,
+	17.4393949,
+	17.7019763,
+	17.9643964,
+	18.2266552,
+	18.4887531,
+	18.7506903,
+	19.0124671,
+	19.2740837,
+	19.5355404,
+	19.7968374,
+	20.057975,
+	20.3189534,
+	20.5797729,
+	20.8404337,
+	21.1009362,
+	21.3612804,
+	21.6214667,
+	21.8814953,
+	22.1413665,
+	22.4010804,
+	22.6606374,
+	22.9200377,
+	23.1792814,
+	23.4383689,
+	23.6973004,
+	23.9560761,
+	24.2146963,
+	24.4731611,
+	24.7314708,
+	24.9896257,
+	25.2476259,
+	25.5054718,
+	25.7631634,
+	26.0207012,
+	26.2780851,
+	26.5353156,
+	26.7923928,
+	27.049317,
+	27.3060883,
+	27.562707,
+	27.8191733,
+	28.0754874,
+	28.3316495,
+	28.5876599,
+	28.8435188,
+	29.0992263,
+	29.3547827,
+	29.6101883,
+	29.8654431,
+	30.1205475,
+	30.3755016,
+	30.6303057,
+	30.8849599,
+	31.1394644,
+	31.3938196,
+	31.6480255,
+	31.9020823,
+	32.1559904,
+	32.4097498,
+	32.6633608,
+	32.9168235,
+	33.1701383,
+	33.4233052,
+	33.6763245,
+	33.9291963,
+	34.181921,
+	34.4344985,
+	34.6869293,
+	34.9392133,
+	35.191351,
+	35.4433423,
+	35.6951876,
+	35.946887,
+	36.1984406,
+	36.4498488,
+	36.7011116,
+	36.9522294,
+	37.2032021,
+	37.4540301,
+	37.7047135,
+	37.9552525,
+	38.2056473,
+	38.4558981,
+	38.706005,
+	38.9559683,
+	39.205788,
+	39.4554645,
+	39.7049978,
+	39.9543881,
+	40.2036357,
+	40.4527407,
+	40.7017032,
+	40.9505235,
+	41.1992017,
+	41.4477381,
+	41.6961326,
+	41.9443857,
+	42.1924973,
+	42.4404677,
+	42.688297,
+	42.9359855,
+	43.1835333,
+	43.4309405,
+	43.6782073,
+	43.925334,
+	44.1723206,
+	44.4191673,
+	44.6658743,
+	44.9124417,
+	45.1588697,
+	45.4051586,
+	45.6513083,
+	45.8973192,
+	46.1431913,
+	46.3889248,
+	46.6345199,
+	46.8799767,
+	47.1252954,
+	47.3704762,
+	47.6155191,
+	47.8604245,
+	48.1051923,
+	48.3498228,
+	48.5943162,
+	48.8386725,
+	49.082892,
+	49.3269747,
+	49.5709209,
+	49.8147307,
+	50.0584042,
+	50.3019416,
+	50.545343,
+	50.7886086,
+	51.0317386,
+	51.274733,
+	51.5175921,
+	51.7603159,
+	52.0029047,
+	52.2453585,
+	52.4876776,
+	52.729862,
+	52.9719119,
+	53.2138274,
+	53.4556088,
+	53.6972561,
+	53.9387694,
+	54.180149,
+	54.4213949,
+	54.6625073,
+	54.9034864,
+	55.1443322,
+	55.385045,
+	55.6256248,
+	55.8660718,
+	56.1063861,
+	56.3465679,
+	56.5866172,
+	56.8265343,
+	57.0663193,
+	57.3059723,
+	57.5454935,
+	57.7848829,
+	58.0241407,
+	58.263267,
+	58.502262,
+	58.7411259,
+	58.9798586,
+	59.2184605,
+	59.4569315,
+	59.6952718,
+	59.9334817,
+	60.1715611,
+	60.4095102,
+	60.6473291,
+	60.8850181,
+	61.1225771,
+	61.3600063,
+	61.5973059,
+	61.834476,
+	62.0715167,
+	62.3084281,
+	62.5452104,
+	62.7818636,
+	63.018388,
+	63.2547836,
+	63.4910505,
+	63.7271889,
+	63.9631989,
+	64.1990806,
+	64.4348341,
+	64.6704596,
+	64.9059572,
+	65.141327,
+	65.376569,
+	65.6116836,
+	65.8466707,
+	66.0815304,
+	66.316263,
+	66.5508685,
+	66.785347,
+	67.0196986,
+	67.2539235,
+	67.4880218,
+	67.7219936,
+	67.955839,
+	68.1895582,
+	68.4231511,
+	68.6566181,
+	68.8899591,
+	69.1231743,
+	69.3562638,
+	69.5892276,
+	69.8220661,
+	70.0547791,
+	70.2873669,
+	70.5198296,
+	70.7521672,
+	70.98438,
+	71.2164679,
+	71.4484311,
+	71.6802697,
+	71.9119839,
+	72.1435737,
+	72.3750392,
+	72.6063806,
+	72.8375979,
+	73.0686914,
+	73.2996609,
+	73.5305068,
+	73.7612291,
+	73.9918278,
+	74.2223032,
+	74.4526552,
+	74.6828841,
+	74.9129899,
+	75.1429727,
+	75.3728327,
+	75.6025699,
+	75.8321844,
+	76.0616764,
+	76.2910459,
+	76.5202931,
+	76.749418,
+	76.9784208,
+	77.2073015,
+	77.4360603,
+	77.6646973,
+	77.8932125,
+	78.1216061,
+	78.3498781,
+	78.5780288,
+	78.8060581,
+	79.0339661,
+	79.2617531,
+	79.489419,
+	79.7169639,
+	79.9443881,
+	80.1716915,
+	80.3988742,
+	80.6259364,
+	80.8528782,
+	81.0796997,
+	81.3064009,
+	81.5329819,
+	81.7594429,
+	81.985784,
+	82.2120052,
+	82.4381066,
+	82.6640884,
+	82.8899506,
+	83.1156933,
+	83.3413167,
+	83.5668207,
+	83.7922056,
+	84.0174714,
+	84.2426182,
+	84.4676461,
+	84.6925552,
+	84.9173455,
+	85.1420173,
+	85.3665705,
+	85.5910052,
+	85.8153217,
+	86.0395198,
+	86.2635998,
+	86.4875618,
+	86.7114058,
+	86.9351318,
+	87.1587401,
+	87.3822307,
+	87.6056037,
+	87.8288591,
+	88.0519971,
+	88.2750178,
+	88.4979213,
+	88.7207075,
+	88.9433767,
+	89.1659289,
+	89.3883643,
+	89.6106828,
+	89.8328846,
+	90.0549698,
+	90.2769384,
+	90.4987906,
+	90.7205264,
+	90.942146,
+	91.1636493,
+	91.3850366,
+	91.6063079,
+	91.8274632,
+	92.0485027,
+	92.2694264,
+	92.4902345,
+	92.710927,
+	92.931504,
+	93.1519656,
+	93.3723119,
+	93.5925429,
+	93.8126588,
+	94.0326596,
+	94.2525455,
+	94.4723164,
+	94.6919725,
+	94.9115139,
+	95.1309407,
+	95.3502529,
+	95.5694506,
+	95.7885339,
+	96.007503,
+	96.2263578,
+	96.4450984,
+	96.663725,
+	96.8822376,
+	97.1006364,
+	97.3189213,
+	97.5370925,
+	97.75515,
+	97.973094,
+	98.1909245,
+	98.4086416,
+	98.6262454,
+	98.8437359,
+	99.0611133,
+	99.2783776,
+	99.4955289,
+	99.7125673,
+	99.9294928,
+	100.146306,
+	100.363006,
+	100.579593,
+	100.796068,
+	101.012431,
+	101.228681,
+	101.444819,
+	101.660845,
+	101.876758,
+	102.09256,
+	102.30825,
+	102.523827,
+	102.739293,
+	102.954648,
+	103.16989,
+	103.385021,
+	103.600041,
+	103.814949,
+	104.029746,
+	104.244431,
+	104.459006,
+	104.673469,
+	104.887821,
+	105.102063,
+	105.316193,
+	105.530213,
+	105.744122,
+	105.95792,
+	106.171608,
+	106.385185,
+	106.598652,
+	106.812008,
+	107.025254,
+	107.238391,
+	107.451416,
+	107.664332,
+	107.877138,
+	108.089834,
+	108.302421,
+	108.514897,
+	108.727264,
+	108.939522,
+	109.151669,
+	109.363708,
+	109.575637,
+	109.787457,
+	109.999167,
+	110.210769,
+	110.422261,
+	110.633644,
+	110.844919,
+	111.056084,
+	111.267141,
+	111.478089,
+	111.688929,
+	111.89966,
+	112.110283,
+	112.320797,
+	112.531203,
+	112.7415,
+	112.95169,
+	113.161771,
+	113.371744,
+	113.581609,
+	113.791367,
+	114.001016,
+	114.210558,
+	114.419992,
+	114.629319,
+	114.838538,
+	115.04765,
+	115.256654,
+	115.465551,
+	115.674341,
+	115.883023,
+	116.091598,
+	116.300067,
+	116.508428,
+	116.716683,
+	116.92483,
+	117.132871,
+	117.340806,
+	117.548633,
+	117.756355,
+	117.963969,
+	118.171478,
+	118.37888,
+	118.586175,
+	118.793365,
+	119.000448,
+	119.207426,
+	119.414297,
+	119.621063,
+	119.827722,
+	120.034276,
+	120.240725,
+	120.447067,
+	120.653304,
+	120.859436,
+	121.065462,
+	121.271383,
+	121.477199,
+	121.682909,
+	121.888514,
+	122.094014,
+	122.299409,
+	122.5047,
+	122.709885,
+	122.914965,
+	123.119941,
+	123.324812,
+	123.529579,
+	123.734241,
+	123.938799,
+	124.143252,
+	124.347601,
+	124.551845,
+	124.755986,
+	124.960022,
+	125.163955,
+	125.367783,
+	125.571507,
+	125.775128,
+	125.978645,
+	126.182058,
+	126.385367,
+	126.588573,
+	126.791675,
+	126.994674,
+	127.19757,
+	127.400362,
+	127.603051,
+	127.805637,
+	128.008119,
+	128.210499,
+	128.412776,
+	128.61495,
+	128.817021,
+	129.018989,
+	129.220854,
+	129.422617,
+	129.624277,
+	129.825835,
+	130.02729,
+	130.228643,
+	130.429894,
+	130.631042,
+	130.832088,
+	131.033032,
+	131.233874,
+	131.434614,
+	131.635252,
+	131.835789,
+	132.036223,
+	132.236556,
+	132.436787,
+	132.636917,
+	132.836945,
+	133.036871,
+	133.236696,
+	133.43642,
+	133.636043,
+	133.835564,
+	134.034984,
+	134.234303,
+	134.433521,
+	134.632639,
+	134.831655,
+	135.03057,
+	135.229385,
+	135.428099,
+	135.626713,
+	135.825226,
+	136.023638,
+	136.22195,
+	136.420162,
+	136.618273,
+	136.816284,
+	137.014195,
+	137.212006,
+	137.409717,
+	137.607328,
+	137.804838,
+	138.00225,
+	138.199561,
+	138.396772,
+	138.593884,
+	138.790897,
+	138.98781,
+	139.184623,
+	139.381337,
+	139.577951,
+	139.774467,
+	139.970883,
+	140.1672,
+	140.363418,
+	140.559537,
+	140.755557,
+	140.951478,
+	141.1473,
+	141.343023,
+	141.538648,
+	141.734174,
+	141.929602,
+	142.124931,
+	142.320161,
+	142.515293,
+	142.710327,
+	142.905263,
+	143.1001,
+	143.294839,
+	143.489481,
+	143.684024,
+	143.878469,
+	144.072816,
+	144.267066,
+	144.461217,
+	144.655271,
+	144.849228,
+	145.043087,
+	145.236848,
+	145.430512,
+	145.624078,
+	145.817547,
+	146.010919,
+	146.204194,
+	146.397372,
+	146.590452,
+	146.783436,
+	146.976322,
+	147.169112,
+	147.361804,
+	147.5544,
+	147.7469,
+	147.939302,
+	148.131609,
+	148.323818,
+	148.515931,
+	148.707948,
+	148.899868,
+	149.091692,
+	149.28342,
+	149.475052,
+	149.666588,
+	149.858027,
+	150.049371,
+	150.240619,
+	150.431771,
+	150.622827,
+	150.813787,
+	151.004652,
+	151.195421,
+	151.386095,
+	151.576673,
+	151.767156,
+	151.957543,
+	152.147835,
+	152.338032,
+	152.528134,
+	152.718141,
+	152.908052,
+	153.097869,
+	153.28759,
+	153.477217,
+	153.666749,
+	153.856186,
+	154.045529,
+	154.234777,
+	154.42393,
+	154.612989,
+	154.801953,
+	154.990823,
+	155.179599,
+	155.368281,
+	155.556868,
+	155.745361,
+	155.93376,
+	156.122065,
+	156.310276,
+	156.498393,
+	156.686417,
+	156.874346,
+	157.062182,
+	157.249925,
+	157.437573,
+	157.625128,
+	157.81259,
+	157.999958,
+	158.187233,
+	158.374414,
+	158.561503,
+	158.748498,
+	158.9354,
+	159.122209,
+	159.308925,
+	159.495548,
+	159.682078,
+	159.868516,
+	160.05486,
+	160.241112,
+	160.427272,
+	160.613338,
+	160.799313,
+	160.985194,
+	161.170984,
+	161.356681,
+	161.542285,
+	161.727798,
+	161.913218,
+	162.098547,
+	162.283783,
+	162.468927,
+	162.65398,
+	162.83894,
+	163.023809,
+	163.208586,
+	163.393271,
+	163.577865,
+	163.762367,
+	163.946778,
+	164.131097,
+	164.315324,
+	164.499461,
+	164.683506,
+	164.86746,
+	165.051323,
+	165.235095,
+	165.418775,
+	165.602365,
+	165.785864,
+	165.969272,
+	166.152589,
+	166.335816,
+	166.518952,
+	166.701997,
+	166.884951,
+	167.067816,
+	167.250589,
+	167.433273,
+	167.615866,
+	167.798368,
+	167.980781,
+	168.163103,
+	168.345336,
+	168.527478,
+	168.70953,
+	168.891493,
+	169.073365,
+	169.255148,
+	169.436841,
+	169.618444,
+	169.799958,
+	169.981382,
+	170.162717,
+	170.343962,
+	170.525118,
+	170.706185,
+	170.887162,
+	171.06805,
+	171.248849,
+	171.429559,
+	171.61018,
+	171.790711,
+	171.971154,
+	172.151508,
+	172.331774,
+	172.51195,
+	172.692038,
+	172.872037,
+	173.051948,
+	173.23177,
+	173.411504,
+	173.591149,
+	173.770706,
+	173.950175,
+	174.129555,
+	174.308847,
+	174.488052,
+	174.667168,
+	174.846196,
+	175.025136,
+	175.203989,
+	175.382753,
+	175.56143,
+	175.740019,
+	175.918521,
+	176.096935,
+	176.275261,
+	176.4535,
+	176.631652,
+	176.809716,
+	176.987693,
+	177.165582,
+	177.343385,
+	177.5211,
+	177.698728,
+	177.87627,
+	178.053724,
+	178.231092,
+	178.408372,
+	178.585566,
+	178.762673,
+	178.939694,
+	179.116628,
+	179.293475,
+	179.470236,
+	179.64691,
+	179.823498,
+	180,
+};
+
+static const float gCurveTab3[1024] =
+{
+	-100,
+	-99.6480938,
+	-99.2961877,
+	-98.9442815,
+	-98.5923754,
+	-98.2404692,
+	-97.888563,
+	-97.5366569,
+	-97.1847507,
+	-96.8328446,
+	-96.4809384,
+	-96.1290323,
+	-95.7771261,
+	-95.4252199,
+	-95.0733138,
+	-94.7214076,
+	-94.3695015,
+	-94.0175953,
+	-93.6656891,
+	-93.313783,
+	-92.9618768,
+	-92.6099707,
+	-92.2580645,
+	-91.9061584,
+	-91.5542522,
+	-91.202346,
+	-90.8504399,
+	-90.4985337,
+	-90.1466276,
+	-89.7947214,
+	-89.4428152,
+	-89.0909091,
+	-88.7390029,
+	-88.3870968,
+	-88.0351906,
+	-87.6832845,
+	-87.3313783,
+	-86.9794721,
+	-86.627566,
+	-86.2756598,
+	-85.9237537,
+	-85.5718475,
+	-85.2199413,
+	-84.8680352,
+	-84.516129,
+	-84.1642229,
+	-83.8123167,
+	-83.4604106,
+	-83.1085044,
+	-82.7565982,
+	-82.4046921,
+	-82.0527859,
+	-81.7008798,
+	-81.3489736,
+	-80.9970674,
+	-80.6451613,
+	-80.2932551,
+	-79.941349,
+	-79.5894428,
+	-79.2375367,
+	-78.8856305,
+	-78.5337243,
+	-78.1818182,
+	-77.829912,
+	-77.4780059,
+	-77.1260997,
+	-76.7741935,
+	-76.4222874,
+	-76.0703812,
+	-75.7184751,
+	-75.3665689,
+	-75.0146628,
+	-74.6627566,
+	-74.3108504,
+	-73.9589443,
+	-73.6070381,
+	-73.255132,
+	-72.9032258,
+	-72.5513196,
+	-72.1994135,
+	-71.8475073,
+	-71.4956012,
+	-71.143695,
+	-70.7917889,
+	-70.4398827,
+	-70.0879765,
+	-69.7360704,
+	-69.3841642,
+	-69.0322581,
+	-68.6803519,
+	-68.3284457,
+	-67.9765396,
+	-67.6246334,
+	-67.2727273,
+	-66.9208211,
+	-66.568915,
+	-66.2170088,
+	-65.8651026,
+	-65.5131965,
+	-65.1612903,
+	-64.8093842,
+	-64.457478,
+	-64.1055718,
+	-63.7536657,
+	-63.4017595,
+	-63.0498534,
+	-62.6979472,
+	-62.3460411,
+	-61.9941349,
+	-61.6422287,
+	-61.2903226,
+	-60.9384164,
+	-60.5865103,
+	-60.2346041,
+	-59.8826979,
+	-59.5307918,
+	-59.1788856,
+	-58.8269795,
+	-58.4750733,
+	-58.1231672,
+	-57.771261,
+	-57.4193548,
+	-57.0674487,
+	-56.7155425,
+	-56.3636364,
+	-56.0117302,
+	-55.659824,
+	-55.3079179,
+	-54.9560117,
+	-54.6041056,
+	-54.2521994,
+	-53.9002933,
+	-53.5483871,
+	-53.1964809,
+	-52.8445748,
+	-52.4926686,
+	-52.1407625,
+	-51.7888563,
+	-51.4369501,
+	-51.085044,
+	-50.7331378,
+	-50.3812317,
+	-50.0293255,
+	-49.6774194,
+	-49.3255132,
+	-48.973607,
+	-48.6217009,
+	-48.2697947,
+	-47.9178886,
+	-47.5659824,
+	-47.2140762,
+	-46.8621701,
+	-46.5102639,
+	-46.1583578,
+	-45.8064516,
+	-45.4545455,
+	-45.1026393,
+	-44.7507331,
+	-44.398827,
+	-44.0469208,
+	-43.6950147,
+	-43.3431085,
+	-42.9912023,
+	-42.6392962,
+	-42.28739,
+	-41.9354839,
+	-41.5835777,
+	-41.2316716,
+	-40.8797654,
+	-40.5278592,
+	-40.1759531,
+	-39.8240469,
+	-39.4721408,
+	-39.1202346,
+	-38.7683284,
+	-38.4164223,
+	-38.0645161,
+	-37.71261,
+	-37.3607038,
+	-37.0087977,
+	-36.6568915,
+	-36.3049853,
+	-35.9530792,
+	-35.601173,
+	-35.2492669,
+	-34.8973607,
+	-34.5454545,
+	-34.1935484,
+	-33.8416422,
+	-33.4897361,
+	-33.1378299,
+	-32.7859238,
+	-32.4340176,
+	-32.0821114,
+	-31.7302053,
+	-31.3782991,
+	-31.026393,
+	-30.6744868,
+	-30.3225806,
+	-29.9706745,
+	-29.6187683,
+	-29.2668622,
+	-28.914956,
+	-28.5630499,
+	-28.2111437,
+	-27.8592375,
+	-27.5073314,
+	-27.1554252,
+	-26.8035191,
+	-26.4516129,
+	-26.0997067,
+	-25.7478006,
+	-25.3958944,
+	-25.0439883,
+	-24.6920821,
+	-24.340176,
+	-23.9882698,
+	-23.6363636,
+	-23.2844575,
+	-22.9325513,
+	-22.5806452,
+	-22.228739,
+	-21.8768328,
+	-21.5249267,
+	-21.1730205,
+	-20.8211144,
+	-20.4692082,
+	-20.1173021,
+	-19.7653959,
+	-19.4134897,
+	-19.0615836,
+	-18.7096774,
+	-18.3577713,
+	-18.0058651,
+	-17.6539589,
+	-17.3020528,
+	-16.9501466,
+	-16.5982405,
+	-16.2463343,
+	-15.8944282,
+	-15.542522,
+	-15.1906158,
+	-14.8387097,
+	-14.4868035,
+	-14.1348974,
+	-13.7829912,
+	-13.431085,
+	-13.0791789,
+	-12.7272727,
+	-12.3753666,
+	-12.0234604,
+	-11.6715543,
+	-11.3196481,
+	-10.9677419,
+	-10.6158358,
+	-10.2639296,
+	-9.91202346,
+	-9.5601173,
+	-9.20821114,
+	-8.85630499,
+	-8.50439883,
+	-8.15249267,
+	-7.80058651,
+	-7.44868035,
+	-7.09677419,
+	-6.74486804,
+	-6.39296188,
+	-6.04105572,
+	-5.68914956,
+	-5.3372434,
+	-4.98533724,
+	-4.63343109,
+	-4.28152493,
+	-3.92961877,
+	-3.57771261,
+	-3.22580645,
+	-2.87390029,
+	-2.52199413,
+	-2.17008798,
+	-1.81818182,
+	-1.46627566,
+	-1.1143695,
+	-0.762463343,
+	-0.410557185,
+	-0.0586510264,
+	0.293255132,
+	0.64516129,
+	0.997067449,
+	1.34897361,
+	1.70087977,
+	2.05278592,
+	2.40469208,
+	2.75659824,
+	3.1085044,
+	3.46041056,
+	3.81231672,
+	4.16422287,
+	4.51612903,
+	4.86803519,
+	5.21994135,
+	5.57184751,
+	5.92375367,
+	6.27565982,
+	6.62756598,
+	6.97947214,
+	7.3313783,
+	7.68328446,
+	8.03519062,
+	8.38709677,
+	8.73900293,
+	9.09090909,
+	9.44281525,
+	9.79472141,
+	10.1466276,
+	10.4985337,
+	10.8504399,
+	11.202346,
+	11.5542522,
+	11.9061584,
+	12.2580645,
+	12.6099707,
+	12.9618768,
+	13.313783,
+	13.6656891,
+	14.0175953,
+	14.3695015,
+	14.7214076,
+	15.0733138,
+	15.4252199,
+	15.7771261,
+	16.1290323,
+	16.4809384,
+	16.8328446,
+	17.1847507,
+	17.5366569,
+	17.888563,
+	18.2404692,
+	18.5923754,
+	18.9442815,
+	19.2961877,
+	19.6480938,
+	20,
+	20.3519062,
+	20.7038123,
+	21.0557185,
+	21.4076246,
+	21.7595308,
+	22.111437,
+	22.4633431,
+	22.8152493,
+	23.1671554,
+	23.5190616,
+	23.8709677,
+	24.2228739,
+	24.5747801,
+	24.9266862,
+	25.2785924,
+	25.6304985,
+	25.9824047,
+	26.3343109,
+	26.686217,
+	27.0381232,
+	27.3900293,
+	27.7419355,
+	28.0938416,
+	28.4457478,
+	28.797654,
+	29.1495601,
+	29.5014663,
+	29.8533724,
+	30.2052786,
+	30.5571848,
+	30.9090909,
+	31.2609971,
+	31.6129032,
+	31.9648094,
+	32.3167155,
+	32.6686217,
+	33.0205279,
+	33.372434,
+	33.7243402,
+	34.0762463,
+	34.4281525,
+	34.7800587,
+	35.1319648,
+	35.483871,
+	35.8357771,
+	36.1876833,
+	36.5395894,
+	36.8914956,
+	37.2434018,
+	37.5953079,
+	37.9472141,
+	38.2991202,
+	38.6510264,
+	39.0029326,
+	39.3548387,
+	39.7067449,
+	40.058651,
+	40.4105572,
+	40.7624633,
+	41.1143695,
+	41.4662757,
+	41.8181818,
+	42.170088,
+	42.5219941,
+	42.8739003,
+	43.2258065,
+	43.5777126,
+	43.9296188,
+	44.2815249,
+	44.6334311,
+	44.9853372,
+	45.3372434,
+	45.6891496,
+	46.0410557,
+	46.3929619,
+	46.744868,
+	47.0967742,
+	47.4486804,
+	47.8005865,
+	48.1524927,
+	48.5043988,
+	48.856305,
+	49.2082111,
+	49.5601173,
+	49.9120235,
+	50.2639296,
+	50.6158358,
+	50.9677419,
+	51.3196481,
+	51.6715543,
+	52.0234604,
+	52.3753666,
+	52.7272727,
+	53.0791789,
+	53.431085,
+	53.7829912,
+	54.1348974,
+	54.4868035,
+	54.8387097,
+	55.1906158,
+	55.542522,
+	55.8944282,
+	56.2463343,
+	56.5982405,
+	56.9501466,
+	57.3020528,
+	57.6539589,
+	58.0058651,
+	58.3577713,
+	58.7096774,
+	59.0615836,
+	59.4134897,
+	59.7653959,
+	60.1173021,
+	60.4692082,
+	60.8211144,
+	61.1730205,
+	61.5249267,
+	61.8768328,
+	62.228739,
+	62.5806452,
+	62.9325513,
+	63.2844575,
+	63.6363636,
+	63.9882698,
+	64.340176,
+	64.6920821,
+	65.0439883,
+	65.3958944,
+	65.7478006,
+	66.0997067,
+	66.4516129,
+	66.8035191,
+	67.1554252,
+	67.5073314,
+	67.8592375,
+	68.2111437,
+	68.5630499,
+	68.914956,
+	69.2668622,
+	69.6187683,
+	69.9706745,
+	70.3225806,
+	70.6744868,
+	71.026393,
+	71.3782991,
+	71.7302053,
+	72.0821114,
+	72.4340176,
+	72.7859238,
+	73.1378299,
+	73.4897361,
+	73.8416422,
+	74.1935484,
+	74.5454545,
+	74.8973607,
+	75.2492669,
+	75.601173,
+	75.9530792,
+	76.3049853,
+	76.6568915,
+	77.0087977,
+	77.3607038,
+	77.71261,
+	78.0645161,
+	78.4164223,
+	78.7683284,
+	79.1202346,
+	79.4721408,
+	79.8240469,
+	80.1759531,
+	80.5278592,
+	80.8797654,
+	81.2316716,
+	81.5835777,
+	81.9354839,
+	82.28739,
+	82.6392962,
+	82.9912023,
+	83.3431085,
+	83.6950147,
+	84.0469208,
+	84.398827,
+	84.7507331,
+	85.1026393,
+	85.4545455,
+	85.8064516,
+	86.1583578,
+	86.5102639,
+	86.8621701,
+	87.2140762,
+	87.5659824,
+	87.9178886,
+	88.2697947,
+	88.6217009,
+	88.973607,
+	89.3255132,
+	89.6774194,
+	90.0293255,
+	90.3812317,
+	90.7331378,
+	91.085044,
+	91.4369501,
+	91.7888563,
+	92.1407625,
+	92.4926686,
+	92.8445748,
+	93.1964809,
+	93.5483871,
+	93.9002933,
+	94.2521994,
+	94.6041056,
+	94.9560117,
+	95.3079179,
+	95.659824,
+	96.0117302,
+	96.3636364,
+	96.7155425,
+	97.0674487,
+	97.4193548,
+	97.771261,
+	98.1231672,
+	98.4750733,
+	98.8269795,
+	99.1788856,
+	99.5307918,
+	99.8826979,
+	100.234604,
+	100.58651,
+	100.938416,
+	101.290323,
+	101.642229,
+	101.994135,
+	102.346041,
+	102.697947,
+	103.049853,
+	103.40176,
+	103.753666,
+	104.105572,
+	104.457478,
+	104.809384,
+	105.16129,
+	105.513196,
+	105.865103,
+	106.217009,
+	106.568915,
+	106.920821,
+	107.272727,
+	107.624633,
+	107.97654,
+	108.328446,
+	108.680352,
+	109.032258,
+	109.384164,
+	109.73607,
+	110.087977,
+	110.439883,
+	110.791789,
+	111.143695,
+	111.495601,
+	111.847507,
+	112.199413,
+	112.55132,
+	112.903226,
+	113.255132,
+	113.607038,
+	113.958944,
+	114.31085,
+	114.662757,
+	115.014663,
+	115.366569,
+	115.718475,
+	116.070381,
+	116.422287,
+	116.774194,
+	117.1261,
+	117.478006,
+	117.829912,
+	118.181818,
+	118.533724,
+	118.88563,
+	119.237537,
+	119.589443,
+	119.941349,
+	120.293255,
+	120.645161,
+	120.997067,
+	121.348974,
+	121.70088,
+	122.052786,
+	122.404692,
+	122.756598,
+	123.108504,
+	123.460411,
+	123.812317,
+	124.164223,
+	124.516129,
+	124.868035,
+	125.219941,
+	125.571848,
+	125.923754,
+	126.27566,
+	126.627566,
+	126.979472,
+	127.331378,
+	127.683284,
+	128.035191,
+	128.387097,
+	128.739003,
+	129.090909,
+	129.442815,
+	129.794721,
+	130.146628,
+	130.498534,
+	130.85044,
+	131.202346,
+	131.554252,
+	131.906158,
+	132.258065,
+	132.609971,
+	132.961877,
+	133.313783,
+	133.665689,
+	134.017595,
+	134.369501,
+	134.721408,
+	135.073314,
+	135.42522,
+	135.777126,
+	136.129032,
+	136.480938,
+	136.832845,
+	137.184751,
+	137.536657,
+	137.888563,
+	138.240469,
+	138.592375,
+	138.944282,
+	139.296188,
+	139.648094,
+	140,
+	140.351906,
+	140.703812,
+	141.055718,
+	141.407625,
+	141.759531,
+	142.111437,
+	142.463343,
+	142.815249,
+	143.167155,
+	143.519062,
+	143.870968,
+	144.222874,
+	144.57478,
+	144.926686,
+	145.278592,
+	145.630499,
+	145.982405,
+	146.334311,
+	146.686217,
+	147.038123,
+	147.390029,
+	147.741935,
+	148.093842,
+	148.445748,
+	148.797654,
+	149.14956,
+	149.501466,
+	149.853372,
+	150.205279,
+	150.557185,
+	150.909091,
+	151.260997,
+	151.612903,
+	151.964809,
+	152.316716,
+	152.668622,
+	153.020528,
+	153.372434,
+	153.72434,
+	154.076246,
+	154.428152,
+	154.780059,
+	155.131965,
+	155.483871,
+	155.835777,
+	156.187683,
+	156.539589,
+	156.891496,
+	157.243402,
+	157.595308,
+	157.947214,
+	158.29912,
+	158.651026,
+	159.002933,
+	159.354839,
+	159.706745,
+	160.058651,
+	160.410557,
+	160.762463,
+	161.11437,
+	161.466276,
+	161.818182,
+	162.170088,
+	162.521994,
+	162.8739,
+	163.225806,
+	163.577713,
+	163.929619,
+	164.281525,
+	164.633431,
+	164.985337,
+	165.337243,
+	165.68915,
+	166.041056,
+	166.392962,
+	166.744868,
+	167.096774,
+	167.44868,
+	167.800587,
+	168.152493,
+	168.504399,
+	168.856305,
+	169.208211,
+	169.560117,
+	169.912023,
+	170.26393,
+	170.615836,
+	170.967742,
+	171.319648,
+	171.671554,
+	172.02346,
+	172.375367,
+	172.727273,
+	173.079179,
+	173.431085,
+	173.782991,
+	174.134897,
+	174.486804,
+	174.83871,
+	175.190616,
+	175.542522,
+	175.894428,
+	176.246334,
+	176.59824,
+	176.950147,
+	177.302053,
+	177.653959,
+	178.005865,
+	178.357771,
+	178.709677,
+	179.061584,
+	179.41349,
+	179.765396,
+	180.117302,
+	180.469208,
+	180.821114,
+	181.173021,
+	181.524927,
+	181.876833,
+	182.228739,
+	182.580645,
+	182.932551,
+	183.284457,
+	183.636364,
+	183.98827,
+	184.340176,
+	184.692082,
+	185.043988,
+	185.395894,
+	185.747801,
+	186.099707,
+	186.451613,
+	186.803519,
+	187.155425,
+	187.507331,
+	187.859238,
+	188.211144,
+	188.56305,
+	188.914956,
+	189.266862,
+	189.618768,
+	189.970674,
+	190.322581,
+	190.674487,
+	191.026393,
+	191.378299,
+	191.730205,
+	192.082111,
+	192.434018,
+	192.785924,
+	193.13783,
+	193.489736,
+	193.841642,
+	194.193548,
+	194.545455,
+	194.897361,
+	195.249267,
+	195.601173,
+	195.953079,
+	196.304985,
+	196.656891,
+	197.008798,
+	197.360704,
+	197.71261,
+	198.064516,
+	198.416422,
+	198.768328,
+	199.120235,
+	199.472141,
+	199.824047,
+	200.175953,
+	200.527859,
+	200.879765,
+	201.231672,
+	201.583578,
+	201.935484,
+	202.28739,
+	202.639296,
+	202.991202,
+	203.343109,
+	203.695015,
+	204.046921,
+	204.398827,
+	204.750733,
+	205.102639,
+	205.454545,
+	205.806452,
+	206.158358,
+	206.510264,
+	206.86217,
+	207.214076,
+	207.565982,
+	207.917889,
+	208.269795,
+	208.621701,
+	208.973607,
+	209.325513,
+	209.677419,
+	210.029326,
+	210.381232,
+	210.733138,
+	211.085044,
+	211.43695,
+	211.788856,
+	212.140762,
+	212.492669,
+	212.844575,
+	213.196481,
+	213.548387,
+	213.900293,
+	214.252199,
+	214.604106,
+	214.956012,
+	215.307918,
+	215.659824,
+	216.01173,
+	216.363636,
+	216.715543,
+	217.067449,
+	217.419355,
+	217.771261,
+	218.123167,
+	218.475073,
+	218.826979,
+	219.178886,
+	219.530792,
+	219.882698,
+	220.234604,
+	220.58651,
+	220.938416,
+	221.290323,
+	221.642229,
+	221.994135,
+	222.346041,
+	222.697947,
+	223.049853,
+	223.40176,
+	223.753666,
+	224.105572,
+	224.457478,
+	224.809384,
+	225.16129,
+	225.513196,
+	225.865103,
+	226.217009,
+	226.568915,
+	226.920821,
+	227.272727,
+	227.624633,
+	227.97654,
+	228.328446,
+	228.680352,
+	229.032258,
+	229.384164,
+	229.73607,
+	230.087977,
+	230.439883,
+	230.791789,
+	231.143695,
+	231.495601,
+	231.847507,
+	232.199413,
+	232.55132,
+	232.903226,
+	233.255132,
+	233.607038,
+	233.958944,
+	234.31085,
+	234.662757,
+	235.014663,
+	235.366569,
+	235.718475,
+	236.070381,
+	236.422287,
+	236.774194,
+	237.1261,
+	237.478006,
+	237.829912,
+	238.181818,
+	238.533724,
+	238.88563,
+	239.237537,
+	239.589443,
+	239.941349,
+	240.293255,
+	240.645161,
+	240.997067,
+	241.348974,
+	241.70088,
+	242.052786,
+	242.404692,
+	242.756598,
+	243.108504,
+	243.460411,
+	243.812317,
+	244.164223,
+	244.516129,
+	244.868035,
+	245.219941,
+	245.571848,
+	245.923754,
+	246.27566,
+	246.627566,
+	246.979472,
+	247.331378,
+	247.683284,
+	248.035191,
+	248.387097,
+	248.739003,
+	249.090909,
+	249.442815,
+	249.794721,
+	250.146628,
+	250.498534,
+	250.85044,
+	251.202346,
+	251.554252,
+	251.906158,
+	252.258065,
+	252.609971,
+	252.961877,
+	253.313783,
+	253.665689,
+	254.017595,
+	254.369501,
+	254.721408,
+	255.073314,
+	255.42522,
+	255.777126,
+	256.129032,
+	256.480938,
+	256.832845,
+	257.184751,
+	257.536657,
+	257.888563,
+	258.240469,
+	258.592375,
+	258.944282,
+	259.296188,
+	259.648094,
+	260,
+};
+
+static const RtdCurveType gCurveList[4] =
+{
+	{"pt100", "IEC 60751, R0 = 100 ohm", 18.520079999999997, 2.7502880039494459, 1024, gCurveTab0},
+	{"pt1000", "IEC 60751, R0 = 1000 ohm", 185.20079999999996, 0.27502880039494459, 1024, gCurveTab1},
+	{"ni120", "DIN 43760 equation, R0 = 120 ohm", 83.424311385599992, 5.5489635942272812, 1024, gCurveTab2},
+	{"cu10", "alpha 0.00427, 10 ohm at 25 degC", 5.177320984865597, 73.653737314597976, 1024, gCurveTab3},
+};
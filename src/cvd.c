@@ -0,0 +1,74 @@
+/*
+ * cvd.c:
+ *	IEC 60751 Callendar-Van Dusen equation of the platinum sensors, exact
+ *	solutions. Also linked in the table generator (cvdgen.c), keep it free
+ *	of any other dependency
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <math.h>
+
+#include "rtdconv.h"
+
+#define CVD_NEWTON_MAX	8
+
+/*
+ * rtdCvdRes:
+ *	Resistance of a sensor with the given R0 at temp degC
+ *	R = R0 (1 + A t + B t^2 + C (t - 100) t^3), the C term only below 0
+ */
+double rtdCvdRes(double temp, double r0)
+{
+	double r = 1 + RTD_CVD_A * temp + RTD_CVD_B * temp * temp;
+
+	if (temp < 0)
+	{
+		r += RTD_CVD_C * (temp - 100) * temp * temp * temp;
+	}
+	return r0 * r;
+}
+
+/*
+ * rtdCvdTempExact:
+ *	Inverse of rtdCvdRes(). Above 0 degC the quadratic is solved directly,
+ *	below Newton iterations start from the quadratic solution and converge
+ *	to double precision in 2 or 3 steps over the standard range
+ */
+double rtdCvdTempExact(double res, double r0)
+{
+	double w = res / r0;
+	double t = 0;
+	double f = 0;
+	double df = 0;
+	double disc = RTD_CVD_A * RTD_CVD_A - 4 * RTD_CVD_B * (1 - w);
+	int i = 0;
+
+	if (disc < 0)
+	{
+		return NAN; // above the maximum of the parabola, not a platinum sensor
+	}
+	t = (-RTD_CVD_A + sqrt(disc)) / (2 * RTD_CVD_B);
+	if (w >= 1)
+	{
+		return t;
+	}
+	for (i = 0; i < CVD_NEWTON_MAX; i++)
+	{
+		f = rtdCvdRes(t, 1) - w;
+		df = RTD_CVD_A + 2 * RTD_CVD_B * t
+			+ RTD_CVD_C * (4 * t * t * t - 300 * t * t);
+		if (df == 0)
+		{
+			break;
+		}
+		f /= df;
+		t -= f;
+		if (fabs(f) < 1e-12)
+		{
+			break;
+		}
+	}
+	return t;
+}
@@ -0,0 +1,46 @@
+/*
+ * cvdgen.c:
+ *	Build time generator of the Callendar-Van Dusen tables used by rtdconv.c
+ *	Usage: cvdgen > cvdtab.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <math.h>
+
+#include "rtdconv.h"
+
+static void fixTab(void)
+{
+	int i = 0;
+
+	printf("\n/* micro degC at R = %d + i / %d ohm, R0 = 100 ohm */\n", RTD_FIX_TAB_MIN,
+		1 << RTD_FIX_TAB_SHIFT);
+	printf("static const int32_t gCvdFixTab[%d] =\n{\n", RTD_FIX_TAB_SIZE);
+	for (i = 0; i < RTD_FIX_TAB_SIZE; i++)
+	{
+		printf("\t%ld,\n", lround(rtdCvdTempExact(RTD_FIX_TAB_MIN
+			+ (double)i / (1 << RTD_FIX_TAB_SHIFT), RTD_CVD_R0_PT100) * 1e6));
+	}
+	printf("};\n");
+}
+
+int main(void)
+{
+	int i = 0;
+
+	printf("/* generated by cvdgen, do not edit */\n");
+	printf("/* temperature (degC) at W = R / R0 = %g + i / %d */\n", RTD_CVD_TAB_W_MIN,
+		RTD_CVD_TAB_SCALE);
+	printf("static const float gCvdTab[%d] =\n{\n", RTD_CVD_TAB_SIZE);
+	for (i = 0; i < RTD_CVD_TAB_SIZE; i++)
+	{
+		printf("\t%.9g,\n", rtdCvdTempExact(RTD_CVD_TAB_W_MIN + (double)i / RTD_CVD_TAB_SCALE,
+			1));
+	}
+	printf("};\n");
+	fixTab();
+	return 0;
+}
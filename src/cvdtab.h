@@ -0,0 +1,7148 @@
+/* generated by cvdgen, do not edit */
+/* temperature (degC) at W = R / R0 = 0.125 + i / 256 */
+static const float gCvdTab[993] =
+{
+	-213.841025,
+	-212.948068,
+	-212.054386,
+	-211.159983,
+	-210.264861,
+	-209.369021,
+	-208.472466,
+	-207.575199,
+	-206.67722,
+	-205.778533,
+	-204.87914,
+	-203.979042,
+	-203.078243,
+	-202.176744,
+	-201.274547,
+	-200.371655,
+	-199.468071,
+	-198.563795,
+	-197.658832,
+	-196.753182,
+	-195.846848,
+	-194.939833,
+	-194.032138,
+	-193.123767,
+	-192.214721,
+	-191.305003,
+	-190.394614,
+	-189.483559,
+	-188.571838,
+	-187.659453,
+	-186.746409,
+	-185.832706,
+	-184.918347,
+	-184.003335,
+	-183.087672,
+	-182.17136,
+	-181.254402,
+	-180.3368,
+	-179.418556,
+	-178.499673,
+	-177.580154,
+	-176.66,
+	-175.739215,
+	-174.817799,
+	-173.895757,
+	-172.973091,
+	-172.049802,
+	-171.125893,
+	-170.201367,
+	-169.276226,
+	-168.350473,
+	-167.42411,
+	-166.497139,
+	-165.569563,
+	-164.641385,
+	-163.712607,
+	-162.78323,
+	-161.853259,
+	-160.922695,
+	-159.99154,
+	-159.059798,
+	-158.12747,
+	-157.19456,
+	-156.261069,
+	-155.327,
+	-154.392355,
+	-153.457138,
+	-152.52135,
+	-151.584994,
+	-150.648072,
+	-149.710587,
+	-148.772542,
+	-147.833938,
+	-146.894778,
+	-145.955066,
+	-145.014802,
+	-144.07399,
+	-143.132632,
+	-142.190731,
+	-141.248288,
+	-140.305307,
+	-139.36179,
+	-138.41774,
+	-137.473158,
+	-136.528047,
+	-135.58241,
+	-134.636249,
+	-133.689567,
+	-132.742366,
+	-131.794648,
+	-130.846416,
+	-129.897672,
+	-128.948419,
+	-127.998659,
+	-127.048394,
+	-126.097627,
+	-125.146361,
+	-124.194597,
+	-123.242338,
+	-122.289586,
+	-121.336345,
+	-120.382615,
+	-119.4284,
+	-118.473701,
+	-117.518522,
+	-116.562864,
+	-115.60673,
+	-114.650123,
+	-113.693043,
+	-112.735495,
+	-111.77748,
+	-110.818999,
+	-109.860057,
+	-108.900655,
+	-107.940794,
+	-106.980478,
+	-106.019709,
+	-105.058489,
+	-104.09682,
+	-103.134704,
+	-102.172144,
+	-101.209142,
+	-100.2457,
+	-99.2818201,
+	-98.3175045,
+	-97.3527554,
+	-96.387575,
+	-95.4219655,
+	-94.4559288,
+	-93.4894673,
+	-92.522583,
+	-91.5552779,
+	-90.5875543,
+	-89.6194141,
+	-88.6508594,
+	-87.6818923,
+	-86.7125147,
+	-85.7427289,
+	-84.7725366,
+	-83.8019401,
+	-82.8309411,
+	-81.8595418,
+	-80.8877441,
+	-79.9155499,
+	-78.9429612,
+	-77.9699799,
+	-76.9966078,
+	-76.022847,
+	-75.0486993,
+	-74.0741665,
+	-73.0992505,
+	-72.1239532,
+	-71.1482764,
+	-70.1722218,
+	-69.1957913,
+	-68.2189866,
+	-67.2418096,
+	-66.2642619,
+	-65.2863454,
+	-64.3080616,
+	-63.3294124,
+	-62.3503994,
+	-61.3710243,
+	-60.3912887,
+	-59.4111942,
+	-58.4307426,
+	-57.4499354,
+	-56.4687741,
+	-55.4872604,
+	-54.5053958,
+	-53.5231818,
+	-52.54062,
+	-51.5577119,
+	-50.5744589,
+	-49.5908626,
+	-48.6069242,
+	-47.6226454,
+	-46.6380275,
+	-45.6530719,
+	-44.6677799,
+	-43.682153,
+	-42.6961925,
+	-41.7098996,
+	-40.7232757,
+	-39.7363221,
+	-38.74904,
+	-37.7614307,
+	-36.7734953,
+	-35.7852352,
+	-34.7966514,
+	-33.8077452,
+	-32.8185176,
+	-31.8289699,
+	-30.839103,
+	-29.8489182,
+	-28.8584164,
+	-27.8675987,
+	-26.8764661,
+	-25.8850197,
+	-24.8932603,
+	-23.901189,
+	-22.9088066,
+	-21.9161142,
+	-20.9231126,
+	-19.9298026,
+	-18.9361851,
+	-17.942261,
+	-16.9480311,
+	-15.9534961,
+	-14.9586568,
+	-13.9635139,
+	-12.9680682,
+	-11.9723203,
+	-10.976271,
+	-9.97992078,
+	-8.98327041,
+	-7.98632045,
+	-6.98907146,
+	-5.99152402,
+	-4.99367866,
+	-3.99553588,
+	-2.99709617,
+	-1.99836,
+	-0.999327804,
+	-0,
+	0.999623126,
+	1.99954173,
+	2.99975607,
+	4.00026642,
+	5.00107302,
+	6.00217616,
+	7.00357609,
+	8.00527307,
+	9.00726737,
+	10.0095593,
+	11.012149,
+	12.0150369,
+	13.0182231,
+	14.021708,
+	15.0254918,
+	16.0295748,
+	17.0339572,
+	18.0386394,
+	19.0436215,
+	20.0489039,
+	21.0544868,
+	22.0603705,
+	23.0665553,
+	24.0730414,
+	25.0798291,
+	26.0869187,
+	27.0943105,
+	28.1020047,
+	29.1100015,
+	30.1183014,
+	31.1269044,
+	32.135811,
+	33.1450214,
+	34.1545358,
+	35.1643546,
+	36.174478,
+	37.1849063,
+	38.1956397,
+	39.2066786,
+	40.2180232,
+	41.2296738,
+	42.2416307,
+	43.2538941,
+	44.2664644,
+	45.2793417,
+	46.2925265,
+	47.3060189,
+	48.3198193,
+	49.3339279,
+	50.3483451,
+	51.363071,
+	52.378106,
+	53.3934503,
+	54.4091043,
+	55.4250683,
+	56.4413424,
+	57.457927,
+	58.4748224,
+	59.4920289,
+	60.5095467,
+	61.5273762,
+	62.5455176,
+	63.5639712,
+	64.5827373,
+	65.6018161,
+	66.6212081,
+	67.6409134,
+	68.6609323,
+	69.6812652,
+	70.7019124,
+	71.722874,
+	72.7441505,
+	73.7657421,
+	74.787649,
+	75.8098717,
+	76.8324103,
+	77.8552652,
+	78.8784367,
+	79.901925,
+	80.9257305,
+	81.9498534,
+	82.9742941,
+	83.9990528,
+	85.0241299,
+	86.0495256,
+	87.0752402,
+	88.1012741,
+	89.1276275,
+	90.1543007,
+	91.181294,
+	92.2086078,
+	93.2362423,
+	94.2641978,
+	95.2924747,
+	96.3210731,
+	97.3499935,
+	98.3792362,
+	99.4088014,
+	100.438689,
+	101.468901,
+	102.499435,
+	103.530294,
+	104.561476,
+	105.592983,
+	106.624814,
+	107.656971,
+	108.689452,
+	109.72226,
+	110.755393,
+	111.788852,
+	112.822638,
+	113.856751,
+	114.891191,
+	115.925958,
+	116.961053,
+	117.996477,
+	119.032228,
+	120.068309,
+	121.104718,
+	122.141456,
+	123.178525,
+	124.215923,
+	125.253651,
+	126.29171,
+	127.3301,
+	128.368822,
+	129.407874,
+	130.447259,
+	131.486975,
+	132.527025,
+	133.567407,
+	134.608122,
+	135.64917,
+	136.690553,
+	137.732269,
+	138.77432,
+	139.816706,
+	140.859426,
+	141.902482,
+	142.945874,
+	143.989602,
+	145.033666,
+	146.078067,
+	147.122804,
+	148.16788,
+	149.213292,
+	150.259043,
+	151.305132,
+	152.35156,
+	153.398326,
+	154.445432,
+	155.492878,
+	156.540664,
+	157.588789,
+	158.637256,
+	159.686063,
+	160.735212,
+	161.784702,
+	162.834535,
+	163.884709,
+	164.935226,
+	165.986087,
+	167.03729,
+	168.088837,
+	169.140728,
+	170.192964,
+	171.245544,
+	172.298469,
+	173.351739,
+	174.405355,
+	175.459317,
+	176.513625,
+	177.56828,
+	178.623283,
+	179.678632,
+	180.734329,
+	181.790374,
+	182.846768,
+	183.90351,
+	184.960602,
+	186.018043,
+	187.075833,
+	188.133974,
+	189.192466,
+	190.251308,
+	191.310501,
+	192.370046,
+	193.429943,
+	194.490192,
+	195.550793,
+	196.611748,
+	197.673055,
+	198.734717,
+	199.796732,
+	200.859102,
+	201.921827,
+	202.984906,
+	204.048341,
+	205.112132,
+	206.176279,
+	207.240782,
+	208.305642,
+	209.37086,
+	210.436435,
+	211.502367,
+	212.568659,
+	213.635308,
+	214.702317,
+	215.769685,
+	216.837413,
+	217.905501,
+	218.97395,
+	220.042759,
+	221.11193,
+	222.181462,
+	223.251356,
+	224.321612,
+	225.392231,
+	226.463213,
+	227.534559,
+	228.606268,
+	229.678341,
+	230.750779,
+	231.823582,
+	232.89675,
+	233.970284,
+	235.044183,
+	236.118449,
+	237.193082,
+	238.268082,
+	239.343449,
+	240.419185,
+	241.495288,
+	242.571761,
+	243.648602,
+	244.725812,
+	245.803393,
+	246.881343,
+	247.959665,
+	249.038357,
+	250.11742,
+	251.196855,
+	252.276662,
+	253.356842,
+	254.437394,
+	255.51832,
+	256.59962,
+	257.681293,
+	258.763341,
+	259.845763,
+	260.928561,
+	262.011734,
+	263.095284,
+	264.179209,
+	265.263511,
+	266.348191,
+	267.433248,
+	268.518683,
+	269.604496,
+	270.690688,
+	271.777259,
+	272.86421,
+	273.95154,
+	275.039251,
+	276.127343,
+	277.215815,
+	278.30467,
+	279.393906,
+	280.483524,
+	281.573525,
+	282.663909,
+	283.754677,
+	284.845829,
+	285.937365,
+	287.029285,
+	288.121591,
+	289.214283,
+	290.30736,
+	291.400824,
+	292.494674,
+	293.588912,
+	294.683537,
+	295.778551,
+	296.873952,
+	297.969743,
+	299.065923,
+	300.162492,
+	301.259452,
+	302.356802,
+	303.454543,
+	304.552676,
+	305.6512,
+	306.750116,
+	307.849425,
+	308.949127,
+	310.049222,
+	311.149712,
+	312.250595,
+	313.351873,
+	314.453547,
+	315.555616,
+	316.658081,
+	317.760942,
+	318.8642,
+	319.967856,
+	321.071909,
+	322.17636,
+	323.28121,
+	324.386459,
+	325.492107,
+	326.598155,
+	327.704604,
+	328.811453,
+	329.918703,
+	331.026355,
+	332.134409,
+	333.242866,
+	334.351725,
+	335.460988,
+	336.570654,
+	337.680725,
+	338.7912,
+	339.902081,
+	341.013367,
+	342.125059,
+	343.237158,
+	344.349663,
+	345.462576,
+	346.575897,
+	347.689626,
+	348.803763,
+	349.91831,
+	351.033266,
+	352.148633,
+	353.264409,
+	354.380597,
+	355.497197,
+	356.614208,
+	357.731631,
+	358.849467,
+	359.967717,
+	361.08638,
+	362.205457,
+	363.324949,
+	364.444856,
+	365.565178,
+	366.685917,
+	367.807072,
+	368.928644,
+	370.050633,
+	371.17304,
+	372.295866,
+	373.41911,
+	374.542774,
+	375.666857,
+	376.79136,
+	377.916284,
+	379.04163,
+	380.167397,
+	381.293586,
+	382.420197,
+	383.547232,
+	384.67469,
+	385.802572,
+	386.930879,
+	388.059611,
+	389.188768,
+	390.318351,
+	391.44836,
+	392.578796,
+	393.70966,
+	394.840951,
+	395.972671,
+	397.10482,
+	398.237398,
+	399.370406,
+	400.503844,
+	401.637713,
+	402.772013,
+	403.906745,
+	405.041909,
+	406.177506,
+	407.313536,
+	408.45,
+	409.586898,
+	410.724231,
+	411.861999,
+	413.000203,
+	414.138843,
+	415.27792,
+	416.417435,
+	417.557387,
+	418.697777,
+	419.838606,
+	420.979874,
+	422.121582,
+	423.26373,
+	424.406319,
+	425.54935,
+	426.692822,
+	427.836737,
+	428.981094,
+	430.125895,
+	431.27114,
+	432.416829,
+	433.562963,
+	434.709542,
+	435.856567,
+	437.004039,
+	438.151958,
+	439.300324,
+	440.449139,
+	441.598402,
+	442.748114,
+	443.898275,
+	445.048887,
+	446.19995,
+	447.351463,
+	448.503429,
+	449.655846,
+	450.808717,
+	451.962041,
+	453.115818,
+	454.270051,
+	455.424738,
+	456.57988,
+	457.735479,
+	458.891534,
+	460.048046,
+	461.205016,
+	462.362444,
+	463.520331,
+	464.678677,
+	465.837483,
+	466.996749,
+	468.156476,
+	469.316665,
+	470.477316,
+	471.638429,
+	472.800005,
+	473.962045,
+	475.12455,
+	476.287519,
+	477.450953,
+	478.614854,
+	479.779221,
+	480.944055,
+	482.109356,
+	483.275126,
+	484.441364,
+	485.608072,
+	486.77525,
+	487.942898,
+	489.111017,
+	490.279607,
+	491.44867,
+	492.618205,
+	493.788214,
+	494.958697,
+	496.129654,
+	497.301086,
+	498.472993,
+	499.645377,
+	500.818238,
+	501.991576,
+	503.165392,
+	504.339686,
+	505.514459,
+	506.689713,
+	507.865446,
+	509.04166,
+	510.218356,
+	511.395534,
+	512.573194,
+	513.751337,
+	514.929965,
+	516.109077,
+	517.288674,
+	518.468756,
+	519.649325,
+	520.83038,
+	522.011923,
+	523.193954,
+	524.376473,
+	525.559482,
+	526.742981,
+	527.92697,
+	529.11145,
+	530.296422,
+	531.481886,
+	532.667843,
+	533.854293,
+	535.041238,
+	536.228677,
+	537.416612,
+	538.605043,
+	539.79397,
+	540.983395,
+	542.173317,
+	543.363738,
+	544.554658,
+	545.746078,
+	546.937998,
+	548.130419,
+	549.323342,
+	550.516767,
+	551.710695,
+	552.905126,
+	554.100062,
+	555.295502,
+	556.491448,
+	557.6879,
+	558.884859,
+	560.082325,
+	561.280299,
+	562.478782,
+	563.677774,
+	564.877277,
+	566.077289,
+	567.277813,
+	568.478849,
+	569.680398,
+	570.88246,
+	572.085035,
+	573.288126,
+	574.491731,
+	575.695852,
+	576.90049,
+	578.105646,
+	579.311319,
+	580.51751,
+	581.724221,
+	582.931452,
+	584.139203,
+	585.347475,
+	586.55627,
+	587.765587,
+	588.975427,
+	590.185791,
+	591.39668,
+	592.608094,
+	593.820034,
+	595.032501,
+	596.245495,
+	597.459017,
+	598.673068,
+	599.887649,
+	601.102759,
+	602.318401,
+	603.534574,
+	604.751279,
+	605.968517,
+	607.186289,
+	608.404595,
+	609.623436,
+	610.842812,
+	612.062726,
+	613.283176,
+	614.504164,
+	615.725691,
+	616.947757,
+	618.170363,
+	619.39351,
+	620.617198,
+	621.841429,
+	623.066202,
+	624.291519,
+	625.51738,
+	626.743786,
+	627.970738,
+	629.198237,
+	630.426282,
+	631.654876,
+	632.884018,
+	634.11371,
+	635.343952,
+	636.574745,
+	637.80609,
+	639.037987,
+	640.270437,
+	641.503441,
+	642.737,
+	643.971114,
+	645.205784,
+	646.441011,
+	647.676796,
+	648.913139,
+	650.150041,
+	651.387504,
+	652.625526,
+	653.864111,
+	655.103257,
+	656.342967,
+	657.58324,
+	658.824078,
+	660.065481,
+	661.30745,
+	662.549986,
+	663.793089,
+	665.036761,
+	666.281002,
+	667.525813,
+	668.771195,
+	670.017148,
+	671.263674,
+	672.510772,
+	673.758445,
+	675.006692,
+	676.255515,
+	677.504914,
+	678.75489,
+	680.005444,
+	681.256576,
+	682.508288,
+	683.760581,
+	685.013454,
+	686.266909,
+	687.520947,
+	688.775569,
+	690.030775,
+	691.286566,
+	692.542943,
+	693.799906,
+	695.057458,
+	696.315598,
+	697.574327,
+	698.833646,
+	700.093556,
+	701.354058,
+	702.615152,
+	703.87684,
+	705.139123,
+	706.402,
+	707.665473,
+	708.929543,
+	710.194211,
+	711.459477,
+	712.725343,
+	713.991808,
+	715.258875,
+	716.526544,
+	717.794815,
+	719.06369,
+	720.33317,
+	721.603255,
+	722.873946,
+	724.145244,
+	725.417151,
+	726.689666,
+	727.96279,
+	729.236526,
+	730.510872,
+	731.785832,
+	733.061404,
+	734.33759,
+	735.614392,
+	736.891809,
+	738.169844,
+	739.448495,
+	740.727766,
+	742.007656,
+	743.288166,
+	744.569298,
+	745.851051,
+	747.133428,
+	748.416429,
+	749.700055,
+	750.984306,
+	752.269185,
+	753.554691,
+	754.840825,
+	756.127589,
+	757.414984,
+	758.70301,
+	759.991668,
+	761.280959,
+	762.570885,
+	763.861446,
+	765.152642,
+	766.444476,
+	767.736947,
+	769.030058,
+	770.323808,
+	771.618199,
+	772.913232,
+	774.208907,
+	775.505226,
+	776.80219,
+	778.099799,
+	779.398055,
+	780.696958,
+	781.996509,
+	783.29671,
+	784.597562,
+	785.899064,
+	787.20122,
+	788.504028,
+	789.807491,
+	791.111609,
+	792.416383,
+	793.721815,
+	795.027905,
+	796.334654,
+	797.642064,
+	798.950135,
+	800.258868,
+	801.568264,
+	802.878325,
+	804.189051,
+	805.500443,
+	806.812503,
+	808.125231,
+	809.438628,
+	810.752696,
+	812.067435,
+	813.382847,
+	814.698932,
+	816.015692,
+	817.333128,
+	818.65124,
+	819.970029,
+	821.289498,
+	822.609646,
+	823.930475,
+	825.251985,
+	826.574179,
+	827.897057,
+	829.22062,
+	830.544869,
+	831.869805,
+	833.195429,
+	834.521742,
+	835.848746,
+	837.176442,
+	838.50483,
+	839.833912,
+	841.163688,
+	842.49416,
+	843.82533,
+	845.157197,
+	846.489763,
+	847.823029,
+	849.156997,
+	850.491668,
+	851.827041,
+	853.16312,
+	854.499904,
+	855.837395,
+	857.175594,
+	858.514502,
+	859.854121,
+	861.194451,
+	862.535493,
+	863.877249,
+	865.21972,
+	866.562907,
+	867.906811,
+	869.251433,
+	870.596775,
+	871.942837,
+	873.289621,
+	874.637128,
+	875.985358,
+	877.334314,
+	878.683997,
+	880.034407,
+	881.385545,
+	882.737414,
+};
+
+/* micro degC at R = 18 + i / 16 ohm, R0 = 100 ohm */
+static const int32_t gCvdFixTab[6145] =
+{
+	-201202341,
+	-201057916,
+	-200913474,
+	-200769013,
+	-200624535,
+	-200480039,
+	-200335525,
+	-200190994,
+	-200046445,
+	-199901878,
+	-199757293,
+	-199612691,
+	-199468071,
+	-199323433,
+	-199178778,
+	-199034105,
+	-198889414,
+	-198744705,
+	-198599980,
+	-198455236,
+	-198310475,
+	-198165696,
+	-198020900,
+	-197876086,
+	-197731254,
+	-197586405,
+	-197441538,
+	-197296654,
+	-197151752,
+	-197006833,
+	-196861896,
+	-196716941,
+	-196571970,
+	-196426980,
+	-196281973,
+	-196136949,
+	-195991907,
+	-195846848,
+	-195701771,
+	-195556677,
+	-195411566,
+	-195266437,
+	-195121290,
+	-194976126,
+	-194830945,
+	-194685747,
+	-194540531,
+	-194395297,
+	-194250047,
+	-194104779,
+	-193959493,
+	-193814191,
+	-193668871,
+	-193523534,
+	-193378179,
+	-193232807,
+	-193087418,
+	-192942012,
+	-192796588,
+	-192651147,
+	-192505689,
+	-192360214,
+	-192214721,
+	-192069211,
+	-191923684,
+	-191778140,
+	-191632579,
+	-191487000,
+	-191341404,
+	-191195791,
+	-191050161,
+	-190904514,
+	-190758850,
+	-190613169,
+	-190467470,
+	-190321755,
+	-190176022,
+	-190030272,
+	-189884505,
+	-189738721,
+	-189592921,
+	-189447103,
+	-189301268,
+	-189155416,
+	-189009547,
+	-188863661,
+	-188717758,
+	-188571838,
+	-188425901,
+	-188279947,
+	-188133976,
+	-187987988,
+	-187841983,
+	-187695962,
+	-187549923,
+	-187403867,
+	-187257795,
+	-187111706,
+	-186965600,
+	-186819477,
+	-186673337,
+	-186527180,
+	-186381007,
+	-186234816,
+	-186088609,
+	-185942385,
+	-185796144,
+	-185649887,
+	-185503612,
+	-185357321,
+	-185211013,
+	-185064689,
+	-184918347,
+	-184771989,
+	-184625615,
+	-184479223,
+	-184332815,
+	-184186390,
+	-184039948,
+	-183893490,
+	-183747015,
+	-183600524,
+	-183454015,
+	-183307491,
+	-183160949,
+	-183014391,
+	-182867816,
+	-182721225,
+	-182574617,
+	-182427993,
+	-182281352,
+	-182134694,
+	-181988020,
+	-181841330,
+	-181694622,
+	-181547899,
+	-181401159,
+	-181254402,
+	-181107629,
+	-180960839,
+	-180814033,
+	-180667211,
+	-180520372,
+	-180373516,
+	-180226644,
+	-180079756,
+	-179932852,
+	-179785931,
+	-179638993,
+	-179492039,
+	-179345069,
+	-179198083,
+	-179051080,
+	-178904060,
+	-178757025,
+	-178609973,
+	-178462905,
+	-178315820,
+	-178168720,
+	-178021603,
+	-177874469,
+	-177727320,
+	-177580154,
+	-177432972,
+	-177285774,
+	-177138559,
+	-176991328,
+	-176844082,
+	-176696818,
+	-176549539,
+	-176402244,
+	-176254932,
+	-176107604,
+	-175960261,
+	-175812901,
+	-175665524,
+	-175518132,
+	-175370724,
+	-175223299,
+	-175075859,
+	-174928402,
+	-174780930,
+	-174633441,
+	-174485936,
+	-174338416,
+	-174190879,
+	-174043326,
+	-173895757,
+	-173748173,
+	-173600572,
+	-173452955,
+	-173305322,
+	-173157674,
+	-173010009,
+	-172862329,
+	-172714632,
+	-172566920,
+	-172419192,
+	-172271448,
+	-172123688,
+	-171975912,
+	-171828120,
+	-171680312,
+	-171532489,
+	-171384650,
+	-171236795,
+	-171088924,
+	-170941037,
+	-170793135,
+	-170645216,
+	-170497282,
+	-170349333,
+	-170201367,
+	-170053386,
+	-169905389,
+	-169757376,
+	-169609348,
+	-169461303,
+	-169313244,
+	-169165168,
+	-169017077,
+	-168868970,
+	-168720848,
+	-168572709,
+	-168424556,
+	-168276386,
+	-168128201,
+	-167980001,
+	-167831785,
+	-167683553,
+	-167535306,
+	-167387043,
+	-167238764,
+	-167090470,
+	-166942161,
+	-166793836,
+	-166645495,
+	-166497139,
+	-166348768,
+	-166200381,
+	-166051978,
+	-165903560,
+	-165755127,
+	-165606678,
+	-165458214,
+	-165309734,
+	-165161239,
+	-165012729,
+	-164864203,
+	-164715661,
+	-164567105,
+	-164418533,
+	-164269946,
+	-164121343,
+	-163972725,
+	-163824092,
+	-163675443,
+	-163526779,
+	-163378100,
+	-163229405,
+	-163080696,
+	-162931971,
+	-162783230,
+	-162634475,
+	-162485704,
+	-162336918,
+	-162188117,
+	-162039301,
+	-161890469,
+	-161741623,
+	-161592761,
+	-161443884,
+	-161294991,
+	-161146084,
+	-160997162,
+	-160848224,
+	-160699271,
+	-160550304,
+	-160401321,
+	-160252323,
+	-160103310,
+	-159954282,
+	-159805239,
+	-159656181,
+	-159507108,
+	-159358019,
+	-159208916,
+	-159059798,
+	-158910665,
+	-158761517,
+	-158612354,
+	-158463176,
+	-158313983,
+	-158164775,
+	-158015552,
+	-157866314,
+	-157717061,
+	-157567794,
+	-157418511,
+	-157269214,
+	-157119902,
+	-156970575,
+	-156821233,
+	-156671876,
+	-156522505,
+	-156373118,
+	-156223717,
+	-156074301,
+	-155924870,
+	-155775425,
+	-155625965,
+	-155476490,
+	-155327000,
+	-155177495,
+	-155027976,
+	-154878442,
+	-154728894,
+	-154579330,
+	-154429752,
+	-154280160,
+	-154130552,
+	-153980930,
+	-153831294,
+	-153681642,
+	-153531976,
+	-153382296,
+	-153232601,
+	-153082891,
+	-152933167,
+	-152783428,
+	-152633675,
+	-152483907,
+	-152334124,
+	-152184327,
+	-152034516,
+	-151884689,
+	-151734849,
+	-151584994,
+	-151435124,
+	-151285240,
+	-151135342,
+	-150985429,
+	-150835502,
+	-150685560,
+	-150535604,
+	-150385633,
+	-150235648,
+	-150085649,
+	-149935635,
+	-149785607,
+	-149635564,
+	-149485507,
+	-149335436,
+	-149185351,
+	-149035251,
+	-148885137,
+	-148735008,
+	-148584865,
+	-148434708,
+	-148284537,
+	-148134352,
+	-147984152,
+	-147833938,
+	-147683710,
+	-147533467,
+	-147383211,
+	-147232940,
+	-147082655,
+	-146932355,
+	-146782042,
+	-146631714,
+	-146481373,
+	-146331017,
+	-146180647,
+	-146030263,
+	-145879865,
+	-145729452,
+	-145579026,
+	-145428586,
+	-145278131,
+	-145127662,
+	-144977180,
+	-144826683,
+	-144676173,
+	-144525648,
+	-144375109,
+	-144224557,
+	-144073990,
+	-143923409,
+	-143772815,
+	-143622206,
+	-143471584,
+	-143320947,
+	-143170297,
+	-143019632,
+	-142868954,
+	-142718262,
+	-142567556,
+	-142416836,
+	-142266103,
+	-142115355,
+	-141964594,
+	-141813818,
+	-141663029,
+	-141512226,
+	-141361410,
+	-141210579,
+	-141059735,
+	-140908877,
+	-140758005,
+	-140607120,
+	-140456220,
+	-140305307,
+	-140154381,
+	-140003440,
+	-139852486,
+	-139701518,
+	-139550536,
+	-139399541,
+	-139248532,
+	-139097510,
+	-138946474,
+	-138795424,
+	-138644360,
+	-138493283,
+	-138342193,
+	-138191088,
+	-138039970,
+	-137888839,
+	-137737694,
+	-137586536,
+	-137435364,
+	-137284178,
+	-137132979,
+	-136981766,
+	-136830540,
+	-136679300,
+	-136528047,
+	-136376781,
+	-136225501,
+	-136074207,
+	-135922900,
+	-135771580,
+	-135620246,
+	-135468899,
+	-135317538,
+	-135166164,
+	-135014777,
+	-134863376,
+	-134711962,
+	-134560534,
+	-134409093,
+	-134257639,
+	-134106172,
+	-133954691,
+	-133803197,
+	-133651689,
+	-133500168,
+	-133348634,
+	-133197087,
+	-133045527,
+	-132893953,
+	-132742366,
+	-132590766,
+	-132439152,
+	-132287526,
+	-132135886,
+	-131984233,
+	-131832567,
+	-131680887,
+	-131529195,
+	-131377489,
+	-131225770,
+	-131074038,
+	-130922293,
+	-130770535,
+	-130618764,
+	-130466980,
+	-130315182,
+	-130163372,
+	-130011548,
+	-129859712,
+	-129707862,
+	-129556000,
+	-129404124,
+	-129252235,
+	-129100334,
+	-128948419,
+	-128796491,
+	-128644551,
+	-128492597,
+	-128340631,
+	-128188651,
+	-128036659,
+	-127884654,
+	-127732636,
+	-127580604,
+	-127428561,
+	-127276504,
+	-127124434,
+	-126972351,
+	-126820256,
+	-126668148,
+	-126516027,
+	-126363893,
+	-126211746,
+	-126059586,
+	-125907414,
+	-125755229,
+	-125603031,
+	-125450820,
+	-125298597,
+	-125146361,
+	-124994112,
+	-124841850,
+	-124689576,
+	-124537289,
+	-124384989,
+	-124232677,
+	-124080352,
+	-123928014,
+	-123775664,
+	-123623301,
+	-123470925,
+	-123318537,
+	-123166136,
+	-123013722,
+	-122861296,
+	-122708858,
+	-122556406,
+	-122403943,
+	-122251466,
+	-122098977,
+	-121946476,
+	-121793962,
+	-121641435,
+	-121488896,
+	-121336345,
+	-121183781,
+	-121031204,
+	-120878615,
+	-120726014,
+	-120573400,
+	-120420773,
+	-120268135,
+	-120115484,
+	-119962820,
+	-119810144,
+	-119657456,
+	-119504755,
+	-119352042,
+	-119199316,
+	-119046578,
+	-118893828,
+	-118741065,
+	-118588291,
+	-118435503,
+	-118282704,
+	-118129892,
+	-117977068,
+	-117824232,
+	-117671383,
+	-117518522,
+	-117365649,
+	-117212764,
+	-117059866,
+	-116906956,
+	-116754034,
+	-116601100,
+	-116448153,
+	-116295195,
+	-116142224,
+	-115989241,
+	-115836246,
+	-115683239,
+	-115530219,
+	-115377188,
+	-115224144,
+	-115071088,
+	-114918021,
+	-114764941,
+	-114611849,
+	-114458745,
+	-114305628,
+	-114152500,
+	-113999360,
+	-113846208,
+	-113693043,
+	-113539867,
+	-113386679,
+	-113233479,
+	-113080266,
+	-112927042,
+	-112773806,
+	-112620558,
+	-112467298,
+	-112314026,
+	-112160742,
+	-112007446,
+	-111854138,
+	-111700818,
+	-111547487,
+	-111394143,
+	-111240788,
+	-111087421,
+	-110934042,
+	-110780651,
+	-110627248,
+	-110473833,
+	-110320407,
+	-110166969,
+	-110013519,
+	-109860057,
+	-109706584,
+	-109553098,
+	-109399601,
+	-109246092,
+	-109092572,
+	-108939039,
+	-108785495,
+	-108631940,
+	-108478372,
+	-108324793,
+	-108171202,
+	-108017600,
+	-107863986,
+	-107710360,
+	-107556722,
+	-107403073,
+	-107249413,
+	-107095740,
+	-106942056,
+	-106788361,
+	-106634654,
+	-106480935,
+	-106327205,
+	-106173463,
+	-106019709,
+	-105865944,
+	-105712168,
+	-105558380,
+	-105404580,
+	-105250769,
+	-105096947,
+	-104943112,
+	-104789267,
+	-104635410,
+	-104481541,
+	-104327661,
+	-104173770,
+	-104019867,
+	-103865953,
+	-103712027,
+	-103558090,
+	-103404142,
+	-103250182,
+	-103096211,
+	-102942228,
+	-102788234,
+	-102634229,
+	-102480212,
+	-102326184,
+	-102172144,
+	-102018094,
+	-101864032,
+	-101709958,
+	-101555874,
+	-101401778,
+	-101247671,
+	-101093552,
+	-100939423,
+	-100785282,
+	-100631130,
+	-100476966,
+	-100322792,
+	-100168606,
+	-100014409,
+	-99860201,
+	-99705981,
+	-99551751,
+	-99397509,
+	-99243256,
+	-99088992,
+	-98934717,
+	-98780430,
+	-98626133,
+	-98471824,
+	-98317504,
+	-98163174,
+	-98008832,
+	-97854479,
+	-97700115,
+	-97545740,
+	-97391354,
+	-97236956,
+	-97082548,
+	-96928129,
+	-96773699,
+	-96619258,
+	-96464805,
+	-96310342,
+	-96155868,
+	-96001383,
+	-95846886,
+	-95692379,
+	-95537861,
+	-95383332,
+	-95228792,
+	-95074241,
+	-94919680,
+	-94765107,
+	-94610523,
+	-94455929,
+	-94301324,
+	-94146707,
+	-93992080,
+	-93837442,
+	-93682794,
+	-93528134,
+	-93373463,
+	-93218782,
+	-93064090,
+	-92909387,
+	-92754674,
+	-92599949,
+	-92445214,
+	-92290468,
+	-92135711,
+	-91980944,
+	-91826166,
+	-91671377,
+	-91516577,
+	-91361767,
+	-91206946,
+	-91052114,
+	-90897271,
+	-90742418,
+	-90587554,
+	-90432680,
+	-90277795,
+	-90122899,
+	-89967992,
+	-89813075,
+	-89658148,
+	-89503209,
+	-89348260,
+	-89193301,
+	-89038331,
+	-88883350,
+	-88728359,
+	-88573357,
+	-88418345,
+	-88263322,
+	-88108288,
+	-87953245,
+	-87798190,
+	-87643125,
+	-87488050,
+	-87332964,
+	-87177867,
+	-87022760,
+	-86867643,
+	-86712515,
+	-86557376,
+	-86402228,
+	-86247068,
+	-86091899,
+	-85936719,
+	-85781528,
+	-85626327,
+	-85471116,
+	-85315894,
+	-85160662,
+	-85005420,
+	-84850167,
+	-84694904,
+	-84539630,
+	-84384346,
+	-84229052,
+	-84073748,
+	-83918433,
+	-83763108,
+	-83607772,
+	-83452427,
+	-83297071,
+	-83141704,
+	-82986328,
+	-82830941,
+	-82675544,
+	-82520137,
+	-82364719,
+	-82209292,
+	-82053854,
+	-81898405,
+	-81742947,
+	-81587479,
+	-81432000,
+	-81276511,
+	-81121012,
+	-80965503,
+	-80809983,
+	-80654454,
+	-80498914,
+	-80343364,
+	-80187804,
+	-80032234,
+	-79876654,
+	-79721064,
+	-79565463,
+	-79409853,
+	-79254232,
+	-79098602,
+	-78942961,
+	-78787310,
+	-78631650,
+	-78475979,
+	-78320298,
+	-78164607,
+	-78008907,
+	-77853196,
+	-77697475,
+	-77541744,
+	-77386003,
+	-77230253,
+	-77074492,
+	-76918721,
+	-76762941,
+	-76607150,
+	-76451350,
+	-76295539,
+	-76139719,
+	-75983889,
+	-75828048,
+	-75672198,
+	-75516338,
+	-75360469,
+	-75204589,
+	-75048699,
+	-74892800,
+	-74736891,
+	-74580971,
+	-74425043,
+	-74269104,
+	-74113155,
+	-73957197,
+	-73801229,
+	-73645251,
+	-73489263,
+	-73333265,
+	-73177258,
+	-73021241,
+	-72865214,
+	-72709177,
+	-72553131,
+	-72397075,
+	-72241009,
+	-72084933,
+	-71928848,
+	-71772753,
+	-71616648,
+	-71460534,
+	-71304410,
+	-71148276,
+	-70992133,
+	-70835980,
+	-70679817,
+	-70523645,
+	-70367463,
+	-70211271,
+	-70055070,
+	-69898859,
+	-69742639,
+	-69586408,
+	-69430169,
+	-69273920,
+	-69117661,
+	-68961392,
+	-68805114,
+	-68648827,
+	-68492530,
+	-68336223,
+	-68179907,
+	-68023581,
+	-67867246,
+	-67710901,
+	-67554547,
+	-67398183,
+	-67241810,
+	-67085427,
+	-66929035,
+	-66772633,
+	-66616222,
+	-66459801,
+	-66303371,
+	-66146931,
+	-65990482,
+	-65834024,
+	-65677556,
+	-65521079,
+	-65364592,
+	-65208096,
+	-65051591,
+	-64895076,
+	-64738552,
+	-64582018,
+	-64425475,
+	-64268923,
+	-64112361,
+	-63955790,
+	-63799210,
+	-63642620,
+	-63486021,
+	-63329412,
+	-63172795,
+	-63016168,
+	-62859531,
+	-62702886,
+	-62546231,
+	-62389567,
+	-62232893,
+	-62076211,
+	-61919519,
+	-61762818,
+	-61606107,
+	-61449388,
+	-61292659,
+	-61135921,
+	-60979173,
+	-60822417,
+	-60665651,
+	-60508876,
+	-60352092,
+	-60195298,
+	-60038496,
+	-59881684,
+	-59724863,
+	-59568033,
+	-59411194,
+	-59254346,
+	-59097488,
+	-58940622,
+	-58783746,
+	-58626861,
+	-58469968,
+	-58313064,
+	-58156152,
+	-57999231,
+	-57842301,
+	-57685361,
+	-57528413,
+	-57371455,
+	-57214489,
+	-57057513,
+	-56900529,
+	-56743535,
+	-56586532,
+	-56429520,
+	-56272499,
+	-56115470,
+	-55958431,
+	-55801383,
+	-55644326,
+	-55487260,
+	-55330186,
+	-55173102,
+	-55016009,
+	-54858907,
+	-54701797,
+	-54544677,
+	-54387549,
+	-54230411,
+	-54073265,
+	-53916109,
+	-53758945,
+	-53601772,
+	-53444590,
+	-53287399,
+	-53130199,
+	-52972990,
+	-52815772,
+	-52658546,
+	-52501310,
+	-52344066,
+	-52186813,
+	-52029551,
+	-51872280,
+	-51715000,
+	-51557712,
+	-51400415,
+	-51243108,
+	-51085793,
+	-50928470,
+	-50771137,
+	-50613796,
+	-50456445,
+	-50299086,
+	-50141719,
+	-49984342,
+	-49826957,
+	-49669563,
+	-49512160,
+	-49354748,
+	-49197328,
+	-49039899,
+	-48882461,
+	-48725015,
+	-48567560,
+	-48410096,
+	-48252623,
+	-48095142,
+	-47937652,
+	-47780153,
+	-47622645,
+	-47465129,
+	-47307605,
+	-47150071,
+	-46992529,
+	-46834978,
+	-46677419,
+	-46519851,
+	-46362274,
+	-46204689,
+	-46047095,
+	-45889492,
+	-45731881,
+	-45574261,
+	-45416632,
+	-45258995,
+	-45101350,
+	-44943696,
+	-44786033,
+	-44628361,
+	-44470681,
+	-44312993,
+	-44155296,
+	-43997590,
+	-43839876,
+	-43682153,
+	-43524422,
+	-43366682,
+	-43208934,
+	-43051177,
+	-42893411,
+	-42735637,
+	-42577855,
+	-42420064,
+	-42262264,
+	-42104457,
+	-41946640,
+	-41788815,
+	-41630982,
+	-41473140,
+	-41315290,
+	-41157431,
+	-40999564,
+	-40841688,
+	-40683804,
+	-40525911,
+	-40368010,
+	-40210101,
+	-40052183,
+	-39894257,
+	-39736322,
+	-39578379,
+	-39420427,
+	-39262468,
+	-39104499,
+	-38946523,
+	-38788538,
+	-38630544,
+	-38472542,
+	-38314532,
+	-38156514,
+	-37998487,
+	-37840451,
+	-37682408,
+	-37524356,
+	-37366296,
+	-37208227,
+	-37050150,
+	-36892065,
+	-36733971,
+	-36575869,
+	-36417759,
+	-36259641,
+	-36101514,
+	-35943379,
+	-35785235,
+	-35627083,
+	-35468924,
+	-35310755,
+	-35152579,
+	-34994394,
+	-34836201,
+	-34678000,
+	-34519790,
+	-34361572,
+	-34203346,
+	-34045112,
+	-33886870,
+	-33728619,
+	-33570360,
+	-33412093,
+	-33253817,
+	-33095534,
+	-32937242,
+	-32778942,
+	-32620634,
+	-32462317,
+	-32303993,
+	-32145660,
+	-31987319,
+	-31828970,
+	-31670613,
+	-31512247,
+	-31353874,
+	-31195492,
+	-31037102,
+	-30878704,
+	-30720298,
+	-30561883,
+	-30403461,
+	-30245030,
+	-30086592,
+	-29928145,
+	-29769690,
+	-29611227,
+	-29452755,
+	-29294276,
+	-29135789,
+	-28977293,
+	-28818790,
+	-28660278,
+	-28501758,
+	-28343231,
+	-28184695,
+	-28026151,
+	-27867599,
+	-27709039,
+	-27550470,
+	-27391894,
+	-27233310,
+	-27074718,
+	-26916117,
+	-26757509,
+	-26598893,
+	-26440268,
+	-26281636,
+	-26122995,
+	-25964347,
+	-25805690,
+	-25647026,
+	-25488353,
+	-25329673,
+	-25170984,
+	-25012288,
+	-24853583,
+	-24694871,
+	-24536151,
+	-24377422,
+	-24218686,
+	-24059941,
+	-23901189,
+	-23742429,
+	-23583660,
+	-23424884,
+	-23266100,
+	-23107308,
+	-22948508,
+	-22789700,
+	-22630884,
+	-22472060,
+	-22313228,
+	-22154389,
+	-21995541,
+	-21836685,
+	-21677822,
+	-21518951,
+	-21360071,
+	-21201184,
+	-21042289,
+	-20883386,
+	-20724475,
+	-20565556,
+	-20406630,
+	-20247695,
+	-20088753,
+	-19929803,
+	-19770844,
+	-19611878,
+	-19452905,
+	-19293923,
+	-19134933,
+	-18975936,
+	-18816930,
+	-18657917,
+	-18498896,
+	-18339867,
+	-18180831,
+	-18021786,
+	-17862734,
+	-17703674,
+	-17544606,
+	-17385530,
+	-17226446,
+	-17067355,
+	-16908256,
+	-16749148,
+	-16590034,
+	-16430911,
+	-16271780,
+	-16112642,
+	-15953496,
+	-15794342,
+	-15635181,
+	-15476011,
+	-15316834,
+	-15157649,
+	-14998456,
+	-14839256,
+	-14680047,
+	-14520831,
+	-14361607,
+	-14202376,
+	-14043136,
+	-13883889,
+	-13724635,
+	-13565372,
+	-13406102,
+	-13246823,
+	-13087538,
+	-12928244,
+	-12768943,
+	-12609634,
+	-12450317,
+	-12290992,
+	-12131660,
+	-11972320,
+	-11812973,
+	-11653617,
+	-11494254,
+	-11334883,
+	-11175505,
+	-11016119,
+	-10856725,
+	-10697323,
+	-10537914,
+	-10378497,
+	-10219072,
+	-10059640,
+	-9900200,
+	-9740752,
+	-9581297,
+	-9421834,
+	-9262363,
+	-9102884,
+	-8943398,
+	-8783904,
+	-8624403,
+	-8464894,
+	-8305377,
+	-8145853,
+	-7986320,
+	-7826781,
+	-7667233,
+	-7507678,
+	-7348116,
+	-7188545,
+	-7028967,
+	-6869382,
+	-6709788,
+	-6550187,
+	-6390579,
+	-6230963,
+	-6071339,
+	-5911707,
+	-5752068,
+	-5592422,
+	-5432767,
+	-5273105,
+	-5113436,
+	-4953759,
+	-4794074,
+	-4634381,
+	-4474681,
+	-4314974,
+	-4155259,
+	-3995536,
+	-3835805,
+	-3676067,
+	-3516322,
+	-3356569,
+	-3196808,
+	-3037039,
+	-2877263,
+	-2717480,
+	-2557689,
+	-2397890,
+	-2238084,
+	-2078270,
+	-1918448,
+	-1758619,
+	-1598783,
+	-1438938,
+	-1279087,
+	-1119227,
+	-959360,
+	-799486,
+	-639604,
+	-479714,
+	-319817,
+	-159912,
+	0,
+	159920,
+	319847,
+	479782,
+	639725,
+	799675,
+	959633,
+	1119598,
+	1279571,
+	1439551,
+	1599539,
+	1759534,
+	1919537,
+	2079548,
+	2239566,
+	2399592,
+	2559625,
+	2719666,
+	2879715,
+	3039771,
+	3199834,
+	3359906,
+	3519984,
+	3680071,
+	3840165,
+	4000266,
+	4160376,
+	4320492,
+	4480617,
+	4640748,
+	4800888,
+	4961035,
+	5121190,
+	5281352,
+	5441522,
+	5601699,
+	5761884,
+	5922077,
+	6082277,
+	6242485,
+	6402701,
+	6562924,
+	6723154,
+	6883392,
+	7043638,
+	7203892,
+	7364153,
+	7524421,
+	7684698,
+	7844982,
+	8005273,
+	8165572,
+	8325879,
+	8486193,
+	8646515,
+	8806845,
+	8967182,
+	9127527,
+	9287879,
+	9448239,
+	9608607,
+	9768982,
+	9929365,
+	10089755,
+	10250154,
+	10410559,
+	10570973,
+	10731394,
+	10891822,
+	11052259,
+	11212703,
+	11373154,
+	11533613,
+	11694080,
+	11854555,
+	12015037,
+	12175527,
+	12336024,
+	12496529,
+	12657042,
+	12817562,
+	12978090,
+	13138626,
+	13299169,
+	13459720,
+	13620278,
+	13780844,
+	13941418,
+	14102000,
+	14262589,
+	14423186,
+	14583790,
+	14744402,
+	14905022,
+	15065649,
+	15226284,
+	15386927,
+	15547578,
+	15708236,
+	15868901,
+	16029575,
+	16190256,
+	16350945,
+	16511641,
+	16672345,
+	16833057,
+	16993776,
+	17154503,
+	17315238,
+	17475980,
+	17636731,
+	17797488,
+	17958254,
+	18119027,
+	18279808,
+	18440596,
+	18601392,
+	18762196,
+	18923008,
+	19083827,
+	19244654,
+	19405489,
+	19566331,
+	19727181,
+	19888039,
+	20048904,
+	20209777,
+	20370658,
+	20531546,
+	20692442,
+	20853346,
+	21014258,
+	21175177,
+	21336104,
+	21497039,
+	21657981,
+	21818931,
+	21979889,
+	22140854,
+	22301827,
+	22462808,
+	22623797,
+	22784793,
+	22945797,
+	23106809,
+	23267828,
+	23428856,
+	23589890,
+	23750933,
+	23911983,
+	24073041,
+	24234107,
+	24395181,
+	24556262,
+	24717351,
+	24878447,
+	25039552,
+	25200664,
+	25361784,
+	25522911,
+	25684047,
+	25845190,
+	26006340,
+	26167499,
+	26328665,
+	26489839,
+	26651021,
+	26812210,
+	26973408,
+	27134612,
+	27295825,
+	27457046,
+	27618274,
+	27779510,
+	27940753,
+	28102005,
+	28263264,
+	28424531,
+	28585805,
+	28747088,
+	28908378,
+	29069676,
+	29230982,
+	29392295,
+	29553616,
+	29714945,
+	29876282,
+	30037626,
+	30198978,
+	30360338,
+	30521706,
+	30683082,
+	30844465,
+	31005856,
+	31167255,
+	31328661,
+	31490076,
+	31651498,
+	31812928,
+	31974366,
+	32135811,
+	32297264,
+	32458725,
+	32620194,
+	32781671,
+	32943155,
+	33104647,
+	33266147,
+	33427655,
+	33589170,
+	33750694,
+	33912225,
+	34073763,
+	34235310,
+	34396865,
+	34558427,
+	34719997,
+	34881575,
+	35043160,
+	35204754,
+	35366355,
+	35527964,
+	35689581,
+	35851205,
+	36012838,
+	36174478,
+	36336126,
+	36497782,
+	36659446,
+	36821117,
+	36982796,
+	37144483,
+	37306178,
+	37467881,
+	37629591,
+	37791310,
+	37953036,
+	38114770,
+	38276512,
+	38438261,
+	38600019,
+	38761784,
+	38923557,
+	39085338,
+	39247127,
+	39408923,
+	39570727,
+	39732540,
+	39894360,
+	40056188,
+	40218023,
+	40379867,
+	40541718,
+	40703577,
+	40865444,
+	41027319,
+	41189202,
+	41351092,
+	41512991,
+	41674897,
+	41836811,
+	41998733,
+	42160663,
+	42322600,
+	42484546,
+	42646499,
+	42808460,
+	42970429,
+	43132406,
+	43294391,
+	43456384,
+	43618384,
+	43780392,
+	43942408,
+	44104433,
+	44266464,
+	44428504,
+	44590552,
+	44752607,
+	44914670,
+	45076742,
+	45238821,
+	45400908,
+	45563002,
+	45725105,
+	45887216,
+	46049334,
+	46211460,
+	46373595,
+	46535737,
+	46697887,
+	46860044,
+	47022210,
+	47184384,
+	47346565,
+	47508754,
+	47670952,
+	47833157,
+	47995370,
+	48157591,
+	48319819,
+	48482056,
+	48644301,
+	48806553,
+	48968813,
+	49131082,
+	49293358,
+	49455642,
+	49617934,
+	49780233,
+	49942541,
+	50104857,
+	50267180,
+	50429512,
+	50591851,
+	50754198,
+	50916554,
+	51078917,
+	51241288,
+	51403666,
+	51566053,
+	51728448,
+	51890851,
+	52053261,
+	52215680,
+	52378106,
+	52540540,
+	52702983,
+	52865433,
+	53027891,
+	53190357,
+	53352831,
+	53515312,
+	53677802,
+	53840300,
+	54002806,
+	54165319,
+	54327841,
+	54490370,
+	54652907,
+	54815453,
+	54978006,
+	55140567,
+	55303136,
+	55465713,
+	55628298,
+	55790891,
+	55953492,
+	56116101,
+	56278718,
+	56441342,
+	56603975,
+	56766616,
+	56929264,
+	57091921,
+	57254585,
+	57417258,
+	57579938,
+	57742626,
+	57905323,
+	58068027,
+	58230739,
+	58393459,
+	58556188,
+	58718924,
+	58881668,
+	59044420,
+	59207180,
+	59369948,
+	59532724,
+	59695508,
+	59858299,
+	60021099,
+	60183907,
+	60346723,
+	60509547,
+	60672379,
+	60835218,
+	60998066,
+	61160922,
+	61323785,
+	61486657,
+	61649537,
+	61812424,
+	61975320,
+	62138224,
+	62301135,
+	62464055,
+	62626982,
+	62789918,
+	62952862,
+	63115813,
+	63278773,
+	63441740,
+	63604716,
+	63767699,
+	63930691,
+	64093691,
+	64256698,
+	64419714,
+	64582737,
+	64745769,
+	64908808,
+	65071856,
+	65234912,
+	65397975,
+	65561047,
+	65724127,
+	65887214,
+	66050310,
+	66213414,
+	66376525,
+	66539645,
+	66702773,
+	66865909,
+	67029053,
+	67192204,
+	67355364,
+	67518532,
+	67681708,
+	67844892,
+	68008084,
+	68171284,
+	68334492,
+	68497708,
+	68660932,
+	68824165,
+	68987405,
+	69150653,
+	69313909,
+	69477174,
+	69640446,
+	69803726,
+	69967015,
+	70130311,
+	70293616,
+	70456928,
+	70620249,
+	70783578,
+	70946914,
+	71110259,
+	71273612,
+	71436973,
+	71600342,
+	71763719,
+	71927104,
+	72090497,
+	72253898,
+	72417308,
+	72580725,
+	72744150,
+	72907584,
+	73071025,
+	73234475,
+	73397933,
+	73561399,
+	73724872,
+	73888354,
+	74051844,
+	74215342,
+	74378848,
+	74542363,
+	74705885,
+	74869415,
+	75032954,
+	75196500,
+	75360055,
+	75523617,
+	75687188,
+	75850767,
+	76014354,
+	76177949,
+	76341552,
+	76505164,
+	76668783,
+	76832410,
+	76996046,
+	77159689,
+	77323341,
+	77487001,
+	77650669,
+	77814345,
+	77978029,
+	78141721,
+	78305422,
+	78469130,
+	78632847,
+	78796571,
+	78960304,
+	79124045,
+	79287794,
+	79451551,
+	79615316,
+	79779090,
+	79942871,
+	80106661,
+	80270458,
+	80434264,
+	80598078,
+	80761900,
+	80925730,
+	81089569,
+	81253415,
+	81417270,
+	81581133,
+	81745003,
+	81908882,
+	82072770,
+	82236665,
+	82400568,
+	82564480,
+	82728399,
+	82892327,
+	83056263,
+	83220207,
+	83384159,
+	83548120,
+	83712088,
+	83876065,
+	84040050,
+	84204043,
+	84368044,
+	84532053,
+	84696071,
+	84860096,
+	85024130,
+	85188172,
+	85352222,
+	85516280,
+	85680346,
+	85844421,
+	86008504,
+	86172594,
+	86336694,
+	86500801,
+	86664916,
+	86829040,
+	86993171,
+	87157311,
+	87321459,
+	87485615,
+	87649780,
+	87813952,
+	87978133,
+	88142322,
+	88306519,
+	88470724,
+	88634938,
+	88799160,
+	88963389,
+	89127627,
+	89291874,
+	89456128,
+	89620391,
+	89784661,
+	89948940,
+	90113228,
+	90277523,
+	90441827,
+	90606138,
+	90770458,
+	90934786,
+	91099123,
+	91263467,
+	91427820,
+	91592181,
+	91756550,
+	91920928,
+	92085313,
+	92249707,
+	92414109,
+	92578519,
+	92742938,
+	92907364,
+	93071799,
+	93236242,
+	93400694,
+	93565153,
+	93729621,
+	93894097,
+	94058581,
+	94223073,
+	94387574,
+	94552083,
+	94716600,
+	94881125,
+	95045659,
+	95210201,
+	95374751,
+	95539309,
+	95703875,
+	95868450,
+	96033033,
+	96197624,
+	96362224,
+	96526831,
+	96691447,
+	96856072,
+	97020704,
+	97185345,
+	97349994,
+	97514651,
+	97679316,
+	97843990,
+	98008672,
+	98173362,
+	98338060,
+	98502767,
+	98667482,
+	98832205,
+	98996937,
+	99161676,
+	99326424,
+	99491181,
+	99655945,
+	99820718,
+	99985499,
+	100150288,
+	100315086,
+	100479892,
+	100644706,
+	100809528,
+	100974359,
+	101139198,
+	101304045,
+	101468901,
+	101633764,
+	101798636,
+	101963517,
+	102128405,
+	102293302,
+	102458208,
+	102623121,
+	102788043,
+	102952973,
+	103117911,
+	103282858,
+	103447813,
+	103612776,
+	103777748,
+	103942728,
+	104107716,
+	104272712,
+	104437717,
+	104602730,
+	104767751,
+	104932781,
+	105097819,
+	105262865,
+	105427920,
+	105592983,
+	105758054,
+	105923133,
+	106088221,
+	106253317,
+	106418422,
+	106583535,
+	106748656,
+	106913785,
+	107078923,
+	107244069,
+	107409223,
+	107574386,
+	107739557,
+	107904737,
+	108069924,
+	108235120,
+	108400325,
+	108565537,
+	108730758,
+	108895988,
+	109061226,
+	109226472,
+	109391726,
+	109556989,
+	109722260,
+	109887539,
+	110052827,
+	110218123,
+	110383427,
+	110548740,
+	110714061,
+	110879391,
+	111044729,
+	111210075,
+	111375429,
+	111540792,
+	111706164,
+	111871543,
+	112036931,
+	112202328,
+	112367732,
+	112533145,
+	112698567,
+	112863997,
+	113029435,
+	113194881,
+	113360336,
+	113525799,
+	113691271,
+	113856751,
+	114022239,
+	114187736,
+	114353241,
+	114518755,
+	114684277,
+	114849807,
+	115015346,
+	115180893,
+	115346448,
+	115512012,
+	115677584,
+	115843165,
+	116008754,
+	116174351,
+	116339957,
+	116505571,
+	116671194,
+	116836825,
+	117002464,
+	117168112,
+	117333768,
+	117499433,
+	117665106,
+	117830787,
+	117996477,
+	118162175,
+	118327881,
+	118493596,
+	118659320,
+	118825052,
+	118990792,
+	119156541,
+	119322298,
+	119488063,
+	119653837,
+	119819619,
+	119985410,
+	120151209,
+	120317017,
+	120482833,
+	120648657,
+	120814490,
+	120980331,
+	121146181,
+	121312039,
+	121477906,
+	121643781,
+	121809664,
+	121975556,
+	122141456,
+	122307365,
+	122473282,
+	122639208,
+	122805142,
+	122971085,
+	123137036,
+	123302995,
+	123468963,
+	123634939,
+	123800924,
+	123966917,
+	124132919,
+	124298929,
+	124464948,
+	124630975,
+	124797010,
+	124963054,
+	125129106,
+	125295167,
+	125461237,
+	125627315,
+	125793401,
+	125959496,
+	126125599,
+	126291710,
+	126457831,
+	126623959,
+	126790096,
+	126956242,
+	127122396,
+	127288558,
+	127454729,
+	127620909,
+	127787097,
+	127953293,
+	128119498,
+	128285712,
+	128451934,
+	128618164,
+	128784403,
+	128950650,
+	129116906,
+	129283170,
+	129449443,
+	129615725,
+	129782014,
+	129948313,
+	130114620,
+	130280935,
+	130447259,
+	130613591,
+	130779932,
+	130946281,
+	131112639,
+	131279006,
+	131445380,
+	131611764,
+	131778156,
+	131944556,
+	132110965,
+	132277383,
+	132443809,
+	132610243,
+	132776686,
+	132943138,
+	133109598,
+	133276066,
+	133442543,
+	133609029,
+	133775523,
+	133942026,
+	134108537,
+	134275057,
+	134441585,
+	134608122,
+	134774667,
+	134941221,
+	135107784,
+	135274355,
+	135440934,
+	135607522,
+	135774119,
+	135940724,
+	136107338,
+	136273960,
+	136440591,
+	136607230,
+	136773878,
+	136940534,
+	137107199,
+	137273873,
+	137440555,
+	137607246,
+	137773945,
+	137940653,
+	138107369,
+	138274094,
+	138440827,
+	138607569,
+	138774320,
+	138941079,
+	139107847,
+	139274623,
+	139441408,
+	139608202,
+	139775004,
+	139941814,
+	140108634,
+	140275461,
+	140442298,
+	140609143,
+	140775996,
+	140942858,
+	141109729,
+	141276608,
+	141443496,
+	141610393,
+	141777298,
+	141944212,
+	142111134,
+	142278065,
+	142445004,
+	142611952,
+	142778909,
+	142945874,
+	143112848,
+	143279830,
+	143446821,
+	143613821,
+	143780829,
+	143947846,
+	144114872,
+	144281906,
+	144448949,
+	144616000,
+	144783060,
+	144950128,
+	145117206,
+	145284291,
+	145451386,
+	145618489,
+	145785600,
+	145952721,
+	146119850,
+	146286987,
+	146454133,
+	146621288,
+	146788452,
+	146955624,
+	147122804,
+	147289994,
+	147457192,
+	147624398,
+	147791614,
+	147958838,
+	148126070,
+	148293311,
+	148460561,
+	148627820,
+	148795087,
+	148962362,
+	149129647,
+	149296940,
+	149464242,
+	149631552,
+	149798871,
+	149966199,
+	150133535,
+	150300880,
+	150468234,
+	150635596,
+	150802967,
+	150970347,
+	151137735,
+	151305132,
+	151472538,
+	151639952,
+	151807375,
+	151974807,
+	152142247,
+	152309696,
+	152477154,
+	152644620,
+	152812095,
+	152979579,
+	153147072,
+	153314573,
+	153482082,
+	153649601,
+	153817128,
+	153984664,
+	154152209,
+	154319762,
+	154487324,
+	154654894,
+	154822474,
+	154990062,
+	155157658,
+	155325264,
+	155492878,
+	155660501,
+	155828132,
+	155995773,
+	156163422,
+	156331079,
+	156498746,
+	156666421,
+	156834105,
+	157001797,
+	157169498,
+	157337208,
+	157504927,
+	157672654,
+	157840390,
+	158008135,
+	158175889,
+	158343651,
+	158511422,
+	158679202,
+	158846990,
+	159014787,
+	159182593,
+	159350408,
+	159518231,
+	159686063,
+	159853904,
+	160021754,
+	160189612,
+	160357479,
+	160525355,
+	160693240,
+	160861133,
+	161029035,
+	161196946,
+	161364865,
+	161532794,
+	161700731,
+	161868676,
+	162036631,
+	162204594,
+	162372566,
+	162540547,
+	162708537,
+	162876535,
+	163044542,
+	163212558,
+	163380583,
+	163548616,
+	163716658,
+	163884709,
+	164052769,
+	164220838,
+	164388915,
+	164557001,
+	164725096,
+	164893199,
+	165061312,
+	165229433,
+	165397563,
+	165565701,
+	165733849,
+	165902005,
+	166070170,
+	166238344,
+	166406527,
+	166574718,
+	166742919,
+	166911128,
+	167079345,
+	167247572,
+	167415807,
+	167584052,
+	167752305,
+	167920567,
+	168088837,
+	168257117,
+	168425405,
+	168593702,
+	168762008,
+	168930323,
+	169098646,
+	169266978,
+	169435319,
+	169603669,
+	169772028,
+	169940396,
+	170108772,
+	170277157,
+	170445551,
+	170613954,
+	170782366,
+	170950787,
+	171119216,
+	171287654,
+	171456101,
+	171624557,
+	171793022,
+	171961495,
+	172129978,
+	172298469,
+	172466969,
+	172635478,
+	172803995,
+	172972522,
+	173141057,
+	173309602,
+	173478155,
+	173646717,
+	173815287,
+	173983867,
+	174152456,
+	174321053,
+	174489659,
+	174658274,
+	174826898,
+	174995531,
+	175164173,
+	175332823,
+	175501483,
+	175670151,
+	175838828,
+	176007514,
+	176176209,
+	176344913,
+	176513625,
+	176682347,
+	176851077,
+	177019817,
+	177188565,
+	177357322,
+	177526088,
+	177694862,
+	177863646,
+	178032439,
+	178201240,
+	178370050,
+	178538870,
+	178707698,
+	178876535,
+	179045381,
+	179214235,
+	179383099,
+	179551972,
+	179720853,
+	179889744,
+	180058643,
+	180227551,
+	180396468,
+	180565394,
+	180734329,
+	180903273,
+	181072226,
+	181241187,
+	181410158,
+	181579137,
+	181748126,
+	181917123,
+	182086129,
+	182255145,
+	182424169,
+	182593202,
+	182762244,
+	182931294,
+	183100354,
+	183269423,
+	183438501,
+	183607587,
+	183776683,
+	183945787,
+	184114901,
+	184284023,
+	184453154,
+	184622295,
+	184791444,
+	184960602,
+	185129769,
+	185298945,
+	185468130,
+	185637324,
+	185806527,
+	185975738,
+	186144959,
+	186314189,
+	186483427,
+	186652675,
+	186821932,
+	186991197,
+	187160472,
+	187329755,
+	187499048,
+	187668349,
+	187837659,
+	188006979,
+	188176307,
+	188345644,
+	188514991,
+	188684346,
+	188853710,
+	189023083,
+	189192466,
+	189361857,
+	189531257,
+	189700666,
+	189870084,
+	190039511,
+	190208947,
+	190378392,
+	190547846,
+	190717309,
+	190886782,
+	191056263,
+	191225753,
+	191395252,
+	191564760,
+	191734277,
+	191903803,
+	192073338,
+	192242882,
+	192412435,
+	192581997,
+	192751568,
+	192921148,
+	193090737,
+	193260336,
+	193429943,
+	193599559,
+	193769184,
+	193938818,
+	194108461,
+	194278114,
+	194447775,
+	194617445,
+	194787125,
+	194956813,
+	195126510,
+	195296217,
+	195465932,
+	195635657,
+	195805390,
+	195975133,
+	196144884,
+	196314645,
+	196484415,
+	196654193,
+	196823981,
+	196993778,
+	197163584,
+	197333399,
+	197503222,
+	197673055,
+	197842898,
+	198012749,
+	198182609,
+	198352478,
+	198522356,
+	198692244,
+	198862140,
+	199032046,
+	199201960,
+	199371884,
+	199541816,
+	199711758,
+	199881709,
+	200051669,
+	200221638,
+	200391616,
+	200561603,
+	200731599,
+	200901604,
+	201071619,
+	201241642,
+	201411675,
+	201581716,
+	201751767,
+	201921827,
+	202091895,
+	202261973,
+	202432060,
+	202602157,
+	202772262,
+	202942376,
+	203112500,
+	203282632,
+	203452774,
+	203622924,
+	203793084,
+	203963253,
+	204133431,
+	204303618,
+	204473815,
+	204644020,
+	204814235,
+	204984458,
+	205154691,
+	205324933,
+	205495184,
+	205665444,
+	205835713,
+	206005991,
+	206176279,
+	206346575,
+	206516881,
+	206687196,
+	206857520,
+	207027853,
+	207198195,
+	207368546,
+	207538907,
+	207709277,
+	207879655,
+	208050043,
+	208220440,
+	208390846,
+	208561262,
+	208731686,
+	208902120,
+	209072563,
+	209243015,
+	209413476,
+	209583946,
+	209754425,
+	209924914,
+	210095412,
+	210265919,
+	210436435,
+	210606960,
+	210777494,
+	210948038,
+	211118590,
+	211289152,
+	211459723,
+	211630303,
+	211800893,
+	211971491,
+	212142099,
+	212312716,
+	212483342,
+	212653977,
+	212824622,
+	212995275,
+	213165938,
+	213336610,
+	213507292,
+	213677982,
+	213848681,
+	214019390,
+	214190108,
+	214360835,
+	214531572,
+	214702317,
+	214873072,
+	215043836,
+	215214609,
+	215385392,
+	215556183,
+	215726984,
+	215897794,
+	216068613,
+	216239441,
+	216410279,
+	216581126,
+	216751982,
+	216922847,
+	217093722,
+	217264605,
+	217435498,
+	217606400,
+	217777312,
+	217948232,
+	218119162,
+	218290101,
+	218461050,
+	218632007,
+	218802974,
+	218973950,
+	219144935,
+	219315930,
+	219486933,
+	219657946,
+	219828969,
+	220000000,
+	220171041,
+	220342091,
+	220513150,
+	220684218,
+	220855296,
+	221026383,
+	221197479,
+	221368585,
+	221539699,
+	221710823,
+	221881956,
+	222053099,
+	222224251,
+	222395412,
+	222566582,
+	222737762,
+	222908950,
+	223080149,
+	223251356,
+	223422573,
+	223593799,
+	223765034,
+	223936278,
+	224107532,
+	224278795,
+	224450067,
+	224621349,
+	224792640,
+	224963940,
+	225135250,
+	225306568,
+	225477896,
+	225649234,
+	225820580,
+	225991936,
+	226163302,
+	226334676,
+	226506060,
+	226677453,
+	226848856,
+	227020268,
+	227191689,
+	227363119,
+	227534559,
+	227706008,
+	227877466,
+	228048934,
+	228220411,
+	228391897,
+	228563393,
+	228734897,
+	228906412,
+	229077935,
+	229249468,
+	229421010,
+	229592562,
+	229764123,
+	229935693,
+	230107273,
+	230278862,
+	230450460,
+	230622067,
+	230793684,
+	230965310,
+	231136946,
+	231308591,
+	231480245,
+	231651909,
+	231823582,
+	231995264,
+	232166956,
+	232338657,
+	232510367,
+	232682087,
+	232853816,
+	233025555,
+	233197302,
+	233369060,
+	233540826,
+	233712602,
+	233884387,
+	234056182,
+	234227986,
+	234399799,
+	234571622,
+	234743454,
+	234915296,
+	235087147,
+	235259007,
+	235430877,
+	235602756,
+	235774644,
+	235946542,
+	236118449,
+	236290366,
+	236462292,
+	236634227,
+	236806172,
+	236978126,
+	237150090,
+	237322063,
+	237494045,
+	237666037,
+	237838038,
+	238010048,
+	238182068,
+	238354098,
+	238526137,
+	238698185,
+	238870242,
+	239042309,
+	239214386,
+	239386472,
+	239558567,
+	239730672,
+	239902786,
+	240074909,
+	240247042,
+	240419185,
+	240591336,
+	240763498,
+	240935668,
+	241107849,
+	241280038,
+	241452237,
+	241624445,
+	241796663,
+	241968891,
+	242141127,
+	242313374,
+	242485629,
+	242657894,
+	242830169,
+	243002453,
+	243174746,
+	243347049,
+	243519361,
+	243691683,
+	243864014,
+	244036355,
+	244208705,
+	244381065,
+	244553434,
+	244725812,
+	244898200,
+	245070598,
+	245243005,
+	245415421,
+	245587847,
+	245760283,
+	245932727,
+	246105182,
+	246277646,
+	246450119,
+	246622602,
+	246795094,
+	246967596,
+	247140107,
+	247312627,
+	247485158,
+	247657697,
+	247830247,
+	248002805,
+	248175373,
+	248347951,
+	248520538,
+	248693135,
+	248865741,
+	249038357,
+	249210982,
+	249383617,
+	249556261,
+	249728914,
+	249901578,
+	250074250,
+	250246933,
+	250419624,
+	250592326,
+	250765037,
+	250937757,
+	251110487,
+	251283226,
+	251455975,
+	251628733,
+	251801501,
+	251974279,
+	252147066,
+	252319862,
+	252492668,
+	252665484,
+	252838309,
+	253011144,
+	253183988,
+	253356842,
+	253529705,
+	253702578,
+	253875461,
+	254048353,
+	254221254,
+	254394165,
+	254567086,
+	254740016,
+	254912956,
+	255085905,
+	255258864,
+	255431832,
+	255604810,
+	255777798,
+	255950795,
+	256123802,
+	256296818,
+	256469844,
+	256642879,
+	256815924,
+	256988979,
+	257162043,
+	257335117,
+	257508200,
+	257681293,
+	257854395,
+	258027507,
+	258200629,
+	258373760,
+	258546901,
+	258720052,
+	258893212,
+	259066381,
+	259239560,
+	259412749,
+	259585948,
+	259759156,
+	259932373,
+	260105600,
+	260278837,
+	260452084,
+	260625340,
+	260798605,
+	260971881,
+	261145166,
+	261318460,
+	261491764,
+	261665078,
+	261838401,
+	262011734,
+	262185077,
+	262358429,
+	262531791,
+	262705162,
+	262878544,
+	263051934,
+	263225335,
+	263398745,
+	263572164,
+	263745594,
+	263919033,
+	264092481,
+	264265939,
+	264439407,
+	264612885,
+	264786372,
+	264959869,
+	265133375,
+	265306891,
+	265480417,
+	265653953,
+	265827498,
+	266001052,
+	266174617,
+	266348191,
+	266521775,
+	266695368,
+	266868971,
+	267042584,
+	267216206,
+	267389838,
+	267563480,
+	267737132,
+	267910793,
+	268084464,
+	268258144,
+	268431834,
+	268605534,
+	268779244,
+	268952963,
+	269126692,
+	269300430,
+	269474179,
+	269647937,
+	269821704,
+	269995482,
+	270169269,
+	270343066,
+	270516872,
+	270690688,
+	270864514,
+	271038350,
+	271212195,
+	271386050,
+	271559915,
+	271733789,
+	271907673,
+	272081567,
+	272255471,
+	272429384,
+	272603307,
+	272777240,
+	272951182,
+	273125135,
+	273299096,
+	273473068,
+	273647050,
+	273821041,
+	273995042,
+	274169052,
+	274343072,
+	274517103,
+	274691142,
+	274865192,
+	275039251,
+	275213320,
+	275387399,
+	275561488,
+	275735586,
+	275909694,
+	276083812,
+	276257939,
+	276432077,
+	276606224,
+	276780381,
+	276954547,
+	277128724,
+	277302910,
+	277477106,
+	277651311,
+	277825527,
+	277999752,
+	278173987,
+	278348232,
+	278522486,
+	278696750,
+	278871025,
+	279045308,
+	279219602,
+	279393906,
+	279568219,
+	279742542,
+	279916875,
+	280091217,
+	280265570,
+	280439932,
+	280614304,
+	280788686,
+	280963077,
+	281137479,
+	281311890,
+	281486311,
+	281660742,
+	281835182,
+	282009633,
+	282184093,
+	282358563,
+	282533043,
+	282707533,
+	282882032,
+	283056541,
+	283231061,
+	283405590,
+	283580128,
+	283754677,
+	283929235,
+	284103804,
+	284278382,
+	284452970,
+	284627568,
+	284802175,
+	284976793,
+	285151420,
+	285326057,
+	285500704,
+	285675361,
+	285850028,
+	286024704,
+	286199390,
+	286374087,
+	286548793,
+	286723509,
+	286898234,
+	287072970,
+	287247716,
+	287422471,
+	287597236,
+	287772011,
+	287946796,
+	288121591,
+	288296396,
+	288471210,
+	288646035,
+	288820869,
+	288995713,
+	289170567,
+	289345431,
+	289520305,
+	289695189,
+	289870083,
+	290044986,
+	290219900,
+	290394823,
+	290569756,
+	290744699,
+	290919652,
+	291094615,
+	291269588,
+	291444570,
+	291619563,
+	291794565,
+	291969578,
+	292144600,
+	292319632,
+	292494674,
+	292669726,
+	292844788,
+	293019860,
+	293194942,
+	293370033,
+	293545135,
+	293720246,
+	293895368,
+	294070499,
+	294245641,
+	294420792,
+	294595953,
+	294771124,
+	294946305,
+	295121496,
+	295296697,
+	295471908,
+	295647128,
+	295822359,
+	295997600,
+	296172850,
+	296348111,
+	296523381,
+	296698662,
+	296873952,
+	297049253,
+	297224563,
+	297399883,
+	297575214,
+	297750554,
+	297925904,
+	298101264,
+	298276634,
+	298452014,
+	298627404,
+	298802804,
+	298978214,
+	299153634,
+	299329064,
+	299504504,
+	299679954,
+	299855414,
+	300030883,
+	300206363,
+	300381853,
+	300557353,
+	300732863,
+	300908382,
+	301083912,
+	301259452,
+	301435002,
+	301610562,
+	301786131,
+	301961711,
+	302137301,
+	302312901,
+	302488510,
+	302664130,
+	302839760,
+	303015400,
+	303191050,
+	303366709,
+	303542379,
+	303718059,
+	303893749,
+	304069449,
+	304245159,
+	304420879,
+	304596609,
+	304772349,
+	304948099,
+	305123859,
+	305299629,
+	305475409,
+	305651200,
+	305827000,
+	306002810,
+	306178631,
+	306354461,
+	306530301,
+	306706152,
+	306882012,
+	307057883,
+	307233764,
+	307409654,
+	307585555,
+	307761466,
+	307937387,
+	308113318,
+	308289259,
+	308465210,
+	308641171,
+	308817142,
+	308993123,
+	309169114,
+	309345116,
+	309521127,
+	309697149,
+	309873181,
+	310049222,
+	310225274,
+	310401336,
+	310577408,
+	310753490,
+	310929582,
+	311105684,
+	311281797,
+	311457919,
+	311634052,
+	311810194,
+	311986347,
+	312162510,
+	312338683,
+	312514866,
+	312691059,
+	312867262,
+	313043476,
+	313219699,
+	313395933,
+	313572176,
+	313748430,
+	313924694,
+	314100968,
+	314277252,
+	314453547,
+	314629851,
+	314806166,
+	314982490,
+	315158825,
+	315335170,
+	315511525,
+	315687891,
+	315864266,
+	316040651,
+	316217047,
+	316393453,
+	316569869,
+	316746295,
+	316922731,
+	317099178,
+	317275634,
+	317452101,
+	317628578,
+	317805065,
+	317981562,
+	318158069,
+	318334587,
+	318511114,
+	318687652,
+	318864200,
+	319040758,
+	319217327,
+	319393905,
+	319570494,
+	319747093,
+	319923702,
+	320100321,
+	320276950,
+	320453590,
+	320630240,
+	320806900,
+	320983570,
+	321160250,
+	321336941,
+	321513641,
+	321690352,
+	321867074,
+	322043805,
+	322220546,
+	322397298,
+	322574060,
+	322750832,
+	322927615,
+	323104407,
+	323281210,
+	323458023,
+	323634846,
+	323811680,
+	323988523,
+	324165377,
+	324342241,
+	324519115,
+	324696000,
+	324872895,
+	325049800,
+	325226715,
+	325403640,
+	325580576,
+	325757522,
+	325934478,
+	326111445,
+	326288421,
+	326465408,
+	326642405,
+	326819413,
+	326996431,
+	327173458,
+	327350497,
+	327527545,
+	327704604,
+	327881673,
+	328058752,
+	328235841,
+	328412941,
+	328590051,
+	328767171,
+	328944302,
+	329121442,
+	329298594,
+	329475755,
+	329652926,
+	329830108,
+	330007301,
+	330184503,
+	330361716,
+	330538939,
+	330716172,
+	330893416,
+	331070670,
+	331247934,
+	331425208,
+	331602493,
+	331779788,
+	331957093,
+	332134409,
+	332311735,
+	332489071,
+	332666418,
+	332843775,
+	333021142,
+	333198520,
+	333375907,
+	333553306,
+	333730714,
+	333908133,
+	334085562,
+	334263001,
+	334440451,
+	334617911,
+	334795382,
+	334972862,
+	335150353,
+	335327855,
+	335505367,
+	335682889,
+	335860421,
+	336037964,
+	336215517,
+	336393080,
+	336570654,
+	336748238,
+	336925833,
+	337103438,
+	337281053,
+	337458678,
+	337636314,
+	337813961,
+	337991617,
+	338169284,
+	338346962,
+	338524649,
+	338702347,
+	338880056,
+	339057775,
+	339235504,
+	339413243,
+	339590993,
+	339768754,
+	339946525,
+	340124306,
+	340302097,
+	340479899,
+	340657711,
+	340835534,
+	341013367,
+	341191210,
+	341369064,
+	341546929,
+	341724803,
+	341902688,
+	342080584,
+	342258490,
+	342436406,
+	342614332,
+	342792269,
+	342970217,
+	343148175,
+	343326143,
+	343504122,
+	343682111,
+	343860111,
+	344038121,
+	344216141,
+	344394172,
+	344572213,
+	344750265,
+	344928327,
+	345106400,
+	345284483,
+	345462576,
+	345640680,
+	345818794,
+	345996919,
+	346175054,
+	346353200,
+	346531356,
+	346709523,
+	346887700,
+	347065887,
+	347244085,
+	347422293,
+	347600512,
+	347778742,
+	347956981,
+	348135232,
+	348313492,
+	348491763,
+	348670045,
+	348848337,
+	349026640,
+	349204953,
+	349383276,
+	349561610,
+	349739955,
+	349918310,
+	350096675,
+	350275051,
+	350453438,
+	350631835,
+	350810242,
+	350988660,
+	351167089,
+	351345527,
+	351523977,
+	351702437,
+	351880907,
+	352059388,
+	352237880,
+	352416382,
+	352594894,
+	352773417,
+	352951951,
+	353130495,
+	353309049,
+	353487614,
+	353666190,
+	353844776,
+	354023372,
+	354201980,
+	354380597,
+	354559226,
+	354737864,
+	354916514,
+	355095173,
+	355273844,
+	355452525,
+	355631216,
+	355809918,
+	355988631,
+	356167354,
+	356346087,
+	356524832,
+	356703586,
+	356882352,
+	357061128,
+	357239914,
+	357418711,
+	357597518,
+	357776337,
+	357955165,
+	358134005,
+	358312854,
+	358491715,
+	358670586,
+	358849467,
+	359028359,
+	359207262,
+	359386175,
+	359565099,
+	359744034,
+	359922979,
+	360101934,
+	360280901,
+	360459877,
+	360638865,
+	360817863,
+	360996872,
+	361175891,
+	361354921,
+	361533961,
+	361713012,
+	361892074,
+	362071146,
+	362250229,
+	362429322,
+	362608426,
+	362787541,
+	362966666,
+	363145802,
+	363324949,
+	363504106,
+	363683274,
+	363862453,
+	364041642,
+	364220841,
+	364400052,
+	364579273,
+	364758504,
+	364937747,
+	365117000,
+	365296263,
+	365475537,
+	365654822,
+	365834118,
+	366013424,
+	366192741,
+	366372068,
+	366551406,
+	366730755,
+	366910115,
+	367089485,
+	367268866,
+	367448257,
+	367627659,
+	367807072,
+	367986495,
+	368165930,
+	368345374,
+	368524830,
+	368704296,
+	368883773,
+	369063261,
+	369242759,
+	369422268,
+	369601787,
+	369781318,
+	369960859,
+	370140410,
+	370319973,
+	370499546,
+	370679130,
+	370858724,
+	371038329,
+	371217945,
+	371397572,
+	371577209,
+	371756857,
+	371936516,
+	372116186,
+	372295866,
+	372475557,
+	372655258,
+	372834971,
+	373014694,
+	373194428,
+	373374172,
+	373553928,
+	373733694,
+	373913470,
+	374093258,
+	374273056,
+	374452865,
+	374632685,
+	374812515,
+	374992357,
+	375172208,
+	375352071,
+	375531945,
+	375711829,
+	375891724,
+	376071630,
+	376251546,
+	376431473,
+	376611412,
+	376791360,
+	376971320,
+	377151290,
+	377331271,
+	377511263,
+	377691266,
+	377871279,
+	378051304,
+	378231339,
+	378411385,
+	378591441,
+	378771508,
+	378951587,
+	379131676,
+	379311775,
+	379491886,
+	379672007,
+	379852139,
+	380032282,
+	380212436,
+	380392601,
+	380572776,
+	380752962,
+	380933159,
+	381113367,
+	381293586,
+	381473815,
+	381654055,
+	381834307,
+	382014568,
+	382194841,
+	382375125,
+	382555419,
+	382735724,
+	382916040,
+	383096367,
+	383276705,
+	383457054,
+	383637413,
+	383817783,
+	383998164,
+	384178556,
+	384358959,
+	384539373,
+	384719797,
+	384900233,
+	385080679,
+	385261136,
+	385441604,
+	385622083,
+	385802572,
+	385983073,
+	386163584,
+	386344106,
+	386524640,
+	386705184,
+	386885739,
+	387066304,
+	387246881,
+	387427468,
+	387608067,
+	387788676,
+	387969296,
+	388149927,
+	388330569,
+	388511222,
+	388691886,
+	388872561,
+	389053246,
+	389233943,
+	389414650,
+	389595368,
+	389776098,
+	389956838,
+	390137589,
+	390318351,
+	390499123,
+	390679907,
+	390860702,
+	391041507,
+	391222324,
+	391403151,
+	391583990,
+	391764839,
+	391945699,
+	392126570,
+	392307453,
+	392488346,
+	392669250,
+	392850164,
+	393031090,
+	393212027,
+	393392975,
+	393573934,
+	393754903,
+	393935884,
+	394116875,
+	394297878,
+	394478891,
+	394659916,
+	394840951,
+	395021998,
+	395203055,
+	395384123,
+	395565203,
+	395746293,
+	395927394,
+	396108506,
+	396289630,
+	396470764,
+	396651909,
+	396833065,
+	397014232,
+	397195410,
+	397376599,
+	397557799,
+	397739011,
+	397920233,
+	398101466,
+	398282710,
+	398463965,
+	398645231,
+	398826508,
+	399007796,
+	399189095,
+	399370406,
+	399551727,
+	399733059,
+	399914402,
+	400095756,
+	400277122,
+	400458498,
+	400639885,
+	400821284,
+	401002693,
+	401184113,
+	401365545,
+	401546987,
+	401728441,
+	401909905,
+	402091381,
+	402272868,
+	402454365,
+	402635874,
+	402817394,
+	402998925,
+	403180466,
+	403362019,
+	403543583,
+	403725159,
+	403906745,
+	404088342,
+	404269950,
+	404451570,
+	404633200,
+	404814841,
+	404996494,
+	405178158,
+	405359832,
+	405541518,
+	405723215,
+	405904923,
+	406086642,
+	406268372,
+	406450114,
+	406631866,
+	406813629,
+	406995404,
+	407177190,
+	407358986,
+	407540794,
+	407722613,
+	407904443,
+	408086284,
+	408268137,
+	408450000,
+	408631875,
+	408813760,
+	408995657,
+	409177565,
+	409359484,
+	409541414,
+	409723355,
+	409905308,
+	410087271,
+	410269246,
+	410451232,
+	410633228,
+	410815237,
+	410997256,
+	411179286,
+	411361328,
+	411543380,
+	411725444,
+	411907519,
+	412089605,
+	412271703,
+	412453811,
+	412635931,
+	412818061,
+	413000203,
+	413182356,
+	413364521,
+	413546696,
+	413728883,
+	413911081,
+	414093289,
+	414275510,
+	414457741,
+	414639983,
+	414822237,
+	415004502,
+	415186778,
+	415369065,
+	415551364,
+	415733674,
+	415915994,
+	416098327,
+	416280670,
+	416463024,
+	416645390,
+	416827767,
+	417010155,
+	417192554,
+	417374965,
+	417557387,
+	417739819,
+	417922264,
+	418104719,
+	418287186,
+	418469664,
+	418652153,
+	418834653,
+	419017165,
+	419199687,
+	419382221,
+	419564767,
+	419747323,
+	419929891,
+	420112470,
+	420295060,
+	420477662,
+	420660275,
+	420842899,
+	421025534,
+	421208180,
+	421390838,
+	421573507,
+	421756188,
+	421938879,
+	422121582,
+	422304296,
+	422487021,
+	422669758,
+	422852506,
+	423035265,
+	423218036,
+	423400818,
+	423583611,
+	423766415,
+	423949231,
+	424132058,
+	424314896,
+	424497746,
+	424680606,
+	424863479,
+	425046362,
+	425229257,
+	425412163,
+	425595080,
+	425778009,
+	425960949,
+	426143900,
+	426326863,
+	426509837,
+	426692822,
+	426875819,
+	427058827,
+	427241846,
+	427424876,
+	427607918,
+	427790972,
+	427974036,
+	428157112,
+	428340199,
+	428523298,
+	428706408,
+	428889529,
+	429072662,
+	429255806,
+	429438961,
+	429622128,
+	429805306,
+	429988495,
+	430171696,
+	430354908,
+	430538132,
+	430721367,
+	430904613,
+	431087871,
+	431271140,
+	431454420,
+	431637712,
+	431821015,
+	432004329,
+	432187655,
+	432370992,
+	432554341,
+	432737701,
+	432921073,
+	433104456,
+	433287850,
+	433471255,
+	433654673,
+	433838101,
+	434021541,
+	434204992,
+	434388455,
+	434571929,
+	434755414,
+	434938911,
+	435122420,
+	435305939,
+	435489471,
+	435673013,
+	435856567,
+	436040133,
+	436223710,
+	436407298,
+	436590898,
+	436774509,
+	436958132,
+	437141766,
+	437325411,
+	437509068,
+	437692737,
+	437876417,
+	438060108,
+	438243811,
+	438427525,
+	438611251,
+	438794988,
+	438978737,
+	439162497,
+	439346268,
+	439530051,
+	439713846,
+	439897652,
+	440081469,
+	440265298,
+	440449139,
+	440632991,
+	440816854,
+	441000729,
+	441184615,
+	441368513,
+	441552423,
+	441736343,
+	441920276,
+	442104220,
+	442288175,
+	442472142,
+	442656120,
+	442840110,
+	443024111,
+	443208124,
+	443392149,
+	443576185,
+	443760232,
+	443944291,
+	444128362,
+	444312444,
+	444496537,
+	444680642,
+	444864759,
+	445048887,
+	445233027,
+	445417178,
+	445601341,
+	445785515,
+	445969701,
+	446153898,
+	446338107,
+	446522328,
+	446706560,
+	446890804,
+	447075059,
+	447259326,
+	447443604,
+	447627894,
+	447812195,
+	447996508,
+	448180833,
+	448365169,
+	448549517,
+	448733876,
+	448918247,
+	449102629,
+	449287024,
+	449471429,
+	449655846,
+	449840275,
+	450024716,
+	450209168,
+	450393631,
+	450578107,
+	450762593,
+	450947092,
+	451131602,
+	451316124,
+	451500657,
+	451685202,
+	451869758,
+	452054326,
+	452238906,
+	452423497,
+	452608100,
+	452792715,
+	452977341,
+	453161979,
+	453346628,
+	453531290,
+	453715962,
+	453900647,
+	454085343,
+	454270051,
+	454454770,
+	454639501,
+	454824244,
+	455008998,
+	455193764,
+	455378541,
+	455563331,
+	455748132,
+	455932944,
+	456117768,
+	456302604,
+	456487452,
+	456672311,
+	456857182,
+	457042065,
+	457226959,
+	457411865,
+	457596783,
+	457781712,
+	457966653,
+	458151606,
+	458336570,
+	458521546,
+	458706534,
+	458891534,
+	459076545,
+	459261568,
+	459446603,
+	459631649,
+	459816707,
+	460001777,
+	460186858,
+	460371951,
+	460557056,
+	460742173,
+	460927301,
+	461112441,
+	461297593,
+	461482757,
+	461667932,
+	461853119,
+	462038318,
+	462223528,
+	462408751,
+	462593985,
+	462779230,
+	462964488,
+	463149757,
+	463335038,
+	463520331,
+	463705635,
+	463890951,
+	464076279,
+	464261619,
+	464446971,
+	464632334,
+	464817709,
+	465003096,
+	465188495,
+	465373905,
+	465559327,
+	465744761,
+	465930207,
+	466115665,
+	466301134,
+	466486615,
+	466672108,
+	466857613,
+	467043129,
+	467228658,
+	467414198,
+	467599750,
+	467785313,
+	467970889,
+	468156476,
+	468342075,
+	468527686,
+	468713309,
+	468898944,
+	469084590,
+	469270248,
+	469455919,
+	469641600,
+	469827294,
+	470013000,
+	470198717,
+	470384446,
+	470570188,
+	470755941,
+	470941705,
+	471127482,
+	471313270,
+	471499071,
+	471684883,
+	471870707,
+	472056543,
+	472242391,
+	472428250,
+	472614122,
+	472800005,
+	472985900,
+	473171808,
+	473357727,
+	473543657,
+	473729600,
+	473915555,
+	474101521,
+	474287500,
+	474473490,
+	474659492,
+	474845506,
+	475031532,
+	475217570,
+	475403620,
+	475589682,
+	475775755,
+	475961841,
+	476147938,
+	476334047,
+	476520168,
+	476706302,
+	476892447,
+	477078604,
+	477264773,
+	477450953,
+	477637146,
+	477823351,
+	478009567,
+	478195796,
+	478382036,
+	478568289,
+	478754553,
+	478940829,
+	479127118,
+	479313418,
+	479499730,
+	479686054,
+	479872390,
+	480058738,
+	480245098,
+	480431470,
+	480617854,
+	480804250,
+	480990658,
+	481177077,
+	481363509,
+	481549953,
+	481736409,
+	481922876,
+	482109356,
+	482295848,
+	482482351,
+	482668867,
+	482855395,
+	483041934,
+	483228486,
+	483415050,
+	483601625,
+	483788213,
+	483974813,
+	484161424,
+	484348048,
+	484534684,
+	484721331,
+	484907991,
+	485094663,
+	485281346,
+	485468042,
+	485654750,
+	485841470,
+	486028202,
+	486214946,
+	486401702,
+	486588470,
+	486775250,
+	486962042,
+	487148846,
+	487335662,
+	487522490,
+	487709330,
+	487896183,
+	488083047,
+	488269923,
+	488456812,
+	488643712,
+	488830625,
+	489017550,
+	489204487,
+	489391435,
+	489578396,
+	489765369,
+	489952354,
+	490139351,
+	490326361,
+	490513382,
+	490700415,
+	490887461,
+	491074518,
+	491261588,
+	491448670,
+	491635764,
+	491822870,
+	492009988,
+	492197118,
+	492384260,
+	492571415,
+	492758581,
+	492945760,
+	493132951,
+	493320154,
+	493507369,
+	493694596,
+	493881835,
+	494069087,
+	494256350,
+	494443626,
+	494630914,
+	494818214,
+	495005526,
+	495192850,
+	495380187,
+	495567535,
+	495754896,
+	495942269,
+	496129654,
+	496317051,
+	496504460,
+	496691882,
+	496879316,
+	497066761,
+	497254219,
+	497441690,
+	497629172,
+	497816667,
+	498004173,
+	498191692,
+	498379223,
+	498566767,
+	498754322,
+	498941890,
+	499129470,
+	499317062,
+	499504666,
+	499692283,
+	499879911,
+	500067552,
+	500255205,
+	500442871,
+	500630548,
+	500818238,
+	501005940,
+	501193654,
+	501381380,
+	501569119,
+	501756870,
+	501944633,
+	502132408,
+	502320196,
+	502507996,
+	502695808,
+	502883632,
+	503071469,
+	503259318,
+	503447179,
+	503635052,
+	503822937,
+	504010835,
+	504198745,
+	504386668,
+	504574602,
+	504762549,
+	504950508,
+	505138480,
+	505326463,
+	505514459,
+	505702468,
+	505890488,
+	506078521,
+	506266566,
+	506454623,
+	506642693,
+	506830775,
+	507018869,
+	507206976,
+	507395095,
+	507583226,
+	507771370,
+	507959525,
+	508147693,
+	508335874,
+	508524067,
+	508712272,
+	508900489,
+	509088719,
+	509276961,
+	509465215,
+	509653482,
+	509841761,
+	510030052,
+	510218356,
+	510406672,
+	510595000,
+	510783341,
+	510971694,
+	511160059,
+	511348437,
+	511536827,
+	511725230,
+	511913645,
+	512102072,
+	512290511,
+	512478963,
+	512667428,
+	512855904,
+	513044393,
+	513232895,
+	513421409,
+	513609935,
+	513798473,
+	513987024,
+	514175588,
+	514364163,
+	514552751,
+	514741352,
+	514929965,
+	515118590,
+	515307228,
+	515495878,
+	515684541,
+	515873216,
+	516061903,
+	516250603,
+	516439315,
+	516628039,
+	516816777,
+	517005526,
+	517194288,
+	517383062,
+	517571849,
+	517760648,
+	517949460,
+	518138284,
+	518327120,
+	518515969,
+	518704831,
+	518893705,
+	519082591,
+	519271490,
+	519460401,
+	519649325,
+	519838261,
+	520027209,
+	520216170,
+	520405144,
+	520594130,
+	520783129,
+	520972139,
+	521161163,
+	521350199,
+	521539247,
+	521728308,
+	521917382,
+	522106467,
+	522295566,
+	522484677,
+	522673800,
+	522862936,
+	523052084,
+	523241245,
+	523430419,
+	523619605,
+	523808803,
+	523998014,
+	524187237,
+	524376473,
+	524565722,
+	524754983,
+	524944257,
+	525133543,
+	525322841,
+	525512152,
+	525701476,
+	525890812,
+	526080161,
+	526269523,
+	526458896,
+	526648283,
+	526837682,
+	527027093,
+	527216518,
+	527405954,
+	527595403,
+	527784865,
+	527974340,
+	528163827,
+	528353326,
+	528542838,
+	528732363,
+	528921900,
+	529111450,
+	529301012,
+	529490587,
+	529680175,
+	529869775,
+	530059388,
+	530249013,
+	530438651,
+	530628302,
+	530817965,
+	531007641,
+	531197330,
+	531387031,
+	531576744,
+	531766471,
+	531956210,
+	532145961,
+	532335725,
+	532525502,
+	532715291,
+	532905093,
+	533094908,
+	533284736,
+	533474575,
+	533664428,
+	533854293,
+	534044171,
+	534234062,
+	534423965,
+	534613881,
+	534803810,
+	534993751,
+	535183705,
+	535373671,
+	535563650,
+	535753642,
+	535943647,
+	536133664,
+	536323694,
+	536513737,
+	536703792,
+	536893860,
+	537083940,
+	537274034,
+	537464140,
+	537654259,
+	537844390,
+	538034534,
+	538224691,
+	538414861,
+	538605043,
+	538795238,
+	538985446,
+	539175666,
+	539365899,
+	539556145,
+	539746404,
+	539936675,
+	540126959,
+	540317256,
+	540507565,
+	540697887,
+	540888222,
+	541078570,
+	541268931,
+	541459304,
+	541649690,
+	541840089,
+	542030500,
+	542220924,
+	542411361,
+	542601811,
+	542792274,
+	542982749,
+	543173237,
+	543363738,
+	543554252,
+	543744778,
+	543935317,
+	544125869,
+	544316434,
+	544507012,
+	544697602,
+	544888205,
+	545078821,
+	545269450,
+	545460092,
+	545650746,
+	545841413,
+	546032093,
+	546222786,
+	546413492,
+	546604210,
+	546794941,
+	546985685,
+	547176442,
+	547367212,
+	547557994,
+	547748790,
+	547939598,
+	548130419,
+	548321253,
+	548512100,
+	548702959,
+	548893832,
+	549084717,
+	549275615,
+	549466526,
+	549657450,
+	549848387,
+	550039337,
+	550230299,
+	550421274,
+	550612263,
+	550803264,
+	550994278,
+	551185305,
+	551376344,
+	551567397,
+	551758463,
+	551949541,
+	552140632,
+	552331736,
+	552522854,
+	552713984,
+	552905126,
+	553096282,
+	553287451,
+	553478633,
+	553669827,
+	553861035,
+	554052255,
+	554243488,
+	554434734,
+	554625994,
+	554817266,
+	555008551,
+	555199849,
+	555391160,
+	555582483,
+	555773820,
+	555965170,
+	556156533,
+	556347908,
+	556539297,
+	556730698,
+	556922113,
+	557113540,
+	557304981,
+	557496434,
+	557687900,
+	557879380,
+	558070872,
+	558262377,
+	558453896,
+	558645427,
+	558836971,
+	559028528,
+	559220099,
+	559411682,
+	559603278,
+	559794887,
+	559986509,
+	560178145,
+	560369793,
+	560561454,
+	560753128,
+	560944815,
+	561136516,
+	561328229,
+	561519955,
+	561711695,
+	561903447,
+	562095212,
+	562286991,
+	562478782,
+	562670587,
+	562862404,
+	563054235,
+	563246079,
+	563437935,
+	563629805,
+	563821688,
+	564013584,
+	564205492,
+	564397414,
+	564589349,
+	564781298,
+	564973259,
+	565165233,
+	565357220,
+	565549221,
+	565741234,
+	565933261,
+	566125300,
+	566317353,
+	566509419,
+	566701498,
+	566893590,
+	567085695,
+	567277813,
+	567469945,
+	567662089,
+	567854247,
+	568046417,
+	568238601,
+	568430798,
+	568623008,
+	568815231,
+	569007467,
+	569199717,
+	569391979,
+	569584255,
+	569776544,
+	569968846,
+	570161161,
+	570353489,
+	570545831,
+	570738185,
+	570930553,
+	571122934,
+	571315328,
+	571507735,
+	571700155,
+	571892589,
+	572085035,
+	572277495,
+	572469968,
+	572662454,
+	572854954,
+	573047466,
+	573239992,
+	573432531,
+	573625083,
+	573817648,
+	574010227,
+	574202819,
+	574395424,
+	574588042,
+	574780673,
+	574973318,
+	575165975,
+	575358646,
+	575551331,
+	575744028,
+	575936739,
+	576129463,
+	576322200,
+	576514950,
+	576707714,
+	576900490,
+	577093280,
+	577286084,
+	577478900,
+	577671730,
+	577864573,
+	578057429,
+	578250299,
+	578443182,
+	578636078,
+	578828987,
+	579021910,
+	579214846,
+	579407795,
+	579600757,
+	579793733,
+	579986722,
+	580179724,
+	580372740,
+	580565769,
+	580758811,
+	580951866,
+	581144935,
+	581338017,
+	581531112,
+	581724221,
+	581917343,
+	582110478,
+	582303627,
+	582496789,
+	582689964,
+	582883152,
+	583076354,
+	583269569,
+	583462798,
+	583656040,
+	583849295,
+	584042564,
+	584235845,
+	584429141,
+	584622449,
+	584815771,
+	585009106,
+	585202455,
+	585395817,
+	585589192,
+	585782581,
+	585975983,
+	586169399,
+	586362827,
+	586556270,
+	586749725,
+	586943194,
+	587136677,
+	587330172,
+	587523681,
+	587717204,
+	587910740,
+	588104289,
+	588297852,
+	588491428,
+	588685017,
+	588878620,
+	589072237,
+	589265866,
+	589459510,
+	589653166,
+	589846836,
+	590040520,
+	590234217,
+	590427927,
+	590621651,
+	590815388,
+	591009138,
+	591202902,
+	591396680,
+	591590471,
+	591784275,
+	591978093,
+	592171924,
+	592365769,
+	592559627,
+	592753499,
+	592947384,
+	593141283,
+	593335195,
+	593529121,
+	593723060,
+	593917012,
+	594110978,
+	594304958,
+	594498951,
+	594692957,
+	594886977,
+	595081011,
+	595275058,
+	595469118,
+	595663192,
+	595857280,
+	596051381,
+	596245495,
+	596439623,
+	596633765,
+	596827920,
+	597022089,
+	597216271,
+	597410466,
+	597604676,
+	597798898,
+	597993135,
+	598187385,
+	598381648,
+	598575925,
+	598770215,
+	598964519,
+	599158837,
+	599353168,
+	599547513,
+	599741871,
+	599936243,
+	600130629,
+	600325028,
+	600519440,
+	600713866,
+	600908306,
+	601102759,
+	601297226,
+	601491707,
+	601686201,
+	601880709,
+	602075230,
+	602269765,
+	602464313,
+	602658876,
+	602853451,
+	603048041,
+	603242644,
+	603437260,
+	603631891,
+	603826534,
+	604021192,
+	604215863,
+	604410548,
+	604605246,
+	604799958,
+	604994684,
+	605189423,
+	605384176,
+	605578943,
+	605773723,
+	605968517,
+	606163324,
+	606358146,
+	606552981,
+	606747829,
+	606942692,
+	607137567,
+	607332457,
+	607527360,
+	607722277,
+	607917208,
+	608112152,
+	608307110,
+	608502082,
+	608697068,
+	608892067,
+	609087080,
+	609282106,
+	609477146,
+	609672200,
+	609867268,
+	610062350,
+	610257445,
+	610452553,
+	610647676,
+	610842812,
+	611037962,
+	611233126,
+	611428304,
+	611623495,
+	611818700,
+	612013919,
+	612209151,
+	612404398,
+	612599658,
+	612794931,
+	612990219,
+	613185520,
+	613380835,
+	613576164,
+	613771507,
+	613966863,
+	614162233,
+	614357617,
+	614553015,
+	614748426,
+	614943852,
+	615139291,
+	615334744,
+	615530210,
+	615725691,
+	615921185,
+	616116693,
+	616312215,
+	616507751,
+	616703301,
+	616898864,
+	617094441,
+	617290032,
+	617485637,
+	617681256,
+	617876888,
+	618072535,
+	618268195,
+	618463869,
+	618659557,
+	618855259,
+	619050974,
+	619246704,
+	619442447,
+	619638204,
+	619833975,
+	620029760,
+	620225559,
+	620421372,
+	620617198,
+	620813039,
+	621008893,
+	621204761,
+	621400643,
+	621596539,
+	621792449,
+	621988373,
+	622184310,
+	622380262,
+	622576227,
+	622772207,
+	622968200,
+	623164207,
+	623360228,
+	623556263,
+	623752312,
+	623948375,
+	624144452,
+	624340543,
+	624536647,
+	624732766,
+	624928899,
+	625125045,
+	625321205,
+	625517380,
+	625713568,
+	625909771,
+	626105987,
+	626302217,
+	626498461,
+	626694719,
+	626890991,
+	627087278,
+	627283578,
+	627479892,
+	627676220,
+	627872562,
+	628068918,
+	628265288,
+	628461672,
+	628658070,
+	628854482,
+	629050908,
+	629247348,
+	629443802,
+	629640270,
+	629836752,
+	630033248,
+	630229758,
+	630426282,
+	630622820,
+	630819373,
+	631015939,
+	631212519,
+	631409113,
+	631605722,
+	631802344,
+	631998981,
+	632195631,
+	632392296,
+	632588974,
+	632785667,
+	632982374,
+	633179094,
+	633375829,
+	633572578,
+	633769341,
+	633966118,
+	634162909,
+	634359715,
+	634556534,
+	634753367,
+	634950215,
+	635147077,
+	635343952,
+	635540842,
+	635737746,
+	635934664,
+	636131596,
+	636328543,
+	636525503,
+	636722478,
+	636919466,
+	637116469,
+	637313486,
+	637510517,
+	637707562,
+	637904621,
+	638101695,
+	638298782,
+	638495884,
+	638693000,
+	638890130,
+	639087274,
+	639284433,
+	639481605,
+	639678792,
+	639875993,
+	640073208,
+	640270437,
+	640467681,
+	640664938,
+	640862210,
+	641059496,
+	641256796,
+	641454110,
+	641651439,
+	641848782,
+	642046139,
+	642243510,
+	642440895,
+	642638295,
+	642835709,
+	643033137,
+	643230579,
+	643428035,
+	643625506,
+	643822991,
+	644020490,
+	644218003,
+	644415531,
+	644613073,
+	644810629,
+	645008199,
+	645205784,
+	645403383,
+	645600996,
+	645798624,
+	645996265,
+	646193921,
+	646391591,
+	646589276,
+	646786975,
+	646984688,
+	647182415,
+	647380157,
+	647577913,
+	647775683,
+	647973467,
+	648171266,
+	648369079,
+	648566907,
+	648764748,
+	648962604,
+	649160475,
+	649358359,
+	649556258,
+	649754172,
+	649952099,
+	650150041,
+	650347998,
+	650545968,
+	650743953,
+	650941953,
+	651139966,
+	651337994,
+	651536037,
+	651734093,
+	651932164,
+	652130250,
+	652328350,
+	652526464,
+	652724592,
+	652922735,
+	653120893,
+	653319064,
+	653517250,
+	653715451,
+	653913666,
+	654111895,
+	654310139,
+	654508397,
+	654706669,
+	654904956,
+	655103257,
+	655301573,
+	655499903,
+	655698248,
+	655896606,
+	656094980,
+	656293368,
+	656491770,
+	656690186,
+	656888617,
+	657087063,
+	657285523,
+	657483997,
+	657682486,
+	657880990,
+	658079507,
+	658278040,
+	658476586,
+	658675147,
+	658873723,
+	659072313,
+	659270918,
+	659469537,
+	659668170,
+	659866818,
+	660065481,
+	660264158,
+	660462849,
+	660661555,
+	660860276,
+	661059011,
+	661257760,
+	661456524,
+	661655303,
+	661854096,
+	662052903,
+	662251725,
+	662450562,
+	662649413,
+	662848279,
+	663047159,
+	663246054,
+	663444963,
+	663643887,
+	663842825,
+	664041778,
+	664240746,
+	664439728,
+	664638724,
+	664837735,
+	665036761,
+	665235801,
+	665434856,
+	665633926,
+	665833010,
+	666032108,
+	666231222,
+	666430349,
+	666629492,
+	666828649,
+	667027820,
+	667227007,
+	667426207,
+	667625423,
+	667824653,
+	668023897,
+	668223157,
+	668422430,
+	668621719,
+	668821022,
+	669020340,
+	669219672,
+	669419019,
+	669618381,
+	669817757,
+	670017148,
+	670216554,
+	670415974,
+	670615409,
+	670814859,
+	671014323,
+	671213802,
+	671413295,
+	671612804,
+	671812327,
+	672011864,
+	672211416,
+	672410983,
+	672610565,
+	672810161,
+	673009773,
+	673209398,
+	673409039,
+	673608694,
+	673808364,
+	674008048,
+	674207748,
+	674407462,
+	674607190,
+	674806934,
+	675006692,
+	675206465,
+	675406253,
+	675606055,
+	675805872,
+	676005704,
+	676205551,
+	676405412,
+	676605288,
+	676805179,
+	677005085,
+	677205005,
+	677404941,
+	677604891,
+	677804855,
+	678004835,
+	678204829,
+	678404838,
+	678604862,
+	678804901,
+	679004954,
+	679205023,
+	679405106,
+	679605204,
+	679805316,
+	680005444,
+	680205586,
+	680405743,
+	680605915,
+	680806102,
+	681006303,
+	681206520,
+	681406751,
+	681606997,
+	681807258,
+	682007534,
+	682207824,
+	682408130,
+	682608450,
+	682808785,
+	683009135,
+	683209500,
+	683409880,
+	683610275,
+	683810684,
+	684011109,
+	684211548,
+	684412002,
+	684612471,
+	684812955,
+	685013454,
+	685213968,
+	685414496,
+	685615040,
+	685815598,
+	686016172,
+	686216760,
+	686417363,
+	686617981,
+	686818614,
+	687019262,
+	687219925,
+	687420603,
+	687621295,
+	687822003,
+	688022726,
+	688223463,
+	688424216,
+	688624983,
+	688825766,
+	689026563,
+	689227375,
+	689428203,
+	689629045,
+	689829902,
+	690030775,
+	690231662,
+	690432564,
+	690633481,
+	690834413,
+	691035361,
+	691236323,
+	691437300,
+	691638292,
+	691839299,
+	692040321,
+	692241359,
+	692442411,
+	692643478,
+	692844560,
+	693045658,
+	693246770,
+	693447897,
+	693649040,
+	693850197,
+	694051370,
+	694252557,
+	694453760,
+	694654977,
+	694856210,
+	695057458,
+	695258721,
+	695459998,
+	695661291,
+	695862599,
+	696063923,
+	696265261,
+	696466614,
+	696667982,
+	696869366,
+	697070764,
+	697272178,
+	697473607,
+	697675051,
+	697876509,
+	698077984,
+	698279473,
+	698480977,
+	698682496,
+	698884031,
+	699085581,
+	699287145,
+	699488725,
+	699690320,
+	699891931,
+	700093556,
+	700295197,
+	700496852,
+	700698523,
+	700900209,
+	701101910,
+	701303627,
+	701505358,
+	701707105,
+	701908866,
+	702110643,
+	702312436,
+	702514243,
+	702716066,
+	702917903,
+	703119756,
+	703321625,
+	703523508,
+	703725406,
+	703927320,
+	704129249,
+	704331193,
+	704533153,
+	704735128,
+	704937117,
+	705139123,
+	705341143,
+	705543179,
+	705745229,
+	705947295,
+	706149377,
+	706351473,
+	706553585,
+	706755712,
+	706957855,
+	707160012,
+	707362185,
+	707564373,
+	707766577,
+	707968795,
+	708171029,
+	708373279,
+	708575543,
+	708777823,
+	708980118,
+	709182429,
+	709384755,
+	709587096,
+	709789452,
+	709991824,
+	710194211,
+	710396613,
+	710599031,
+	710801464,
+	711003912,
+	711206376,
+	711408855,
+	711611349,
+	711813859,
+	712016384,
+	712218924,
+	712421480,
+	712624051,
+	712826638,
+	713029240,
+	713231857,
+	713434489,
+	713637137,
+	713839801,
+	714042479,
+	714245174,
+	714447883,
+	714650608,
+	714853348,
+	715056104,
+	715258875,
+	715461662,
+	715664464,
+	715867281,
+	716070114,
+	716272962,
+	716475826,
+	716678705,
+	716881599,
+	717084509,
+	717287434,
+	717490375,
+	717693331,
+	717896303,
+	718099290,
+	718302293,
+	718505311,
+	718708344,
+	718911393,
+	719114458,
+	719317538,
+	719520633,
+	719723744,
+	719926871,
+	720130013,
+	720333170,
+	720536343,
+	720739531,
+	720942735,
+	721145955,
+	721349189,
+	721552440,
+	721755706,
+	721958987,
+	722162284,
+	722365597,
+	722568925,
+	722772268,
+	722975628,
+	723179002,
+	723382392,
+	723585798,
+	723789220,
+	723992656,
+	724196109,
+	724399577,
+	724603060,
+	724806560,
+	725010074,
+	725213605,
+	725417151,
+	725620712,
+	725824289,
+	726027882,
+	726231490,
+	726435114,
+	726638753,
+	726842408,
+	727046079,
+	727249765,
+	727453467,
+	727657185,
+	727860918,
+	728064667,
+	728268431,
+	728472211,
+	728676007,
+	728879818,
+	729083645,
+	729287488,
+	729491346,
+	729695220,
+	729899110,
+	730103015,
+	730306936,
+	730510872,
+	730714825,
+	730918793,
+	731122776,
+	731326776,
+	731530791,
+	731734821,
+	731938868,
+	732142930,
+	732347008,
+	732551101,
+	732755211,
+	732959336,
+	733163476,
+	733367633,
+	733571805,
+	733775993,
+	733980196,
+	734184416,
+	734388651,
+	734592902,
+	734797168,
+	735001450,
+	735205749,
+	735410062,
+	735614392,
+	735818737,
+	736023099,
+	736227475,
+	736431868,
+	736636277,
+	736840701,
+	737045141,
+	737249597,
+	737454068,
+	737658556,
+	737863059,
+	738067578,
+	738272113,
+	738476664,
+	738681230,
+	738885812,
+	739090411,
+	739295025,
+	739499654,
+	739704300,
+	739908961,
+	740113639,
+	740318332,
+	740523041,
+	740727766,
+	740932507,
+	741137263,
+	741342036,
+	741546824,
+	741751628,
+	741956448,
+	742161284,
+	742366136,
+	742571004,
+	742775887,
+	742980787,
+	743185702,
+	743390634,
+	743595581,
+	743800544,
+	744005523,
+	744210518,
+	744415529,
+	744620556,
+	744825599,
+	745030657,
+	745235732,
+	745440822,
+	745645929,
+	745851051,
+	746056190,
+	746261344,
+	746466514,
+	746671701,
+	746876903,
+	747082121,
+	747287355,
+	747492606,
+	747697872,
+	747903154,
+	748108452,
+	748313766,
+	748519096,
+	748724442,
+	748929804,
+	749135182,
+	749340577,
+	749545987,
+	749751413,
+	749956855,
+	750162313,
+	750367788,
+	750573278,
+	750778784,
+	750984306,
+	751189845,
+	751395399,
+	751600970,
+	751806556,
+	752012159,
+	752217778,
+	752423412,
+	752629063,
+	752834730,
+	753040413,
+	753246112,
+	753451827,
+	753657558,
+	753863306,
+	754069069,
+	754274849,
+	754480644,
+	754686456,
+	754892284,
+	755098128,
+	755303988,
+	755509864,
+	755715756,
+	755921665,
+	756127589,
+	756333530,
+	756539487,
+	756745460,
+	756951449,
+	757157455,
+	757363476,
+	757569514,
+	757775568,
+	757981638,
+	758187724,
+	758393826,
+	758599945,
+	758806079,
+	759012230,
+	759218397,
+	759424581,
+	759630780,
+	759836996,
+	760043228,
+	760249476,
+	760455740,
+	760662020,
+	760868317,
+	761074630,
+	761280959,
+	761487305,
+	761693667,
+	761900045,
+	762106439,
+	762312849,
+	762519276,
+	762725719,
+	762932178,
+	763138653,
+	763345145,
+	763551653,
+	763758177,
+	763964718,
+	764171275,
+	764377848,
+	764584437,
+	764791043,
+	764997665,
+	765204303,
+	765410958,
+	765617629,
+	765824316,
+	766031020,
+	766237740,
+	766444476,
+	766651228,
+	766857997,
+	767064783,
+	767271584,
+	767478402,
+	767685236,
+	767892087,
+	768098954,
+	768305837,
+	768512737,
+	768719653,
+	768926586,
+	769133534,
+	769340500,
+	769547481,
+	769754479,
+	769961494,
+	770168524,
+	770375571,
+	770582635,
+	770789715,
+	770996811,
+	771203924,
+	771411053,
+	771618199,
+	771825361,
+	772032540,
+	772239735,
+	772446946,
+	772654174,
+	772861418,
+	773068679,
+	773275956,
+	773483250,
+	773690560,
+	773897886,
+	774105229,
+	774312589,
+	774519965,
+	774727357,
+	774934766,
+	775142192,
+	775349634,
+	775557092,
+	775764567,
+	775972059,
+	776179567,
+	776387091,
+	776594632,
+	776802190,
+	777009764,
+	777217354,
+	777424962,
+	777632585,
+	777840225,
+	778047882,
+	778255555,
+	778463245,
+	778670952,
+	778878675,
+	779086414,
+	779294170,
+	779501943,
+	779709732,
+	779917538,
+	780125360,
+	780333199,
+	780541055,
+	780748927,
+	780956816,
+	781164721,
+	781372644,
+	781580582,
+	781788537,
+	781996509,
+	782204498,
+	782412503,
+	782620525,
+	782828563,
+	783036618,
+	783244690,
+	783452778,
+	783660883,
+	783869005,
+	784077143,
+	784285298,
+	784493470,
+	784701658,
+	784909863,
+	785118085,
+	785326323,
+	785534578,
+	785742850,
+	785951138,
+	786159443,
+	786367765,
+	786576104,
+	786784459,
+	786992831,
+	787201220,
+	787409625,
+	787618047,
+	787826486,
+	788034942,
+	788243414,
+	788451903,
+	788660409,
+	788868932,
+	789077471,
+	789286027,
+	789494600,
+	789703190,
+	789911796,
+	790120419,
+	790329059,
+	790537716,
+	790746390,
+	790955080,
+	791163787,
+	791372511,
+	791581252,
+	791790010,
+	791998784,
+	792207575,
+	792416383,
+	792625208,
+	792834050,
+	793042908,
+	793251784,
+	793460676,
+	793669585,
+	793878511,
+	794087454,
+	794296413,
+	794505390,
+	794714383,
+	794923394,
+	795132421,
+	795341465,
+	795550525,
+	795759603,
+	795968698,
+	796177809,
+	796386938,
+	796596083,
+	796805246,
+	797014425,
+	797223621,
+	797432834,
+	797642064,
+	797851311,
+	798060574,
+	798269855,
+	798479153,
+	798688467,
+	798897799,
+	799107148,
+	799316513,
+	799525895,
+	799735295,
+	799944711,
+	800154145,
+	800363595,
+	800573062,
+	800782547,
+	800992048,
+	801201566,
+	801411101,
+	801620654,
+	801830223,
+	802039809,
+	802249413,
+	802459033,
+	802668670,
+	802878325,
+	803087996,
+	803297685,
+	803507390,
+	803717113,
+	803926852,
+	804136609,
+	804346383,
+	804556173,
+	804765981,
+	804975806,
+	805185648,
+	805395507,
+	805605383,
+	805815276,
+	806025187,
+	806235114,
+	806445059,
+	806655020,
+	806864999,
+	807074995,
+	807285008,
+	807495038,
+	807705085,
+	807915149,
+	808125231,
+	808335329,
+	808545445,
+	808755578,
+	808965728,
+	809175895,
+	809386079,
+	809596281,
+	809806500,
+	810016735,
+	810226988,
+	810437259,
+	810647546,
+	810857850,
+	811068172,
+	811278511,
+	811488867,
+	811699241,
+	811909631,
+	812120039,
+	812330464,
+	812540906,
+	812751365,
+	812961842,
+	813172336,
+	813382847,
+	813593375,
+	813803921,
+	814014484,
+	814225064,
+	814435661,
+	814646276,
+	814856908,
+	815067557,
+	815278224,
+	815488907,
+	815699608,
+	815910327,
+	816121062,
+	816331815,
+	816542585,
+	816753373,
+	816964177,
+	817175000,
+	817385839,
+	817596696,
+	817807570,
+	818018461,
+	818229370,
+	818440296,
+	818651240,
+	818862200,
+	819073178,
+	819284174,
+	819495187,
+	819706217,
+	819917265,
+	820128330,
+	820339412,
+	820550512,
+	820761629,
+	820972763,
+	821183915,
+	821395084,
+	821606271,
+	821817475,
+	822028697,
+	822239936,
+	822451192,
+	822662466,
+	822873757,
+	823085066,
+	823296392,
+	823507735,
+	823719096,
+	823930475,
+	824141871,
+	824353284,
+	824564715,
+	824776163,
+	824987629,
+	825199112,
+	825410613,
+	825622131,
+	825833667,
+	826045220,
+	826256790,
+	826468379,
+	826679984,
+	826891607,
+	827103248,
+	827314906,
+	827526582,
+	827738275,
+	827949986,
+	828161715,
+	828373461,
+	828585224,
+	828797005,
+	829008804,
+	829220620,
+	829432453,
+	829644305,
+	829856173,
+	830068060,
+	830279964,
+	830491885,
+	830703825,
+	830915781,
+	831127756,
+	831339748,
+	831551757,
+	831763784,
+	831975829,
+	832187892,
+	832399972,
+	832612069,
+	832824185,
+	833036318,
+	833248468,
+	833460636,
+	833672822,
+	833885026,
+	834097247,
+	834309486,
+	834521742,
+	834734017,
+	834946309,
+	835158618,
+	835370945,
+	835583290,
+	835795653,
+	836008033,
+	836220431,
+	836432847,
+	836645281,
+	836857732,
+	837070201,
+	837282687,
+	837495192,
+	837707714,
+	837920254,
+	838132811,
+	838345387,
+	838557980,
+	838770591,
+	838983219,
+	839195866,
+	839408530,
+	839621212,
+	839833912,
+	840046629,
+	840259365,
+	840472118,
+	840684888,
+	840897677,
+	841110484,
+	841323308,
+	841536150,
+	841749010,
+	841961888,
+	842174783,
+	842387697,
+	842600628,
+	842813577,
+	843026544,
+	843239529,
+	843452532,
+	843665552,
+	843878591,
+	844091647,
+	844304721,
+	844517813,
+	844730923,
+	844944051,
+	845157197,
+	845370360,
+	845583542,
+	845796741,
+	846009959,
+	846223194,
+	846436447,
+	846649718,
+	846863007,
+	847076314,
+	847289639,
+	847502982,
+	847716342,
+	847929721,
+	848143118,
+	848356532,
+	848569965,
+	848783416,
+	848996884,
+	849210371,
+	849423875,
+	849637398,
+	849850938,
+	850064497,
+	850278073,
+	850491668,
+	850705280,
+	850918911,
+	851132559,
+	851346226,
+	851559910,
+	851773613,
+	851987333,
+	852201072,
+	852414829,
+	852628604,
+	852842397,
+	853056208,
+	853270036,
+	853483884,
+	853697749,
+	853911632,
+	854125533,
+	854339453,
+	854553390,
+	854767346,
+	854981319,
+	855195311,
+	855409321,
+	855623349,
+	855837395,
+	856051459,
+	856265542,
+	856479642,
+	856693761,
+	856907898,
+	857122053,
+	857336226,
+	857550417,
+	857764626,
+	857978854,
+	858193100,
+	858407364,
+	858621646,
+	858835946,
+	859050264,
+	859264601,
+	859478956,
+	859693329,
+	859907720,
+	860122130,
+	860336558,
+	860551004,
+	860765468,
+	860979950,
+	861194451,
+	861408970,
+	861623507,
+	861838062,
+	862052636,
+	862267228,
+	862481838,
+	862696466,
+	862911113,
+	863125778,
+	863340461,
+	863555163,
+	863769882,
+	863984621,
+	864199377,
+	864414152,
+	864628945,
+	864843756,
+	865058586,
+	865273434,
+	865488300,
+	865703185,
+	865918088,
+	866133009,
+	866347949,
+	866562907,
+	866777883,
+	866992878,
+	867207891,
+	867422923,
+	867637973,
+	867853041,
+	868068128,
+	868283233,
+	868498356,
+	868713498,
+	868928658,
+	869143837,
+	869359034,
+	869574249,
+	869789483,
+	870004736,
+	870220007,
+	870435296,
+	870650603,
+	870865930,
+	871081274,
+	871296637,
+	871512019,
+	871727419,
+	871942837,
+	872158274,
+	872373729,
+	872589203,
+	872804695,
+	873020206,
+	873235736,
+	873451283,
+	873666850,
+	873882435,
+	874098038,
+	874313660,
+	874529300,
+	874744959,
+	874960637,
+	875176333,
+	875392048,
+	875607781,
+	875823532,
+	876039303,
+	876255091,
+	876470899,
+	876686725,
+	876902569,
+	877118433,
+	877334314,
+	877550215,
+	877766134,
+	877982071,
+	878198027,
+	878414002,
+	878629995,
+	878846007,
+	879062038,
+	879278087,
+	879494155,
+	879710242,
+	879926347,
+	880142471,
+	880358613,
+	880574775,
+	880790954,
+	881007153,
+	881223370,
+	881439606,
+	881655861,
+	881872134,
+	882088426,
+	882304737,
+	882521066,
+	882737414,
+	882953781,
+	883170166,
+	883386571,
+	883602993,
+	883819435,
+	884035896,
+	884252375,
+	884468873,
+	884685389,
+	884901925,
+	885118479,
+	885335052,
+	885551644,
+	885768254,
+	885984884,
+	886201532,
+	886418199,
+	886634885,
+	886851589,
+	887068312,
+	887285054,
+	887501815,
+	887718595,
+	887935394,
+	888152211,
+	888369048,
+	888585903,
+	888802777,
+	889019669,
+	889236581,
+	889453512,
+	889670461,
+};
@@ -0,0 +1,114 @@
+/*
+ * fault.c:
+ *	Sensor fault classification, see fault.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "rtd.h"
+#include "curve.h"
+#include "fault.h"
+
+static const char *gFaultName[RTD_FAULT_COUNT] =
+{
+	"ok",
+	"open",
+	"short",
+	"rate",
+	"stuck",
+	"invalid"
+};
+
+const char* rtdFaultName(int code)
+{
+	if ( (code < 0) || (code >= RTD_FAULT_COUNT))
+	{
+		return "unknown";
+	}
+	return gFaultName[code];
+}
+
+/*
+ * rtdFaultCfg:
+ *	Bounds of a channel from its curve, default rate and stuck limits
+ */
+int rtdFaultCfg(int bus, int stack, int ch, int sensorType, RtdFaultCfgType *cfg)
+{
+	const RtdCurveType *c = rtdCurveGet(
+		rtdCurveResolve(rtdCurveBindGet(bus, stack, ch), sensorType));
+
+	if (NULL == c)
+	{
+		return ERROR;
+	}
+	cfg->curve = c;
+	cfg->rMin = c->rMin * RTD_FAULT_SHORT_RATIO;
+	cfg->rMax = (c->rMin + (c->size - 1) / c->rScale) * RTD_FAULT_OPEN_RATIO;
+	cfg->rate = RTD_FAULT_RATE_DEFAULT;
+	cfg->stuckNs = RTD_FAULT_STUCK_DEFAULT * 1000000000ull;
+	return OK;
+}
+
+int rtdFaultBounds(const RtdFaultCfgType *cfg, float res)
+{
+	if (isnan(res))
+	{
+		return RTD_FAULT_INVALID;
+	}
+	if (res > cfg->rMax)
+	{
+		return RTD_FAULT_OPEN;
+	}
+	if (res < cfg->rMin)
+	{
+		return RTD_FAULT_SHORT;
+	}
+	return RTD_FAULT_OK;
+}
+
+/*
+ * rtdFaultRun:
+ *	Classify one sample taken at nowNs (CLOCK_MONOTONIC)
+ */
+int rtdFaultRun(const RtdFaultCfgType *cfg, RtdFaultStateType *s, float res,
+	uint64_t nowNs)
+{
+	uint32_t bits = 0;
+	float temp = 0;
+	double dt = 0;
+	int code = rtdFaultBounds(cfg, res);
+
+	if (code != RTD_FAULT_OK)
+	{
+		return code;
+	}
+	memcpy(&bits, &res, sizeof(bits));
+	if (!s->init || (bits != s->lastBits))
+	{
+		s->lastBits = bits;
+		s->sameNs = nowNs;
+	}
+	else if ( (cfg->stuckNs > 0) && (nowNs - s->sameNs >= cfg->stuckNs))
+	{
+		return RTD_FAULT_STUCK;
+	}
+	temp = rtdCurveTemp(cfg->curve, res);
+	if (s->init && (cfg->rate > 0))
+	{
+		dt = (double) (nowNs - s->goodNs) / 1e9;
+		if (fabs(temp - s->goodTemp) > cfg->rate * dt)
+		{
+			return RTD_FAULT_RATE;
+		}
+	}
+	s->goodTemp = temp;
+	s->goodNs = nowNs;
+	s->init = 1;
+	return RTD_FAULT_OK;
+}
@@ -0,0 +1,66 @@
+#ifndef FAULT_H_
+#define FAULT_H_
+
+#include <stdint.h>
+
+#include "curve.h"
+
+/*
+ * Sensor fault classification of the channel readings, one status code per
+ * sample:
+ *
+ *	open	resistance above the range of the sensor curve (RTD_FAULT_OPEN_RATIO)
+ *	short	resistance below it (RTD_FAULT_SHORT_RATIO)
+ *	rate	temperature moving faster than the limit since the last good sample
+ *	stuck	resistance bit for bit the same for longer than the limit
+ *	invalid	no number
+ *
+ * The range is the one of the curve of the channel (curvewr), so the
+ * sensor type of the card (I2C_MEM_PT1000) for the channels left on
+ * "auto". The bounds need a single reading (rtdFaultBounds), the rate and
+ * stuck checks keep a few bytes of state per channel (rtdFaultRun) and
+ * are run by rtdd on every poll. A faulty sample does not update the
+ * state, a sensor that comes back is checked against its last good
+ * reading, the allowed change grows with the time elapsed.
+ */
+#define RTD_FAULT_SHORT_RATIO	0.5 // of the lowest curve resistance
+#define RTD_FAULT_OPEN_RATIO	1.1 // of the highest one
+#define RTD_FAULT_RATE_DEFAULT	50 // degC/s
+#define RTD_FAULT_STUCK_DEFAULT	60 // s, a card sampling slowly (swswr) updates a channel every few seconds
+
+enum
+{
+	RTD_FAULT_OK = 0,
+	RTD_FAULT_OPEN,
+	RTD_FAULT_SHORT,
+	RTD_FAULT_RATE,
+	RTD_FAULT_STUCK,
+	RTD_FAULT_INVALID,
+	RTD_FAULT_COUNT
+};
+
+typedef struct
+{
+	const RtdCurveType *curve; // temperature for the rate check
+	float rMin; // ohm, short below
+	float rMax; // ohm, open above
+	float rate; // degC/s, 0 for no check
+	uint64_t stuckNs; // 0 for no check
+} RtdFaultCfgType;
+
+typedef struct
+{
+	uint32_t lastBits; // last resistance, as read
+	float goodTemp; // last sample without fault
+	uint64_t sameNs; // time lastBits was first seen
+	uint64_t goodNs;
+	uint8_t init;
+} RtdFaultStateType;
+
+const char* rtdFaultName(int code);
+int rtdFaultCfg(int bus, int stack, int ch, int sensorType, RtdFaultCfgType *cfg);
+int rtdFaultBounds(const RtdFaultCfgType *cfg, float res);
+int rtdFaultRun(const RtdFaultCfgType *cfg, RtdFaultStateType *s, float res,
+	uint64_t nowNs);
+
+#endif //FAULT_H_
@@ -0,0 +1,365 @@
+/*
+ * filter.c:
+ *	Per channel filter chains, see filter.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <time.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "rtd.h"
+#include "filter.h"
+#include "cfgfile.h"
+
+#define FILTER_CFG_MAX	512 // channels with a chain
+#define FILTER_LINE_MAX	128
+#define FILTER_CHECK_NS	1000000000ull // the file is looked at once a second
+
+typedef struct
+{
+	u8 bus;
+	u8 stack;
+	u8 ch;
+	RtdFilterCfgType cfg;
+} FilterEntryType;
+
+static const char *gFilterName[] =
+{
+	"none",
+	"median",
+	"boxcar",
+	"ema"
+};
+
+static FilterEntryType gFilterEntry[FILTER_CFG_MAX];
+static int gFilterEntries = 0;
+static int gFilterLoaded = 0;
+static CfgFileStampType gFilterStamp;
+static uint64_t gFilterCheckNs = 0;
+static pthread_mutex_t gFilterMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t filterNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static const char* filterPath(void)
+{
+	return cfgFilePath("RTD_FILTERS", RTD_FILTER_PATH);
+}
+
+/*
+ * rtdFilterParse:
+ *	"median:5,boxcar:8,ema:0.2" or "none" to a chain, ERROR if invalid
+ */
+int rtdFilterParse(const char *spec, RtdFilterCfgType *cfg)
+{
+	char buff[RTD_FILTER_SPEC_MAX];
+	char *save = NULL;
+	char *tok = NULL;
+	char *arg = NULL;
+	char *end = NULL;
+	double val = 0;
+	int type = 0;
+	int i = 0;
+
+	memset(cfg, 0, sizeof(*cfg));
+	if (0 == strcasecmp(spec, "none"))
+	{
+		return OK;
+	}
+	if (strlen(spec) >= sizeof(buff))
+	{
+		return ERROR;
+	}
+	strcpy(buff, spec);
+	for (tok = strtok_r(buff, ",", &save); NULL != tok; tok = strtok_r(NULL, ",", &save))
+	{
+		if (i >= RTD_FILTER_STAGES)
+		{
+			return ERROR;
+		}
+		arg = strchr(tok, ':');
+		if (NULL == arg)
+		{
+			return ERROR;
+		}
+		*arg++ = 0;
+		for (type = RTD_FILTER_EMA; type > RTD_FILTER_NONE; type--)
+		{
+			if (0 == strcasecmp(tok, gFilterName[type]))
+			{
+				break;
+			}
+		}
+		val = strtod(arg, &end);
+		if ( (type == RTD_FILTER_NONE) || (end == arg) || (*end != 0))
+		{
+			return ERROR;
+		}
+		cfg->stage[i].type = type;
+		if (type == RTD_FILTER_EMA)
+		{
+			if ( !(val > 0) || (val > 1))
+			{
+				return ERROR;
+			}
+			cfg->stage[i].alpha = val;
+		}
+		else
+		{
+			if ( (val != (int)val) || (val < 2) || (val > RTD_FILTER_WIN_MAX)
+				|| ( (type == RTD_FILTER_MEDIAN) && !( (int)val & 1)))
+			{
+				return ERROR;
+			}
+			cfg->stage[i].n = val;
+		}
+		i++;
+	}
+	return (i > 0) ? OK : ERROR;
+}
+
+void rtdFilterFormat(const RtdFilterCfgType *cfg, char *buff, int size)
+{
+	int len = 0;
+	int i = 0;
+
+	snprintf(buff, size, "none");
+	for (i = 0; (i < RTD_FILTER_STAGES) && (cfg->stage[i].type != RTD_FILTER_NONE)
+		&& (len < size); i++)
+	{
+		if (cfg->stage[i].type == RTD_FILTER_EMA)
+		{
+			len += snprintf(buff + len, size - len, "%sema:%g", i ? "," : "",
+				cfg->stage[i].alpha);
+		}
+		else
+		{
+			len += snprintf(buff + len, size - len, "%s%s:%d", i ? "," : "",
+				gFilterName[cfg->stage[i].type], cfg->stage[i].n);
+		}
+	}
+}
+
+void rtdFilterInit(RtdFilterType *f, const RtdFilterCfgType *cfg)
+{
+	memset(f, 0, sizeof(*f));
+	f->cfg = *cfg;
+}
+
+static float filterMedian(const RtdFilterStageType *s)
+{
+	float tmp[RTD_FILTER_WIN_MAX];
+	float v = 0;
+	int i = 0;
+	int j = 0;
+
+	for (i = 0; i < s->count; i++)
+	{
+		v = s->win[i];
+		for (j = i; (j > 0) && (tmp[j - 1] > v); j--)
+		{
+			tmp[j] = tmp[j - 1];
+		}
+		tmp[j] = v;
+	}
+	if (s->count & 1)
+	{
+		return tmp[s->count / 2];
+	}
+	return (tmp[s->count / 2 - 1] + tmp[s->count / 2]) / 2; // window not full yet
+}
+
+/*
+ * rtdFilterRun:
+ *	Push one sample through the chain, return the filtered value
+ */
+float rtdFilterRun(RtdFilterType *f, float x)
+{
+	const RtdFilterStageCfgType *c = NULL;
+	RtdFilterStageType *s = NULL;
+	int i = 0;
+	int k = 0;
+
+	if (isnan(x))
+	{
+		return x;
+	}
+	for (i = 0; (i < RTD_FILTER_STAGES) && (f->cfg.stage[i].type != RTD_FILTER_NONE); i++)
+	{
+		c = &f->cfg.stage[i];
+		s = &f->stage[i];
+		switch (c->type)
+		{
+		case RTD_FILTER_EMA:
+			s->y = (s->count == 0) ? x : s->y + c->alpha * (x - s->y);
+			s->count = 1;
+			x = s->y;
+			break;
+		case RTD_FILTER_BOXCAR:
+			if (s->count == c->n)
+			{
+				s->sum -= s->win[s->pos];
+			}
+			else
+			{
+				s->count++;
+			}
+			s->win[s->pos] = x;
+			s->sum += x;
+			s->pos = (s->pos + 1) % c->n;
+			if (s->pos == 0)
+			{
+				s->sum = 0; // drop the rounding errors once per lap
+				for (k = 0; k < s->count; k++)
+				{
+					s->sum += s->win[k];
+				}
+			}
+			x = s->sum / s->count;
+			break;
+		default:
+			s->win[s->pos] = x;
+			s->pos = (s->pos + 1) % c->n;
+			if (s->count < c->n)
+			{
+				s->count++;
+			}
+			x = filterMedian(s);
+			break;
+		}
+	}
+	return x;
+}
+
+/*
+ * filterLoad:
+ *	Read the chains file, called with gFilterMutex held. A missing file
+ *	means no filter anywhere
+ */
+static void filterLoad(void)
+{
+	char line[FILTER_LINE_MAX];
+	char spec[FILTER_LINE_MAX];
+	RtdFilterCfgType cfg;
+	FILE *in = cfgFileOpen(filterPath());
+	int b = 0;
+	int s = 0;
+	int c = 0;
+
+	gFilterEntries = 0;
+	gFilterLoaded = 1;
+	if (NULL == in)
+	{
+		return;
+	}
+	while ( (NULL != fgets(line, sizeof(line), in)) && (gFilterEntries < FILTER_CFG_MAX))
+	{
+		if ( (4 != sscanf(line, "%d %d %d %127s", &b, &s, &c, spec)) || (b < 0)
+			|| (b >= I2C_BUS_MAX) || (s < 0) || (s > 7) || (c < CHANNEL_NR_MIN)
+			|| (c > RTD_CH_NR_MAX) || (OK != rtdFilterParse(spec, &cfg)))
+		{
+			continue;
+		}
+		gFilterEntry[gFilterEntries].bus = b;
+		gFilterEntry[gFilterEntries].stack = s;
+		gFilterEntry[gFilterEntries].ch = c;
+		gFilterEntry[gFilterEntries++].cfg = cfg;
+	}
+	fclose(in);
+}
+
+/*
+ * filterCheck:
+ *	Read the chains file if it changed since the last time, called with
+ *	gFilterMutex held
+ */
+static int filterCheck(void)
+{
+	if (cfgFileChanged(filterPath(), &gFilterStamp) || !gFilterLoaded)
+	{
+		filterLoad();
+		return 1;
+	}
+	return 0;
+}
+
+/*
+ * rtdFilterRefresh:
+ *	Read the chains file again if it changed, looked at once a second.
+ *	Return 1 if it was read, the callers then reset their filters
+ */
+int rtdFilterRefresh(void)
+{
+	uint64_t now = filterNow();
+	int changed = 0;
+
+	pthread_mutex_lock(&gFilterMutex);
+	if (!gFilterLoaded || (now - gFilterCheckNs >= FILTER_CHECK_NS))
+	{
+		gFilterCheckNs = now;
+		changed = filterCheck();
+	}
+	pthread_mutex_unlock(&gFilterMutex);
+	return changed;
+}
+
+/*
+ * rtdFilterCfgGet:
+ *	Chain of a channel, ERROR if it has none
+ */
+int rtdFilterCfgGet(int bus, int stack, int ch, RtdFilterCfgType *cfg)
+{
+	int ret = ERROR;
+	int i = 0;
+
+	memset(cfg, 0, sizeof(*cfg));
+	pthread_mutex_lock(&gFilterMutex);
+	if (!gFilterLoaded)
+	{
+		filterCheck();
+	}
+	for (i = 0; i < gFilterEntries; i++)
+	{
+		if ( (gFilterEntry[i].bus == bus) && (gFilterEntry[i].stack == stack)
+			&& (gFilterEntry[i].ch == ch))
+		{
+			*cfg = gFilterEntry[i].cfg;
+			ret = OK;
+		}
+	}
+	pthread_mutex_unlock(&gFilterMutex);
+	return ret;
+}
+
+/*
+ * rtdFilterCfgSet:
+ *	Set the chain of a channel, an empty one removes it
+ */
+int rtdFilterCfgSet(int bus, int stack, int ch, const RtdFilterCfgType *cfg)
+{
+	char spec[RTD_FILTER_SPEC_MAX];
+
+	rtdFilterFormat(cfg, spec, sizeof(spec));
+	if (OK != cfgFileSet(filterPath(), bus, stack, ch,
+		(cfg->stage[0].type != RTD_FILTER_NONE) ? spec : NULL))
+	{
+		return ERROR;
+	}
+	pthread_mutex_lock(&gFilterMutex);
+	gFilterLoaded = 0; // seen by this process at once
+	pthread_mutex_unlock(&gFilterMutex);
+	return OK;
+}
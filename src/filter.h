@@ -0,0 +1,74 @@
+#ifndef FILTER_H_
+#define FILTER_H_
+
+#include <stdint.h>
+
+/*
+ * Host side filters of the channel readings, applied in the polling path
+ * (rtdd) and by rtd stream, so the card can switch channels fast and only
+ * the noisy ones are smoothed. Every channel has a chain of up to
+ * RTD_FILTER_STAGES stages, run in order:
+ *
+ *	median:<n>	median of the last n samples, n odd, rejects spikes
+ *	boxcar:<n>	mean of the last n samples
+ *	ema:<alpha>	y += alpha * (x - y), 0 < alpha <= 1
+ *
+ * written "median:5,ema:0.2", "none" for no filter. All the state is in
+ * fixed size rings inside RtdFilterType, nothing is allocated per sample.
+ * A NaN sample goes through as NaN and does not enter the state. The
+ * windows fill up first, a stage outputs over the samples it has.
+ *
+ * The chains are kept in the file /etc/rtd-filters (RTD_FILTERS
+ * environment variable), one "<bus> <stack> <channel> <chain>" line each,
+ * read again by rtdFilterRefresh() when it changes.
+ */
+#define RTD_FILTER_PATH	"/etc/rtd-filters"
+#define RTD_FILTER_STAGES	4
+#define RTD_FILTER_WIN_MAX	16
+#define RTD_FILTER_SPEC_MAX	64
+
+enum
+{
+	RTD_FILTER_NONE = 0,
+	RTD_FILTER_MEDIAN,
+	RTD_FILTER_BOXCAR,
+	RTD_FILTER_EMA,
+};
+
+typedef struct
+{
+	uint8_t type; // RTD_FILTER_*
+	uint8_t n; // window, median and boxcar
+	float alpha; // ema
+} RtdFilterStageCfgType;
+
+typedef struct
+{
+	RtdFilterStageCfgType stage[RTD_FILTER_STAGES]; // ends at the first RTD_FILTER_NONE
+} RtdFilterCfgType;
+
+typedef struct
+{
+	float win[RTD_FILTER_WIN_MAX];
+	double sum; // boxcar
+	float y; // ema
+	uint8_t pos;
+	uint8_t count;
+} RtdFilterStageType;
+
+typedef struct
+{
+	RtdFilterCfgType cfg;
+	RtdFilterStageType stage[RTD_FILTER_STAGES];
+} RtdFilterType;
+
+int rtdFilterParse(const char *spec, RtdFilterCfgType *cfg);
+void rtdFilterFormat(const RtdFilterCfgType *cfg, char *buff, int size);
+void rtdFilterInit(RtdFilterType *f, const RtdFilterCfgType *cfg);
+float rtdFilterRun(RtdFilterType *f, float x);
+
+int rtdFilterCfgGet(int bus, int stack, int ch, RtdFilterCfgType *cfg);
+int rtdFilterCfgSet(int bus, int stack, int ch, const RtdFilterCfgType *cfg);
+int rtdFilterRefresh(void);
+
+#endif //FILTER_H_
@@ -143,7 +143,7 @@ int doLedModeRead(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -152,20 +152,20 @@ int doLedModeRead(int argc, char *argv[])
 		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 		{
 			printf("RTD channel number value out of range!\n");
-			exit(1);
+			return FAIL;
 		}
 
 		if (OK != ledGetMode(dev, ch, &val))
 		{
 			printf("Fail to read!\n");
-			exit(1);
+			return FAIL;
 		}
 		printf("%d\n", val);
 	}
 	else
 	{
 		printf("Invalid arguments number for %s cmd\n", argv[0]);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -179,7 +179,7 @@ int doLedModeWrite(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 5)
@@ -188,7 +188,7 @@ int doLedModeWrite(int argc, char *argv[])
 		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 		{
 			printf("RTD channel number value out of range!\n");
-			exit(1);
+			return FAIL;
 		}
 
 		val = atoi(argv[4]);
@@ -196,13 +196,13 @@ int doLedModeWrite(int argc, char *argv[])
 		if (OK != ledSetMode(dev, ch, val))
 		{
 			printf("Fail to write!\n");
-			exit(1);
+			return FAIL;
 		}
 	}
 	else
 	{
 		printf("Invalid arguments number for %s cmd\n", argv[0]);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -216,7 +216,7 @@ int doLedThresholdRead(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -225,20 +225,20 @@ int doLedThresholdRead(int argc, char *argv[])
 		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 		{
 			printf("RTD channel number value out of range!\n");
-			exit(1);
+			return FAIL;
 		}
 
 		if (OK != ledGetThreshold(dev, ch, &val))
 		{
 			printf("Fail to read!\n");
-			exit(1);
+			return FAIL;
 		}
 		printf("%d\n", val);
 	}
 	else
 	{
 		printf("Invalid arguments number for %s cmd\n", argv[0]);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -252,7 +252,7 @@ int doLedThresholdWrite(int argc, char *argv[])
 		dev = doBoardInit(atoi(argv[1]));
 		if (dev <= 0)
 		{
-			exit(1);
+			return FAIL;
 		}
 
 		if (argc == 5)
@@ -261,7 +261,7 @@ int doLedThresholdWrite(int argc, char *argv[])
 			if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 			{
 				printf("RTD channel number value out of range!\n");
-				exit(1);
+				return FAIL;
 			}
 
 			val = atoi(argv[4]);
@@ -269,13 +269,13 @@ int doLedThresholdWrite(int argc, char *argv[])
 			if (OK != ledSetThreshold(dev, ch, val))
 			{
 				printf("Fail to write!\n");
-				exit(1);
+				return FAIL;
 			}
 		}
 		else
 		{
 			printf("Invalid arguments number for %s cmd\n", argv[0]);
-			exit(1);
+			return FAIL;
 		}
 		return OK;
 }
@@ -0,0 +1,127 @@
+/*
+ * metrics.c:
+ *	Minimal HTTP/1.0 server answering GET /metrics for the rtdd daemon,
+ *	one short lived thread per connection.
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "rtd.h"
+#include "metrics.h"
+#include "tcpsrv.h"
+
+#define METRICS_REQ_MAX	4096
+#define METRICS_TIMEOUT_S	5
+
+static void* metricsClientThread(void *arg);
+
+static MetricsRenderType gRender = NULL;
+static TcpSrvType gSrv = {-1, METRICS_TIMEOUT_S, 0, metricsClientThread};
+
+static int metricsWriteFull(int fd, const char *buff, size_t size)
+{
+	ssize_t n = 0;
+
+	while (size > 0)
+	{
+		n = write(fd, buff, size);
+		if (n <= 0)
+		{
+			return -1;
+		}
+		buff += n;
+		size -= n;
+	}
+	return 0;
+}
+
+static void metricsReply(int fd, const char *status, const char *type,
+	const char *body, size_t len)
+{
+	char hdr[256];
+	int n = 0;
+
+	n = snprintf(hdr, sizeof(hdr), "HTTP/1.0 %s\r\nContent-Type: %s\r\n"
+		"Content-Length: %zu\r\nConnection: close\r\n\r\n", status, type, len);
+	if (0 == metricsWriteFull(fd, hdr, n))
+	{
+		metricsWriteFull(fd, body, len);
+	}
+}
+
+static void* metricsClientThread(void *arg)
+{
+	int fd = (int)(intptr_t)arg;
+	char req[METRICS_REQ_MAX];
+	char *body = NULL;
+	size_t len = 0;
+	FILE *out = NULL;
+	int got = 0;
+	int n = 0;
+
+	// the request line is all we need, wait for the end of the headers
+	while (got < METRICS_REQ_MAX - 1)
+	{
+		n = read(fd, req + got, METRICS_REQ_MAX - 1 - got);
+		if (n <= 0)
+		{
+			break;
+		}
+		got += n;
+		req[got] = 0;
+		if (NULL != strstr(req, "\r\n\r\n") || NULL != strstr(req, "\n\n"))
+		{
+			break;
+		}
+	}
+	req[got] = 0;
+	if (0 != strncmp(req, "GET ", 4))
+	{
+		metricsReply(fd, "405 Method Not Allowed", "text/plain", "", 0);
+	}
+	else if ( (0 != strncmp(req + 4, "/metrics", 8))
+		|| ( (req[12] != ' ') && (req[12] != '?')))
+	{
+		metricsReply(fd, "404 Not Found", "text/plain", "", 0);
+	}
+	else if (NULL != (out = open_memstream(&body, &len)))
+	{
+		gRender(out);
+		fprintf(out, "# EOF\n");
+		fclose(out);
+		metricsReply(fd, "200 OK", METRICS_CONTENT_TYPE, body, len);
+		free(body);
+	}
+	close(fd);
+	return NULL;
+}
+
+/*
+ * metricsListen:
+ *	Bind the given TCP port, before rtdd detaches so a failure is reported
+ */
+int metricsListen(int port, MetricsRenderType render)
+{
+	if (NULL == render)
+	{
+		return ERROR;
+	}
+	gRender = render;
+	return tcpSrvListen(&gSrv, port);
+}
+
+/*
+ * metricsStart:
+ *	Serve the scrapes of the bound port from a background thread
+ */
+int metricsStart(void)
+{
+	return tcpSrvStart(&gSrv);
+}
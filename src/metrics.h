@@ -0,0 +1,19 @@
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#include <stdio.h>
+
+/*
+ * OpenMetrics (Prometheus) HTTP endpoint of rtdd. A scrape only formats the
+ * values the daemon already holds, it never waits for the bus.
+ */
+#define METRICS_PORT_DEFAULT	9110
+#define METRICS_CONTENT_TYPE	"application/openmetrics-text; version=1.0.0; charset=utf-8"
+
+/* writes the metric families, the server appends "# EOF" */
+typedef void (*MetricsRenderType)(FILE *out);
+
+int metricsListen(int port, MetricsRenderType render);
+int metricsStart(void);
+
+#endif //METRICS_H_
@@ -0,0 +1,307 @@
+/*
+ * modbus.c:
+ *	Modbus TCP server of the rtdd daemon, one thread per connection.
+ *	Implements the function codes of the card RTU port: 1, 2, 3, 4, 5, 6,
+ *	15 and 16.
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "modbus.h"
+#include "tcpsrv.h"
+
+#define MB_MBAP_SIZE	7 // transaction, protocol, length, unit
+#define MB_PDU_MAX	253
+#define MB_ADU_MAX	(MB_MBAP_SIZE + MB_PDU_MAX)
+#define MB_TCP_TIMEOUT_S	60 // idle client, Modbus masters poll far more often
+
+static void* mbClientThread(void *arg);
+
+static const MbHandlerType *gHandler = NULL;
+static TcpSrvType gSrv = {-1, MB_TCP_TIMEOUT_S, 1, mbClientThread};
+
+static u16 mbGet16(const u8 *p)
+{
+	return ((u16)p[0] << 8) | p[1];
+}
+
+static void mbPut16(u8 *p, u16 val)
+{
+	p[0] = val >> 8;
+	p[1] = val & 0xff;
+}
+
+static int mbException(u8 *resp, u8 func, int code)
+{
+	resp[0] = func | 0x80;
+	resp[1] = code;
+	return 2;
+}
+
+static int mbReadBits(u16 bits, const u8 *req, int len, u8 *resp)
+{
+	int start = 0;
+	int qty = 0;
+	int i = 0;
+
+	if (len != 5)
+	{
+		return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+	}
+	start = mbGet16(&req[1]);
+	qty = mbGet16(&req[3]);
+	if ( (qty < 1) || (qty > 2000))
+	{
+		return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+	}
+	if (start + qty > MB_COILS_NR)
+	{
+		return mbException(resp, req[0], MB_EX_ILLEGAL_ADDRESS);
+	}
+	resp[0] = req[0];
+	resp[1] = (qty + 7) / 8;
+	memset(&resp[2], 0, resp[1]);
+	for (i = 0; i < qty; i++)
+	{
+		if (bits & (1 << (start + i)))
+		{
+			resp[2 + i / 8] |= 1 << (i % 8);
+		}
+	}
+	return 2 + resp[1];
+}
+
+static int mbReadRegs(const u16 *reg, int regNr, const u8 *req, int len,
+	u8 *resp)
+{
+	int start = 0;
+	int qty = 0;
+	int i = 0;
+
+	if (len != 5)
+	{
+		return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+	}
+	start = mbGet16(&req[1]);
+	qty = mbGet16(&req[3]);
+	if ( (qty < 1) || (qty > 125))
+	{
+		return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+	}
+	if (start + qty > regNr)
+	{
+		return mbException(resp, req[0], MB_EX_ILLEGAL_ADDRESS);
+	}
+	resp[0] = req[0];
+	resp[1] = 2 * qty;
+	for (i = 0; i < qty; i++)
+	{
+		mbPut16(&resp[2 + 2 * i], reg[start + i]);
+	}
+	return 2 + resp[1];
+}
+
+/*
+ * mbProcess:
+ *	Answer one PDU, return the response PDU length
+ */
+static int mbProcess(int unit, const u8 *req, int len, u8 *resp)
+{
+	MbImageType img;
+	u16 coils = 0;
+	u16 holding[MB_HOLDINGS_NR];
+	int start = 0;
+	int qty = 0;
+	int ret = 0;
+	int i = 0;
+
+	if (len < 1)
+	{
+		return 0;
+	}
+	if ( (unit > 7) || (OK != gHandler->imageGet(unit, &img)))
+	{
+		return mbException(resp, req[0], MB_EX_TARGET_FAILED);
+	}
+	switch (req[0])
+	{
+	case 0x01:
+	case 0x02: // the card answers the coils as discrete inputs too
+		return mbReadBits(img.coils, req, len, resp);
+	case 0x03:
+		return mbReadRegs(img.holding, MB_HOLDINGS_NR, req, len, resp);
+	case 0x04:
+		return mbReadRegs(img.input, MB_INPUTS_NR, req, len, resp);
+	case 0x05:
+		if (len != 5)
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+		}
+		start = mbGet16(&req[1]);
+		if (start >= MB_COILS_NR)
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_ADDRESS);
+		}
+		if (mbGet16(&req[3]) == 0xff00)
+		{
+			coils = img.coils | (1 << start);
+		}
+		else if (mbGet16(&req[3]) == 0x0000)
+		{
+			coils = img.coils & ~(1 << start);
+		}
+		else
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+		}
+		ret = gHandler->coilsWrite(unit, coils);
+		break;
+	case 0x06:
+		if (len != 5)
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+		}
+		start = mbGet16(&req[1]);
+		if (start >= MB_HOLDINGS_NR)
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_ADDRESS);
+		}
+		memcpy(holding, img.holding, sizeof(holding));
+		holding[start] = mbGet16(&req[3]);
+		ret = gHandler->holdingWrite(unit, holding, start, 1);
+		break;
+	case 0x0f:
+		if (len < 6)
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+		}
+		start = mbGet16(&req[1]);
+		qty = mbGet16(&req[3]);
+		if ( (qty < 1) || (qty > 0x7b0) || (req[5] != (qty + 7) / 8)
+			|| (len != 6 + req[5]))
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+		}
+		if (start + qty > MB_COILS_NR)
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_ADDRESS);
+		}
+		coils = img.coils;
+		for (i = 0; i < qty; i++)
+		{
+			coils &= ~(1 << (start + i));
+			if (req[6 + i / 8] & (1 << (i % 8)))
+			{
+				coils |= 1 << (start + i);
+			}
+		}
+		ret = gHandler->coilsWrite(unit, coils);
+		break;
+	case 0x10:
+		if (len < 6)
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+		}
+		start = mbGet16(&req[1]);
+		qty = mbGet16(&req[3]);
+		if ( (qty < 1) || (qty > 0x7b) || (req[5] != 2 * qty)
+			|| (len != 6 + req[5]))
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_VALUE);
+		}
+		if (start + qty > MB_HOLDINGS_NR)
+		{
+			return mbException(resp, req[0], MB_EX_ILLEGAL_ADDRESS);
+		}
+		memcpy(holding, img.holding, sizeof(holding));
+		for (i = 0; i < qty; i++)
+		{
+			holding[start + i] = mbGet16(&req[6 + 2 * i]);
+		}
+		ret = gHandler->holdingWrite(unit, holding, start, qty);
+		break;
+	default:
+		return mbException(resp, req[0], MB_EX_ILLEGAL_FUNCTION);
+	}
+	if (ret != OK)
+	{
+		return mbException(resp, req[0], ret);
+	}
+	memcpy(resp, req, 5); // writes echo the function, address and value/qty
+	return 5;
+}
+
+static int mbReadFull(int fd, u8 *buff, int size)
+{
+	int got = 0;
+	int n = 0;
+
+	while (got < size)
+	{
+		n = read(fd, buff + got, size - got);
+		if (n <= 0)
+		{
+			return -1;
+		}
+		got += n;
+	}
+	return 0;
+}
+
+static void* mbClientThread(void *arg)
+{
+	int fd = (int)(intptr_t)arg;
+	u8 req[MB_ADU_MAX];
+	u8 resp[MB_ADU_MAX];
+	int len = 0;
+	int n = 0;
+
+	while (0 == mbReadFull(fd, req, MB_MBAP_SIZE))
+	{
+		len = mbGet16(&req[4]); // unit id + PDU
+		if ( (mbGet16(&req[2]) != 0) || (len < 2) || (len > MB_PDU_MAX + 1)
+			|| (0 != mbReadFull(fd, req + MB_MBAP_SIZE, len - 1)))
+		{
+			break;
+		}
+		n = mbProcess(req[6], req + MB_MBAP_SIZE, len - 1, resp + MB_MBAP_SIZE);
+		memcpy(resp, req, MB_MBAP_SIZE);
+		mbPut16(&resp[4], n + 1);
+		if (write(fd, resp, MB_MBAP_SIZE + n) != MB_MBAP_SIZE + n)
+		{
+			break;
+		}
+	}
+	close(fd);
+	return NULL;
+}
+
+/*
+ * mbTcpListen:
+ *	Bind the given TCP port, before rtdd detaches so a failure is reported
+ */
+int mbTcpListen(int port, const MbHandlerType *handler)
+{
+	if (NULL == handler)
+	{
+		return ERROR;
+	}
+	gHandler = handler;
+	return tcpSrvListen(&gSrv, port);
+}
+
+/*
+ * mbTcpStart:
+ *	Serve the requests of the bound port from a background thread
+ */
+int mbTcpStart(void)
+{
+	return tcpSrvStart(&gSrv);
+}
@@ -0,0 +1,57 @@
+#ifndef MODBUS_H_
+#define MODBUS_H_
+
+#include "rtd.h"
+
+/*
+ * Modbus TCP gateway of rtdd. The register map is the one of the card
+ * RS-485 Modbus RTU port (MODBUS.md), the unit id selects the stack level.
+ * Reads are answered from the image the daemon keeps up to date, writes
+ * are forwarded to the card.
+ */
+#define MB_TCP_PORT_DEFAULT	502
+#define MB_COILS_NR	16 // LEDx_THRESHOLD_HI_EN / LO_EN, bit i of RTD_LEDS_FUNC
+#define MB_INPUTS_NR	32 // TEMP_1..8 (0.1 degC), R_IN_1..8 (ohm), FAULT_1..8, TEMP_FILT_1..8
+#define MB_IN_FAULT1	16 // gateway only, RTD_FAULT_* of the channels
+#define MB_IN_TEMP_FILT1	24 // gateway only, 0.1 degC through the filter chains
+#define MB_HOLDINGS_NR	11 // LED_TEMP_TH_1..8, BAUD_100, ADD_OFFSET, SENSOR_TYPE
+
+enum
+{
+	MB_HOLD_LED_TH1 = 0,
+	MB_HOLD_BAUD_100 = MB_HOLD_LED_TH1 + RTD_CH_NR_MAX,
+	MB_HOLD_ADD_OFFSET,
+	MB_HOLD_SENSOR_TYPE,
+};
+
+enum
+{
+	MB_EX_ILLEGAL_FUNCTION = 1,
+	MB_EX_ILLEGAL_ADDRESS = 2,
+	MB_EX_ILLEGAL_VALUE = 3,
+	MB_EX_DEVICE_FAILURE = 4,
+	MB_EX_TARGET_FAILED = 0x0b,
+};
+
+typedef struct
+{
+	u16 coils;
+	u16 input[MB_INPUTS_NR];
+	u16 holding[MB_HOLDINGS_NR];
+} MbImageType;
+
+/*
+ * Provided by the daemon. The write functions get the complete new coils
+ * or holding registers image and return OK or a MB_EX_* exception code.
+ */
+typedef struct
+{
+	int (*imageGet)(int unit, MbImageType *img);
+	int (*coilsWrite)(int unit, u16 coils);
+	int (*holdingWrite)(int unit, const u16 *holding, int first, int count);
+} MbHandlerType;
+
+int mbTcpListen(int port, const MbHandlerType *handler);
+int mbTcpStart(void);
+
+#endif //MODBUS_H_
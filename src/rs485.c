@@ -92,29 +92,29 @@ int doRs485Read(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
-	if (OK != rtdHwTypeGet(dev, &card))
+	if (OK != boardHwTypeGet(atoi(argv[1]), dev, &card))
 	{
 		printf("Fail to read card type!\n");
-		exit(1);
+		return FAIL;
 	}
 	if (card < 1)
 	{
 		printf("Available only for hardware version >= 5.0!\n");
-		exit(1);
+		return FAIL;
 	}
 	if (argc == 3)
 	{
 		if (OK != rs485Get(dev))
 		{
-			exit(1);
+			return FAIL;
 		}
 	}
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_RS485_READ.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -140,17 +140,17 @@ int doRs485Write(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
-	if (OK != rtdHwTypeGet(dev, &card))
+	if (OK != boardHwTypeGet(atoi(argv[1]), dev, &card))
 	{
 		printf("Fail to read card type!\n");
-		exit(1);
+		return FAIL;
 	}
 	if (card < 1)
 	{
 		printf("Available only for hardware version >= 5.0!\n");
-		exit(1);
+		return FAIL;
 	}
 	if (argc == 8)
 	{
@@ -161,14 +161,14 @@ int doRs485Write(int argc, char *argv[])
 		add = 0xff & atoi(argv[7]);
 		if (OK != rs485Set(dev, mode, baud, stopB, parity, add))
 		{
-			exit(1);
+			return FAIL;
 		}
 		printf("done\n");
 	}
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_RS485_WRITE.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -12,6 +12,11 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <signal.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "rtd.h"
 #include "comm.h"
@@ -19,6 +24,15 @@
 #include "wdt.h"
 #include "led.h"
 #include "rs485.h"
+#include "buslock.h"
+#include "rtdd.h"
+#include "rtdhist.h"
+#include "rtdbin.h"
+#include "rtdconv.h"
+#include "curve.h"
+#include "calib.h"
+#include "filter.h"
+#include "fault.h"
 
 #define VERSION_BASE	(int)1
 #define VERSION_MAJOR	(int)3
@@ -74,6 +88,83 @@ const CliCmdType CMD_LIST =
 		"",
 		"\tExample:    rtd -list display all the connected rtd cards \n"};
 
+int doDiscover(int argc, char *argv[]);
+const CliCmdType CMD_DISCOVER =
+	{
+		"-discover",
+		1,
+		&doDiscover,
+		"\t-discover:  Scan all the i2c buses for rtd cards, display bus, stack level, hardware and firmware version\n",
+		"\tUsage:      rtd -discover\n",
+		"",
+		"\tExample:    rtd -discover display all the rtd cards on all i2c buses\n"};
+
+int doLockStat(int argc, char *argv[]);
+const CliCmdType CMD_LOCK_STAT =
+	{
+		"-lockstat",
+		1,
+		&doLockStat,
+		"\t-lockstat:  Display the i2c bus arbitration statistics (grants, wait and hold time)\n",
+		"\tUsage:      rtd -lockstat\n",
+		"",
+		"\tExample:    rtd -lockstat display the arbitration statistics for the current bus\n"};
+
+int doBatch(int argc, char *argv[]);
+const CliCmdType CMD_BATCH =
+	{
+		"-batch",
+		1,
+		&doBatch,
+		"\t-batch:     Run the commands read from a file or stdin, one per line without the leading \"rtd\", in one process\n",
+		"\tUsage:      rtd -batch [file]\n",
+		"\tUsage:      rtd -batch -bin <capture> [file]; also append the values read to a binary capture\n",
+		"\tExample:    rtd -batch cmds.txt; every command output is followed by the status line \"# <line> OK\" or \"# <line> FAIL\"\n"};
+
+int doDecode(int argc, char *argv[]);
+const CliCmdType CMD_DECODE =
+	{
+		"-decode",
+		1,
+		&doDecode,
+		"\t-decode:    Display a binary capture (stream -bin, batch -bin) as text, one line per record: monotonic time (s), real time (s), values\n",
+		"\tUsage:      rtd -decode [file]\n",
+		"",
+		"\tExample:    rtd 0 stream 100 -bin | rtd -decode; decode a live capture from stdin\n"};
+
+int doPoly5Bench(int argc, char *argv[]);
+const CliCmdType CMD_POLY5_BENCH =
+	{
+		"-poly5bench",
+		1,
+		&doPoly5Bench,
+		"\t-poly5bench: Time the resistance to temperature conversion kernels usable on this CPU and check them against the scalar code, fails above 4 float ULPs\n",
+		"\tUsage:      rtd -poly5bench [samples]\n",
+		"",
+		"\tExample:    rtd -poly5bench 1000000; convert one million resistances with every kernel\n"};
+
+int doCvdBench(int argc, char *argv[]);
+const CliCmdType CMD_CVD_BENCH =
+	{
+		"-cvdbench",
+		1,
+		&doCvdBench,
+		"\t-cvdbench:  Time the Callendar-Van Dusen conversions and compare their accuracy, and the one of the poly5 fit, to the exact solution, fails above their error bound\n",
+		"\tUsage:      rtd -cvdbench [samples]\n",
+		"",
+		"\tExample:    rtd -cvdbench 1000000\n"};
+
+int doFixBench(int argc, char *argv[]);
+const CliCmdType CMD_FIX_BENCH =
+	{
+		"-fixbench",
+		1,
+		&doFixBench,
+		"\t-fixbench:  Time the integer conversion to 0.01 and 0.1 degC against the float one, count the values that differ from the exact solution rounded, fails if one is off by more than one\n",
+		"\tUsage:      rtd -fixbench [samples]\n",
+		"",
+		"\tExample:    rtd -fixbench 1000000\n"};
+
 int doRtdRead(int argc, char *argv[]);
 const CliCmdType CMD_READ =
 	{
@@ -93,9 +184,20 @@ const CliCmdType CMD_READ_R =
 		&doRtdReadR,
 		"\treadres:    Read rtd channel resistance\n",
 		"\tUsage:      rtd <id> readres <channel>\n",
-		"",
+		"\tUsage:      rtd all readres [table|csv|json]\n",
 		"\tExample:    rtd 0 readres 2; Read the resistance on channel #2 on Board #0\n"};
 
+int doRtdReadFilt(int argc, char *argv[]);
+const CliCmdType CMD_READ_FILT =
+	{
+		"readfilt",
+		2,
+		&doRtdReadFilt,
+		"\treadfilt:   Read rtd channel temperature through its filter chain, from the running rtdd\n",
+		"\tUsage:      rtd <id> readfilt <channel>\n",
+		"",
+		"\tExample:    rtd 0 readfilt 2; Read the filtered temperature on channel #2 on Board #0\n"};
+
 int doRtdReadPoly5(int argc, char *argv[]);
 const CliCmdType CMD_READ_POLY5 =
 	{
@@ -107,6 +209,160 @@ const CliCmdType CMD_READ_POLY5 =
 		"",
 		"\tExample:    rtd 0 readpoly5 2; Read the temperature on channel #2 on Board #0\n"};
 
+int doRtdReadCvd(int argc, char *argv[]);
+const CliCmdType CMD_READ_CVD =
+	{
+		"readcvd",
+		2,
+		&doRtdReadCvd,
+		"\treadcvd:    Read rtd resistance and convert it with the IEC 60751 Callendar-Van Dusen equation for the sensor type of the card (styperd)\n",
+		"\tUsage:      rtd <id> readcvd <channel> [cubic|linear|exact]\n",
+		"",
+		"\tExample:    rtd 0 readcvd 2; Read the temperature on channel #2 on Board #0, table with cubic interpolation\n"};
+
+int doRtdReadFix(int argc, char *argv[]);
+const CliCmdType CMD_READ_FIX =
+	{
+		"readfix",
+		2,
+		&doRtdReadFix,
+		"\treadfix:    Read rtd resistance and convert it with integer operations only, to 0.01 degC (default), 0.1 degC as the Modbus registers, or milliohm\n",
+		"\tUsage:      rtd <id> readfix <channel> [centi|deci|mohm]\n",
+		"",
+		"\tExample:    rtd 0 readfix 2 deci; Read the temperature on channel #2 on Board #0 in 0.1 degC\n"};
+
+int doRtdReadCurve(int argc, char *argv[]);
+const CliCmdType CMD_READ_CURVE =
+	{
+		"readcurve",
+		2,
+		&doRtdReadCurve,
+		"\treadcurve:  Read rtd resistance and convert it with the curve bound to the channel (curvewr)\n",
+		"\tUsage:      rtd <id> readcurve [channel]\n",
+		"",
+		"\tExample:    rtd 0 readcurve; Read the temperature on all channels on Board #0, each with its own curve\n"};
+
+int doFault(int argc, char *argv[]);
+const CliCmdType CMD_FAULT =
+	{
+		"fault",
+		2,
+		&doFault,
+		"\tfault:      Display the sensor fault of the channels: ok, open, short, rate, stuck or invalid\n",
+		"\tUsage:      rtd <id> fault [channel]\n",
+		"",
+		"\tExample:    rtd 0 fault 2; Display the fault status of channel #2 on Board #0, rate and stuck need the rtdd daemon\n"};
+
+int doCurveRead(int argc, char *argv[]);
+const CliCmdType CMD_CURVE_READ =
+	{
+		"curverd",
+		2,
+		&doCurveRead,
+		"\tcurverd:    Display the curve used by every channel, \"auto\" follows the sensor type of the card\n",
+		"\tUsage:      rtd <id> curverd\n",
+		"",
+		"\tExample:    rtd 0 curverd; Display the curves of the channels on Board #0\n"};
+
+int doCurveWrite(int argc, char *argv[]);
+const CliCmdType CMD_CURVE_WRITE =
+	{
+		"curvewr",
+		2,
+		&doCurveWrite,
+		"\tcurvewr:    Bind a channel to a sensor curve (rtd -curves), \"auto\" removes the binding\n",
+		"\tUsage:      rtd <id> curvewr <channel|all> <curve|auto>\n",
+		"",
+		"\tExample:    rtd 0 curvewr 3 ni120; Channel #3 on Board #0 has a Ni120 sensor\n"};
+
+int doFilterRead(int argc, char *argv[]);
+const CliCmdType CMD_FILTER_READ =
+	{
+		"filterrd",
+		2,
+		&doFilterRead,
+		"\tfilterrd:   Display the filter chain of every channel, used by rtdd and stream\n",
+		"\tUsage:      rtd <id> filterrd\n",
+		"",
+		"\tExample:    rtd 0 filterrd; Display the filters of the channels on Board #0\n"};
+
+int doFilterWrite(int argc, char *argv[]);
+const CliCmdType CMD_FILTER_WRITE =
+	{
+		"filterwr",
+		2,
+		&doFilterWrite,
+		"\tfilterwr:   Set the filter chain of a channel: median:<n> (n odd), boxcar:<n>, ema:<alpha>, up to 4 stages, n <= 16\n",
+		"\tUsage:      rtd <id> filterwr <channel|all> <chain|none>\n",
+		"",
+		"\tExample:    rtd 0 filterwr 2 median:5,ema:0.2; Reject the spikes on channel #2 of Board #0, then smooth it\n"};
+
+int doCurveList(int argc, char *argv[]);
+const CliCmdType CMD_CURVE_LIST =
+	{
+		"-curves",
+		1,
+		&doCurveList,
+		"\t-curves:    List the sensor curves built in this program\n",
+		"\tUsage:      rtd -curves\n",
+		"",
+		"\tExample:    rtd -curves\n"};
+
+int doRtdReadAll(int argc, char *argv[]);
+const CliCmdType CMD_READ_ALL =
+	{
+		"readall",
+		2,
+		&doRtdReadAll,
+		"\treadall:    Read rtd temperature on all channels in one transfer\n",
+		"\tUsage:      rtd <id> readall\n",
+		"\tUsage:      rtd all readall [table|csv|json]\n",
+		"\tExample:    rtd 0 readall; Read the temperature on all channels on Board #0\n\t            rtd all readall csv; Read all channels of every card on every bus, one line per card\n"};
+
+int doRtdReadRAll(int argc, char *argv[]);
+const CliCmdType CMD_READ_R_ALL =
+	{
+		"readresall",
+		2,
+		&doRtdReadRAll,
+		"\treadresall: Read rtd resistance on all channels in one transfer\n",
+		"\tUsage:      rtd <id> readresall\n",
+		"\tUsage:      rtd all readresall [table|csv|json]\n",
+		"\tExample:    rtd 0 readresall; Read the resistance on all channels on Board #0\n"};
+
+int doRtdReadPoly5All(int argc, char *argv[]);
+const CliCmdType CMD_READ_POLY5_ALL =
+	{
+		"readpoly5all",
+		2,
+		&doRtdReadPoly5All,
+		"\treadpoly5all: Read rtd temperature on all channels in one transfer, using 5th order polynomial fit\n",
+		"\tUsage:      rtd <id> readpoly5all\n",
+		"",
+		"\tExample:    rtd 0 readpoly5all; Read the temperature on all channels on Board #0\n"};
+
+int doHistory(int argc, char *argv[]);
+const CliCmdType CMD_HISTORY =
+	{
+		"hist",
+		2,
+		&doHistory,
+		"\thist:       Display the samples of one channel recorded by the rtdd daemon in the last seconds\n",
+		"\tUsage:      rtd <id> hist <channel> <seconds>\n",
+		"",
+		"\tExample:    rtd 0 hist 2 10; Display time (s), temperature and resistance of channel #2 on Board #0 for the last 10 seconds\n"};
+
+int doStream(int argc, char *argv[]);
+const CliCmdType CMD_STREAM =
+	{
+		"stream",
+		2,
+		&doStream,
+		"\tstream:     Sample the temperatures at a fixed rate until Ctrl-C, one line per sample: monotonic time (s), real time (s), values\n",
+		"\tUsage:      rtd <id> stream <rate_hz> [channels]\n",
+		"\tUsage:      rtd <id> stream <rate_hz> [channels] -bin; binary records instead of text, see rtd -decode\n",
+		"\tExample:    rtd 0 stream 20 1,3-4; Sample channels #1, #3 and #4 on Board #0 20 times a second, missed deadlines are reported on stderr\n"};
+
 int doRtdCalib(int argc, char *argv[]);
 const CliCmdType CMD_CALIB =
 	{
@@ -129,6 +385,61 @@ const CliCmdType CMD_CALIB_RST =
 		"",
 		"\tExample:    rtd 0 calrst 2; Reset calibration data at factory default for channel #2 on card #0 \n"};
 
+int doHostCalibWrite(int argc, char *argv[]);
+const CliCmdType CMD_HCALIB_WRITE =
+	{
+		"hcalwr",
+		2,
+		&doHostCalibWrite,
+		"\thcalwr:     Set the host calibration profile of a channel, applied to every reading: R' = offset + gain * (R - lead) + quad * (R - lead)^2\n",
+		"\tUsage:      rtd <id> hcalwr <channel> <lead ohm> <offset ohm> <gain> [<quad> [<probe id>]]\n",
+		"",
+		"\tExample:    rtd 0 hcalwr 2 0.42 -0.05 1.0003 0 P1234; 0.42 ohm leads and probe P1234 correction on channel #2 on card #0\n"};
+
+int doHostCalibRead(int argc, char *argv[]);
+const CliCmdType CMD_HCALIB_READ =
+	{
+		"hcalrd",
+		2,
+		&doHostCalibRead,
+		"\thcalrd:     Display the host calibration profiles of a card\n",
+		"\tUsage:      rtd <id> hcalrd [channel]\n",
+		"",
+		"\tExample:    rtd 0 hcalrd; Display the profiles of the channels on card #0\n"};
+
+int doHostCalibRst(int argc, char *argv[]);
+const CliCmdType CMD_HCALIB_RST =
+	{
+		"hcalrst",
+		2,
+		&doHostCalibRst,
+		"\thcalrst:    Remove the host calibration profile of a channel\n",
+		"\tUsage:      rtd <id> hcalrst <channel|all>\n",
+		"",
+		"\tExample:    rtd 0 hcalrst 2; Channel #2 on card #0 readings are no longer corrected by the host\n"};
+
+int doHostCalibExport(int argc, char *argv[]);
+const CliCmdType CMD_HCALIB_EXPORT =
+	{
+		"-hcalexport",
+		1,
+		&doHostCalibExport,
+		"\t-hcalexport: Write every host calibration profile as text, one line per channel, readable by -hcalimport\n",
+		"\tUsage:      rtd -hcalexport [file]\n",
+		"",
+		"\tExample:    rtd -hcalexport calib.txt\n"};
+
+int doHostCalibImport(int argc, char *argv[]);
+const CliCmdType CMD_HCALIB_IMPORT =
+	{
+		"-hcalimport",
+		1,
+		&doHostCalibImport,
+		"\t-hcalimport: Set the host calibration profiles listed in a file written by -hcalexport\n",
+		"\tUsage:      rtd -hcalimport <file>\n",
+		"",
+		"\tExample:    rtd -hcalimport calib.txt\n"};
+
 int doBoard(int argc, char *argv[]);
 const CliCmdType CMD_BOARD =
 {
@@ -205,10 +516,34 @@ const CliCmdType *gCmdArray[] =
 	&CMD_HELP,
 	&CMD_WAR,
 	&CMD_LIST,
+	&CMD_DISCOVER,
+	&CMD_LOCK_STAT,
+	&CMD_BATCH,
+	&CMD_DECODE,
+	&CMD_POLY5_BENCH,
+	&CMD_CVD_BENCH,
+	&CMD_FIX_BENCH,
+	&CMD_CURVE_LIST,
+	&CMD_HCALIB_EXPORT,
+	&CMD_HCALIB_IMPORT,
 	&CMD_VERSION,
 	&CMD_READ,
 	&CMD_READ_R,
+	&CMD_READ_FILT,
 	&CMD_READ_POLY5,
+	&CMD_READ_CVD,
+	&CMD_READ_FIX,
+	&CMD_READ_CURVE,
+	&CMD_FAULT,
+	&CMD_CURVE_READ,
+	&CMD_CURVE_WRITE,
+	&CMD_FILTER_READ,
+	&CMD_FILTER_WRITE,
+	&CMD_READ_ALL,
+	&CMD_READ_R_ALL,
+	&CMD_READ_POLY5_ALL,
+	&CMD_HISTORY,
+	&CMD_STREAM,
 	&CMD_BOARD,
 	&CMD_WDT_RELOAD,
 	&CMD_WDT_SET_PERIOD,
@@ -225,6 +560,9 @@ const CliCmdType *gCmdArray[] =
 	&CMD_WRITE_LED_TH,
 	&CMD_CALIB,
 	&CMD_CALIB_RST,
+	&CMD_HCALIB_WRITE,
+	&CMD_HCALIB_READ,
+	&CMD_HCALIB_RST,
 	&CMD_RS485_READ,
 	&CMD_RS485_WRITE,
 	&CMD_SNS_TYPE_READ,
@@ -233,106 +571,171 @@ const CliCmdType *gCmdArray[] =
 	&CMD_SWITCH_SAMPLES_WRITE,
 	NULL}; //null terminated array of cli structure pointers
 
-int doBoardInit(int stack)
+/*
+ * doFleetRead:
+ *	"rtd all <cmd> [format]", every channel of every card on every bus,
+ *	one block read per card and the buses read in parallel
+ */
+static int doFleetRead(int res, int argc, char *argv[])
 {
-	int dev = 0;
-	int add = 0;
-	uint8_t buff;
+	static RtdFleetType fleet[RTD_DISCOVER_MAX];
+	const char *fmt = "table";
+	uint64_t first = 0;
+	uint64_t last = 0;
+	int failed = 0;
+	int cnt = 0;
+	int i = 0;
+	int j = 0;
 
-	if ( (stack < 0) || (stack > 7))
+	if (argc > 4)
 	{
-		printf("Invalid stack level [0..7]!");
-		return ERROR;
+		return ARG_CNT_ERR;
 	}
-	add = stack + SLAVE_OWN_ADDRESS_BASE;
-	dev = i2cSetup(add);
-	if (dev == -1)
+	if (argc == 4)
 	{
-		return ERROR;
+		fmt = argv[3];
 	}
-	if (ERROR == i2cMem8Read(dev, REVISION_MAJOR_MEM_ADD, &buff, 1))
+	if ( (0 != strcasecmp(fmt, "table")) && (0 != strcasecmp(fmt, "csv"))
+		&& (0 != strcasecmp(fmt, "json")))
 	{
-		printf("MEGA-RTD id %d not detected\n", stack);
-		return ERROR;
+		printf("Invalid output format, use table, csv or json!\n");
+		return FAIL;
 	}
-
-	return dev;
-}
-
-int boardCheck(u8 add)
-{
-	int dev;
-	u8 buff;
-
-	dev = i2cSetup(add);
-	if (dev == -1)
+	cnt = rtdFleetRead(res, fleet, RTD_DISCOVER_MAX);
+	if (cnt <= 0)
 	{
-		return ERROR;
+		printf("No card detected!\n");
+		return FAIL;
 	}
-	return (i2cMem8Read(dev, REVISION_MAJOR_MEM_ADD, &buff, 1));
-}
 
-int rtdHwTypeGet(int dev, int* hw)
-{
-	u8 buff;
-	if (FAIL == i2cMem8Read(dev, RTD_CARD_TYPE, &buff, 1))
+	if (0 == strcasecmp(fmt, "csv"))
 	{
-		return ERROR;
+		printf("bus,id");
+		for (j = 0; j < RTD_CH_NR_MAX; j++)
+		{
+			printf(",ch%d", j + 1);
+		}
+		printf("\n");
 	}
-	*hw = buff;
-	return OK;
-}
-
-int rtdChGet(int dev, u8 channel, float *temperature)
-{
-	u8 buff[sizeof(float)];
-
-	if (NULL == temperature)
+	else if (0 == strcasecmp(fmt, "table"))
 	{
-		return ERROR;
+		printf("bus id");
+		for (j = 0; j < RTD_CH_NR_MAX; j++)
+		{
+			printf("        ch%d", j + 1);
+		}
+		printf("\n");
 	}
-
-	if ( (channel < CHANNEL_NR_MIN) || (channel > RTD_CH_NR_MAX))
+	else
 	{
-		printf("Invalid rtd channel nr!\n");
-		return ERROR;
+		printf("[");
 	}
-
-	if (FAIL
-		== i2cMem8Read(dev, RTD_VAL1_ADD + sizeof(float) * (channel - 1), buff,
-			sizeof(float)))
+	for (i = 0; i < cnt; i++)
 	{
-		return ERROR;
+		if (fleet[i].status != OK)
+		{
+			failed++;
+		}
+		else
+		{
+			first = (first == 0 || fleet[i].tsNs < first) ? fleet[i].tsNs : first;
+			last = fleet[i].tsNs > last ? fleet[i].tsNs : last;
+		}
+		if (0 == strcasecmp(fmt, "json"))
+		{
+			printf("%s\n {\"bus\": %d, \"id\": %d, \"%s\": ", i ? "," : "",
+				fleet[i].info.bus, fleet[i].info.stack, res ? "resistance" : "temperature");
+			for (j = 0; j < RTD_CH_NR_MAX; j++)
+			{
+				if (fleet[i].status != OK)
+				{
+					printf("null");
+					break;
+				}
+				printf("%s%06f%s", j ? "" : "[", fleet[i].val[j],
+					j < RTD_CH_NR_MAX - 1 ? ", " : "]");
+			}
+			printf("}");
+			continue;
+		}
+		printf(0 == strcasecmp(fmt, "csv") ? "%d,%d" : "%3d %2d", fleet[i].info.bus,
+			fleet[i].info.stack);
+		for (j = 0; j < RTD_CH_NR_MAX; j++)
+		{
+			if (fleet[i].status != OK)
+			{
+				printf(0 == strcasecmp(fmt, "csv") ? ",%s" : " %10s", "FAIL");
+			}
+			else
+			{
+				printf(0 == strcasecmp(fmt, "csv") ? ",%06f" : " %10.4f", fleet[i].val[j]);
+			}
+		}
+		printf("\n");
+	}
+	if (0 == strcasecmp(fmt, "json"))
+	{
+		printf("\n]\n");
+	}
+	else if (0 == strcasecmp(fmt, "table"))
+	{
+		printf("%d card(s) read within %0.3f ms\n", cnt - failed,
+			(double) (last - first) / 1e6);
 	}
+	return failed ? FAIL : OK;
+}
 
-	memcpy(temperature, buff, sizeof(float));
-	return OK;
+static RtdBinWriterType *gCapture = NULL; // rtd -batch -bin <file>
+
+static uint64_t monoNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
 }
 
-int rtdChGetR(int dev, u8 channel, float *resistance)
+/*
+ * captureValues:
+ *	Append the channels in mask read from the card on the current bus to
+ *	the batch capture, if any. val holds all the channels
+ */
+static void captureValues(int stack, int mask, int unit, const float *val)
 {
-	u8 buff[sizeof(float)];
+	RtdBinColType col[RTD_CH_NR_MAX];
+	float sel[RTD_CH_NR_MAX];
+	int cols = 0;
+	int i = 0;
 
-	if (NULL == resistance)
+	if (NULL == gCapture)
 	{
-		return ERROR;
+		return;
 	}
-
-	if ( (channel < CHANNEL_NR_MIN) || (channel > RTD_CH_NR_MAX))
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
 	{
-		printf("Invalid rtd channel nr!\n");
-		return ERROR;
+		if (mask & (1 << i))
+		{
+			col[cols].bus = i2cBusGet();
+			col[cols].stack = stack;
+			col[cols].channel = i + 1;
+			col[cols].unit = unit;
+			sel[cols++] = val[i];
+		}
 	}
-
-	if (FAIL
-		== i2cMem8Read(dev, RTD_RES1_ADD + sizeof(float) * (channel - 1), buff,
-			sizeof(float)))
+	if ( (OK != rtdBinColumns(gCapture, col, cols))
+		|| (OK != rtdBinWrite(gCapture, monoNs(), sel)))
 	{
-		return ERROR;
+		fprintf(stderr, "Fail to write the capture!\n");
 	}
+}
 
-	memcpy(resistance, buff, sizeof(float));
-	return OK;
+static void outValue(int stack, int ch, int unit, float val)
+{
+	float all[RTD_CH_NR_MAX];
+
+	printf("%06f\n", val);
+	all[ch - 1] = val;
+	captureValues(stack, 1 << (ch - 1), unit, all);
 }
 
 /*
@@ -345,11 +748,23 @@ int doRtdRead(int argc, char *argv[])
 	int ch = 0;
 	float val = 0;
 	int dev = 0;
+	float cache[RTD_CH_NR_MAX];
+
+	if ( (argc == 4)
+		&& (OK == rtddGet(i2cBusGet(), atoi(argv[1]), RTDD_QTY_TEMP, cache)))
+	{
+		ch = atoi(argv[3]);
+		if ( (ch >= CHANNEL_NR_MIN) && (ch <= RTD_CH_NR_MAX))
+		{
+			outValue(atoi(argv[1]), ch, RTD_BIN_UNIT_DEGC, cache[ch - 1]);
+			return OK;
+		}
+	}
 
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -358,20 +773,20 @@ int doRtdRead(int argc, char *argv[])
 		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 		{
 			printf("RTD channel number value out of range!\n");
-			exit(1);
+			return FAIL;
 		}
 
 		if (OK != rtdChGet(dev, ch, &val))
 		{
 			printf("Fail to read!\n");
-			exit(1);
+			return FAIL;
 		}
-		printf("%06f\n", val);
+		outValue(atoi(argv[1]), ch, RTD_BIN_UNIT_DEGC, val);
 	}
 	else
 	{
 		printf("Usage: %s read temperature value\n", argv[0]);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -381,11 +796,28 @@ int doRtdReadR(int argc, char *argv[])
 	int ch = 0;
 	float val = 0;
 	int dev = 0;
+	float cache[RTD_CH_NR_MAX];
+
+	if (0 == strcasecmp(argv[1], "all"))
+	{
+		return doFleetRead(1, argc, argv);
+	}
+
+	if ( (argc == 4)
+		&& (OK == rtddGet(i2cBusGet(), atoi(argv[1]), RTDD_QTY_RES, cache)))
+	{
+		ch = atoi(argv[3]);
+		if ( (ch >= CHANNEL_NR_MIN) && (ch <= RTD_CH_NR_MAX))
+		{
+			outValue(atoi(argv[1]), ch, RTD_BIN_UNIT_OHM, cache[ch - 1]);
+			return OK;
+		}
+	}
 
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -394,21 +826,50 @@ int doRtdReadR(int argc, char *argv[])
 		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 		{
 			printf("RTD channel number value out of range!\n");
-			exit(1);
+			return FAIL;
 		}
 
 		if (OK != rtdChGetR(dev, ch, &val))
 		{
 			printf("Fail to read!\n");
-			exit(1);
+			return FAIL;
 		}
-		printf("%06f\n", val);
+		outValue(atoi(argv[1]), ch, RTD_BIN_UNIT_OHM, val);
 	}
 	else
 	{
 		printf("Usage: %s read resistance value\n", argv[0]);
-		exit(1);
+		return FAIL;
+	}
+	return OK;
+}
+
+/*
+ * doRtdReadFilt:
+ *	Filtered temperature of one channel. The filters run in rtdd only, the
+ *	other read commands give the readings as they are
+ */
+int doRtdReadFilt(int argc, char *argv[])
+{
+	float cache[RTD_CH_NR_MAX];
+	int ch = 0;
+
+	if (argc != 4)
+	{
+		return ARG_CNT_ERR;
+	}
+	ch = atoi(argv[3]);
+	if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
+	{
+		printf("RTD channel number value out of range!\n");
+		return FAIL;
+	}
+	if (OK != rtddGet(i2cBusGet(), atoi(argv[1]), RTDD_QTY_TEMP_FILT, cache))
+	{
+		printf("No filtered value, rtdd is not running or does not poll this card!\n");
+		return FAIL;
 	}
+	outValue(atoi(argv[1]), ch, RTD_BIN_UNIT_DEGC, cache[ch - 1]);
 	return OK;
 }
 
@@ -429,21 +890,24 @@ int doRtdReadPoly5(int argc, char *argv[])
 {
 	int ch = 0;
 	float res = 0.0;
-	float temp_C = 0.0;
 	int dev = 0;
+	float cache[RTD_CH_NR_MAX];
 
-	/* coeffs for 5th order fit */
-	float c5 = -2.10678E-11;
-	float c4 = 2.27311E-08;
-	float c3 = -8.20888E-06;
-	float c2 = 2.38589E-03;
-	float c1 = 2.24745E+00;
-	float c0 = -2.42522E+02;
+	if ( (argc == 4)
+		&& (OK == rtddGet(i2cBusGet(), atoi(argv[1]), RTDD_QTY_RES, cache)))
+	{
+		ch = atoi(argv[3]);
+		if ( (ch >= CHANNEL_NR_MIN) && (ch <= RTD_CH_NR_MAX))
+		{
+			outValue(atoi(argv[1]), ch, RTD_BIN_UNIT_DEGC, rtdPoly5(cache[ch - 1]));
+			return OK;
+		}
+	}
 
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -452,67 +916,848 @@ int doRtdReadPoly5(int argc, char *argv[])
 		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 		{
 			printf("RTD channel number value out of range!\n");
-			exit(1);
+			return FAIL;
 		}
 
 		/* get the resistance */
 		if (OK != rtdChGetR(dev, ch, &res))
 		{
 			printf("Fail to read!\n");
-			exit(1);
+			return FAIL;
 		}
-
-		/* 
-		 * perform the resistance-to-temperature fit using 5th order polynomial
-		 *  
-		 * Rearrange a bit to make it friendlier (less expensive) to calculate
-		 *    temp_C = res ( res ( res ( res ( res * c5 + c4) + c3) + c2) + c1) + c0
-		 */
-		temp_C = res * c5 + c4;
-
-		temp_C *= res;
-		temp_C += c3;
-
-		temp_C *= res;
-		temp_C += c2;
-
-		temp_C *= res;
-		temp_C += c1;
-
-		temp_C *= res;
-		temp_C += c0;
-
-		printf("%06f\n", temp_C);
+		outValue(atoi(argv[1]), ch, RTD_BIN_UNIT_DEGC, rtdPoly5(res));
 	}
 	else
 	{
 		printf("Usage: %s read temperature value\n", argv[0]);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
 
-int doHelp(int argc, char *argv[])
+/*
+ * doRtdReadCvd:
+ *	Resistance to temperature with the Callendar-Van Dusen equation of the
+ *	sensor selected on the card, the type comes from the topology cache
+ */
+int doRtdReadCvd(int argc, char *argv[])
 {
-	int i = 0;
-	if (argc == 3)
+	const char *modes[] =
+	{
+		"exact",
+		"linear",
+		"cubic"
+	};
+	float cache[RTD_CH_NR_MAX];
+	float res = 0;
+	int interp = RTD_CVD_CUBIC;
+	int sensor = 0;
+	int stack = atoi(argv[1]);
+	int dev = 0;
+	int ch = 0;
+
+	if ( (argc != 4) && (argc != 5))
 	{
-		while (NULL != gCmdArray[i])
+		return ARG_CNT_ERR;
+	}
+	ch = atoi(argv[3]);
+	if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
+	{
+		printf("RTD channel number value out of range!\n");
+		return FAIL;
+	}
+	if (argc == 5)
+	{
+		for (interp = RTD_CVD_CUBIC; interp >= RTD_CVD_EXACT; interp--)
 		{
-			if (gCmdArray[i]->name != NULL)
+			if (0 == strcasecmp(argv[4], modes[interp]))
 			{
-				if (strcasecmp(argv[2], gCmdArray[i]->name) == 0)
-				{
-					printf("%s%s%s%s", gCmdArray[i]->help, gCmdArray[i]->usage1,
-						gCmdArray[i]->usage2, gCmdArray[i]->example);
-					break;
-				}
+				break;
 			}
-			i++;
 		}
-		if (NULL == gCmdArray[i])
+		if (interp < RTD_CVD_EXACT)
 		{
-			printf("Option \"%s\" not found\n", argv[2]);
+			printf("Invalid conversion, use cubic, linear or exact!\n");
+			return FAIL;
+		}
+	}
+	dev = doBoardInit(stack);
+	if (dev <= 0)
+	{
+		return FAIL;
+	}
+	if (OK != boardSensorTypeGet(stack, dev, &sensor))
+	{
+		printf("Fail to read the sensor type!\n");
+		return FAIL;
+	}
+	if (OK == rtddGet(i2cBusGet(), stack, RTDD_QTY_RES, cache))
+	{
+		res = cache[ch - 1];
+	}
+	else if (OK != rtdChGetR(dev, ch, &res))
+	{
+		printf("Fail to read!\n");
+		return FAIL;
+	}
+	outValue(stack, ch, RTD_BIN_UNIT_DEGC, rtdCvd(res, rtdCvdR0(sensor), interp));
+	return OK;
+}
+
+int doRtdReadFix(int argc, char *argv[])
+{
+	const char *units[] =
+	{
+		"centi",
+		"deci",
+		"mohm"
+	};
+	float cache[RTD_CH_NR_MAX];
+	float res = 0;
+	int32_t val = 0;
+	int unit = RTD_FIX_CENTI_DEGC;
+	int sensor = 0;
+	int stack = atoi(argv[1]);
+	int dev = 0;
+	int ch = 0;
+
+	if ( (argc != 4) && (argc != 5))
+	{
+		return ARG_CNT_ERR;
+	}
+	ch = atoi(argv[3]);
+	if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
+	{
+		printf("RTD channel number value out of range!\n");
+		return FAIL;
+	}
+	if (argc == 5)
+	{
+		for (unit = RTD_FIX_MILLIOHM; unit >= RTD_FIX_CENTI_DEGC; unit--)
+		{
+			if (0 == strcasecmp(argv[4], units[unit]))
+			{
+				break;
+			}
+		}
+		if (unit < RTD_FIX_CENTI_DEGC)
+		{
+			printf("Invalid unit, use centi, deci or mohm!\n");
+			return FAIL;
+		}
+	}
+	dev = doBoardInit(stack);
+	if (dev <= 0)
+	{
+		return FAIL;
+	}
+	if (OK != boardSensorTypeGet(stack, dev, &sensor))
+	{
+		printf("Fail to read the sensor type!\n");
+		return FAIL;
+	}
+	if (OK == rtddGet(i2cBusGet(), stack, RTDD_QTY_RES, cache))
+	{
+		res = cache[ch - 1];
+	}
+	else if (OK != rtdChGetR(dev, ch, &res))
+	{
+		printf("Fail to read!\n");
+		return FAIL;
+	}
+	val = rtdFixTemp(res, sensor, unit);
+	if (val == RTD_FIX_NAN)
+	{
+		printf("nan\n");
+	}
+	else
+	{
+		printf("%ld\n", (long)val);
+	}
+	return OK;
+}
+
+static void printAll(int stack, int unit, float *val)
+{
+	int i;
+
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		printf("%06f%s", val[i], (i < RTD_CH_NR_MAX - 1) ? " " : "\n");
+	}
+	captureValues(stack, 0xff, unit, val);
+}
+
+/*
+ * curveOfChannels:
+ *	Curve id of every channel, the automatic ones resolved with the sensor
+ *	type of the card
+ */
+static int curveOfChannels(int stack, int dev, int *id)
+{
+	int sensor = -1;
+	int ch = 0;
+
+	for (ch = 0; ch < RTD_CH_NR_MAX; ch++)
+	{
+		id[ch] = rtdCurveBindGet(i2cBusGet(), stack, ch + 1);
+		if (id[ch] == RTD_CURVE_AUTO)
+		{
+			if ( (sensor < 0) && (OK != boardSensorTypeGet(stack, dev, &sensor)))
+			{
+				printf("Fail to read the sensor type!\n");
+				return FAIL;
+			}
+			id[ch] = rtdCurveResolve(RTD_CURVE_AUTO, sensor);
+		}
+	}
+	return OK;
+}
+
+int doRtdReadCurve(int argc, char *argv[])
+{
+	float res[RTD_CH_NR_MAX];
+	int id[RTD_CH_NR_MAX];
+	int stack = atoi(argv[1]);
+	int dev = 0;
+	int ch = 0;
+
+	if ( (argc != 3) && (argc != 4))
+	{
+		return ARG_CNT_ERR;
+	}
+	if (argc == 4)
+	{
+		ch = atoi(argv[3]);
+		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
+		{
+			printf("RTD channel number value out of range!\n");
+			return FAIL;
+		}
+	}
+	dev = doBoardInit(stack);
+	if ( (dev <= 0) || (OK != curveOfChannels(stack, dev, id)))
+	{
+		return FAIL;
+	}
+	if ( (OK != rtddGet(i2cBusGet(), stack, RTDD_QTY_RES, res))
+		&& (OK != rtdChGetRAll(dev, res)))
+	{
+		printf("Fail to read!\n");
+		return FAIL;
+	}
+	if (ch != 0)
+	{
+		outValue(stack, ch, RTD_BIN_UNIT_DEGC,
+			rtdCurveTemp(rtdCurveGet(id[ch - 1]), res[ch - 1]));
+		return OK;
+	}
+	for (ch = 0; ch < RTD_CH_NR_MAX; ch++)
+	{
+		res[ch] = rtdCurveTemp(rtdCurveGet(id[ch]), res[ch]);
+	}
+	printAll(stack, RTD_BIN_UNIT_DEGC, res);
+	return OK;
+}
+
+/*
+ * doFault:
+ *	Fault status classified by rtdd, or from the resistance bounds of one
+ *	direct reading when the daemon does not poll the card
+ */
+int doFault(int argc, char *argv[])
+{
+	RtdFaultCfgType cfg;
+	float res[RTD_CH_NR_MAX];
+	int fault[RTD_CH_NR_MAX];
+	int stack = atoi(argv[1]);
+	int sensor = 0;
+	int dev = 0;
+	int ch = 0;
+	int i = 0;
+
+	if ( (argc != 3) && (argc != 4))
+	{
+		return ARG_CNT_ERR;
+	}
+	if (argc == 4)
+	{
+		ch = atoi(argv[3]);
+		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
+		{
+			printf("RTD channel number value out of range!\n");
+			return FAIL;
+		}
+	}
+	dev = doBoardInit(stack);
+	if (dev <= 0)
+	{
+		return FAIL;
+	}
+	if (OK != rtddGetFault(i2cBusGet(), stack, fault))
+	{
+		if ( (OK != boardSensorTypeGet(stack, dev, &sensor))
+			|| (OK != rtdChGetRAll(dev, res)))
+		{
+			printf("Fail to read!\n");
+			return FAIL;
+		}
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			fault[i] = (OK == rtdFaultCfg(i2cBusGet(), stack, i + 1, sensor, &cfg))
+				? rtdFaultBounds(&cfg, res[i]) : RTD_FAULT_OK;
+		}
+	}
+	if (ch != 0)
+	{
+		printf("%s\n", rtdFaultName(fault[ch - 1]));
+		return OK;
+	}
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		printf("%d %s\n", i + 1, rtdFaultName(fault[i]));
+	}
+	return OK;
+}
+
+int doCurveRead(int argc, char *argv[])
+{
+	int stack = atoi(argv[1]);
+	int bound = 0;
+	int id[RTD_CH_NR_MAX];
+	int dev = 0;
+	int ch = 0;
+
+	if (argc != 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	dev = doBoardInit(stack);
+	if ( (dev <= 0) || (OK != curveOfChannels(stack, dev, id)))
+	{
+		return FAIL;
+	}
+	for (ch = 0; ch < RTD_CH_NR_MAX; ch++)
+	{
+		bound = rtdCurveBindGet(i2cBusGet(), stack, ch + 1);
+		printf("%d %s%s\n", ch + 1, rtdCurveGet(id[ch])->name,
+			bound == RTD_CURVE_AUTO ? " (auto)" : "");
+	}
+	return OK;
+}
+
+int doCurveWrite(int argc, char *argv[])
+{
+	int stack = atoi(argv[1]);
+	int first = 0;
+	int last = 0;
+	int id = 0;
+	int dev = 0;
+
+	if (argc != 5)
+	{
+		return ARG_CNT_ERR;
+	}
+	if (0 == strcasecmp(argv[3], "all"))
+	{
+		first = CHANNEL_NR_MIN;
+		last = RTD_CH_NR_MAX;
+	}
+	else
+	{
+		first = last = atoi(argv[3]);
+		if ( (first < CHANNEL_NR_MIN) || (first > RTD_CH_NR_MAX))
+		{
+			printf("RTD channel number value out of range!\n");
+			return FAIL;
+		}
+	}
+	id = rtdCurveFind(argv[4]);
+	if (id == RTD_CURVE_NONE)
+	{
+		printf("Unknown curve \"%s\", see rtd -curves\n", argv[4]);
+		return FAIL;
+	}
+	dev = doBoardInit(stack);
+	if (dev <= 0)
+	{
+		return FAIL;
+	}
+	for (; first <= last; first++)
+	{
+		if (OK != rtdCurveBindSet(i2cBusGet(), stack, first, id))
+		{
+			printf("Fail to write the curve bindings!\n");
+			return FAIL;
+		}
+	}
+	printf("OK\n");
+	return OK;
+}
+
+int doFilterRead(int argc, char *argv[])
+{
+	RtdFilterCfgType cfg;
+	char spec[RTD_FILTER_SPEC_MAX];
+	int stack = atoi(argv[1]);
+	int ch = 0;
+
+	if (argc != 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	if (doBoardInit(stack) <= 0)
+	{
+		return FAIL;
+	}
+	for (ch = CHANNEL_NR_MIN; ch <= RTD_CH_NR_MAX; ch++)
+	{
+		rtdFilterCfgGet(i2cBusGet(), stack, ch, &cfg);
+		rtdFilterFormat(&cfg, spec, sizeof(spec));
+		printf("%d %s\n", ch, spec);
+	}
+	return OK;
+}
+
+int doFilterWrite(int argc, char *argv[])
+{
+	RtdFilterCfgType cfg;
+	int stack = atoi(argv[1]);
+	int first = 0;
+	int last = 0;
+
+	if (argc != 5)
+	{
+		return ARG_CNT_ERR;
+	}
+	if (0 == strcasecmp(argv[3], "all"))
+	{
+		first = CHANNEL_NR_MIN;
+		last = RTD_CH_NR_MAX;
+	}
+	else
+	{
+		first = last = atoi(argv[3]);
+		if ( (first < CHANNEL_NR_MIN) || (first > RTD_CH_NR_MAX))
+		{
+			printf("RTD channel number value out of range!\n");
+			return FAIL;
+		}
+	}
+	if (OK != rtdFilterParse(argv[4], &cfg))
+	{
+		printf("Invalid filter chain \"%s\"!\n", argv[4]);
+		return FAIL;
+	}
+	if (doBoardInit(stack) <= 0)
+	{
+		return FAIL;
+	}
+	for (; first <= last; first++)
+	{
+		if (OK != rtdFilterCfgSet(i2cBusGet(), stack, first, &cfg))
+		{
+			printf("Fail to write the filter chains!\n");
+			return FAIL;
+		}
+	}
+	printf("OK\n");
+	return OK;
+}
+
+int doCurveList(int argc, char *argv[])
+{
+	const RtdCurveType *c = NULL;
+	int i = 0;
+
+	UNUSED(argc);
+	UNUSED(argv);
+	printf("%-16s %10s %10s  %s\n", "curve", "min ohm", "max ohm", "description");
+	for (i = 0; i < rtdCurveCount(); i++)
+	{
+		c = rtdCurveGet(i);
+		printf("%-16s %10.3f %10.3f  %s\n", c->name, c->rMin,
+			c->rMin + (c->size - 1) / c->rScale, c->desc);
+	}
+	return OK;
+}
+
+int doRtdReadAll(int argc, char *argv[])
+{
+	float val[RTD_CH_NR_MAX];
+	int dev = 0;
+
+	if (0 == strcasecmp(argv[1], "all"))
+	{
+		return doFleetRead(0, argc, argv);
+	}
+	if ( (argc == 3)
+		&& (OK == rtddGet(i2cBusGet(), atoi(argv[1]), RTDD_QTY_TEMP, val)))
+	{
+		printAll(atoi(argv[1]), RTD_BIN_UNIT_DEGC, val);
+		return OK;
+	}
+
+	dev = doBoardInit(atoi(argv[1]));
+	if (dev <= 0)
+	{
+		return FAIL;
+	}
+
+	if (argc == 3)
+	{
+		if (OK != rtdChGetAll(dev, val))
+		{
+			printf("Fail to read!\n");
+			return FAIL;
+		}
+		printAll(atoi(argv[1]), RTD_BIN_UNIT_DEGC, val);
+	}
+	else
+	{
+		printf("%s", CMD_READ_ALL.usage1);
+		return FAIL;
+	}
+	return OK;
+}
+
+int doRtdReadRAll(int argc, char *argv[])
+{
+	float val[RTD_CH_NR_MAX];
+	int dev = 0;
+
+	if (0 == strcasecmp(argv[1], "all"))
+	{
+		return doFleetRead(1, argc, argv);
+	}
+	if ( (argc == 3)
+		&& (OK == rtddGet(i2cBusGet(), atoi(argv[1]), RTDD_QTY_RES, val)))
+	{
+		printAll(atoi(argv[1]), RTD_BIN_UNIT_OHM, val);
+		return OK;
+	}
+
+	dev = doBoardInit(atoi(argv[1]));
+	if (dev <= 0)
+	{
+		return FAIL;
+	}
+
+	if (argc == 3)
+	{
+		if (OK != rtdChGetRAll(dev, val))
+		{
+			printf("Fail to read!\n");
+			return FAIL;
+		}
+		printAll(atoi(argv[1]), RTD_BIN_UNIT_OHM, val);
+	}
+	else
+	{
+		printf("%s", CMD_READ_R_ALL.usage1);
+		return FAIL;
+	}
+	return OK;
+}
+
+int doRtdReadPoly5All(int argc, char *argv[])
+{
+	float val[RTD_CH_NR_MAX];
+	int dev = 0;
+
+	if ( (argc == 3)
+		&& (OK == rtddGet(i2cBusGet(), atoi(argv[1]), RTDD_QTY_RES, val)))
+	{
+		rtdPoly5Batch(NULL, val, val, RTD_CH_NR_MAX);
+		printAll(atoi(argv[1]), RTD_BIN_UNIT_DEGC, val);
+		return OK;
+	}
+
+	dev = doBoardInit(atoi(argv[1]));
+	if (dev <= 0)
+	{
+		return FAIL;
+	}
+
+	if (argc == 3)
+	{
+		if (OK != rtdChGetRAll(dev, val))
+		{
+			printf("Fail to read!\n");
+			return FAIL;
+		}
+		rtdPoly5Batch(NULL, val, val, RTD_CH_NR_MAX);
+		printAll(atoi(argv[1]), RTD_BIN_UNIT_DEGC, val);
+	}
+	else
+	{
+		printf("%s", CMD_READ_POLY5_ALL.usage1);
+		return FAIL;
+	}
+	return OK;
+}
+
+int doHistory(int argc, char *argv[])
+{
+	RtdHistRecType rec[256];
+	struct timespec ts;
+	uint64_t cursor = 0;
+	uint64_t lost = 0;
+	uint64_t from = 0;
+	uint64_t now = 0;
+	int stack = 0;
+	int ch = 0;
+	int cnt = 0;
+	int i = 0;
+
+	if (argc != 5)
+	{
+		printf("%s", CMD_HISTORY.usage1);
+		return FAIL;
+	}
+	stack = atoi(argv[1]);
+	ch = atoi(argv[3]);
+	if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
+	{
+		printf("RTD channel number value out of range!\n");
+		return FAIL;
+	}
+	if (OK != rtdHistOpen())
+	{
+		printf("No history, is rtdd running?\n");
+		return FAIL;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	now = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+	from = now - (uint64_t) (atof(argv[4]) * 1e9);
+	cursor = rtdHistHead();
+	cursor = (cursor > rtdHistCapacity()) ? cursor - rtdHistCapacity() : 0;
+	while ( (cnt = rtdHistRead(&cursor, rec, 256, &lost)) > 0)
+	{
+		for (i = 0; i < cnt; i++)
+		{
+			if ( (rec[i].bus == i2cBusGet()) && (rec[i].stack == stack)
+				&& (rec[i].channel == ch) && (rec[i].tsNs >= from))
+			{
+				printf("%0.3f %06f %06f\n", ((double)rec[i].tsNs - now) / 1e9,
+					rec[i].temp, rec[i].res);
+			}
+		}
+	}
+	return OK;
+}
+
+/*
+ * parseChannels:
+ *	Channel list like "1,3-5" to a bit mask, 0 on error
+ */
+static int parseChannels(const char *str)
+{
+	char *end = NULL;
+	int mask = 0;
+	int first = 0;
+	int last = 0;
+
+	while (*str)
+	{
+		first = strtol(str, &end, 10);
+		last = first;
+		if (*end == '-')
+		{
+			last = strtol(end + 1, &end, 10);
+		}
+		if ( (end == str) || (first < CHANNEL_NR_MIN) || (last > RTD_CH_NR_MAX)
+			|| (first > last) || ( (*end != ',') && (*end != 0)))
+		{
+			return 0;
+		}
+		for (; first <= last; first++)
+		{
+			mask |= 1 << (first - 1);
+		}
+		str = (*end == ',') ? end + 1 : end;
+	}
+	return mask;
+}
+
+static volatile sig_atomic_t gStreamStop = 0;
+
+static void streamStop(int sig)
+{
+	(void)sig;
+	gStreamStop = 1;
+}
+
+/*
+ * doStream:
+ *	Read the card on an absolute deadline schedule, the cadence does not
+ *	drift with the transfer time and the missed deadlines are counted
+ */
+int doStream(int argc, char *argv[])
+{
+	PeriodicType sched;
+	RtdBinWriterType bin;
+	RtdBinColType col[RTD_CH_NR_MAX];
+	RtdFilterType filt[RTD_CH_NR_MAX];
+	RtdFilterCfgType cfg;
+	struct sigaction sa;
+	struct sigaction oldInt;
+	struct sigaction oldTerm;
+	struct sigaction oldPipe;
+	struct timespec mono;
+	struct timespec real;
+	struct timespec start;
+	float val[RTD_CH_NR_MAX];
+	float sel[RTD_CH_NR_MAX];
+	double rate = 0;
+	double elapsed = 0;
+	long long samples = 0;
+	long long overruns = 0;
+	long long errors = 0;
+	int mask = 0xff;
+	int binary = 0;
+	int missed = 0;
+	int cols = 0;
+	int dev = 0;
+	int i = 0;
+
+	if ( (argc > 4) && (0 == strcasecmp(argv[argc - 1], "-bin")))
+	{
+		binary = 1;
+		argc--;
+	}
+	if ( (argc != 4) && (argc != 5))
+	{
+		printf("%s", CMD_STREAM.usage1);
+		return FAIL;
+	}
+	rate = atof(argv[3]);
+	if ( (rate <= 0) || (rate > 10000))
+	{
+		printf("Invalid sample rate (0..10000]!\n");
+		return FAIL;
+	}
+	if ( (argc == 5) && (0 == (mask = parseChannels(argv[4]))))
+	{
+		printf("Invalid channel list, use something like 1,3-5!\n");
+		return FAIL;
+	}
+	dev = doBoardInit(atoi(argv[1]));
+	if (dev <= 0)
+	{
+		return FAIL;
+	}
+
+	if (binary)
+	{
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			if (mask & (1 << i))
+			{
+				col[cols].bus = i2cBusGet();
+				col[cols].stack = atoi(argv[1]);
+				col[cols].channel = i + 1;
+				col[cols++].unit = RTD_BIN_UNIT_DEGC;
+			}
+		}
+		rtdBinWriterInit(&bin, stdout);
+		rtdBinColumns(&bin, col, cols);
+	}
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		rtdFilterCfgGet(i2cBusGet(), atoi(argv[1]), i + 1, &cfg);
+		rtdFilterInit(&filt[i], &cfg);
+	}
+
+	// the batch mode goes on after a stream, restore its handlers on return
+	gStreamStop = 0;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = streamStop;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, &oldInt);
+	sigaction(SIGTERM, &sa, &oldTerm);
+	sigaction(SIGPIPE, &sa, &oldPipe);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	periodicStart(&sched, (long long) (1e9 / rate));
+	while (!gStreamStop)
+	{
+		// one block read for all the channels is cheaper than one per channel
+		if (OK != rtdChGetAll(dev, val))
+		{
+			errors++;
+		}
+		else if (binary)
+		{
+			for (i = 0, cols = 0; i < RTD_CH_NR_MAX; i++)
+			{
+				if (mask & (1 << i))
+				{
+					sel[cols++] = rtdFilterRun(&filt[i], val[i]);
+				}
+			}
+			if (OK != rtdBinWrite(&bin, monoNs(), sel))
+			{
+				break; // reader gone
+			}
+			fflush(stdout);
+			samples++;
+		}
+		else
+		{
+			clock_gettime(CLOCK_MONOTONIC, &mono);
+			clock_gettime(CLOCK_REALTIME, &real);
+			printf("%ld.%06ld %ld.%06ld", (long)mono.tv_sec, mono.tv_nsec / 1000,
+				(long)real.tv_sec, real.tv_nsec / 1000);
+			for (i = 0; i < RTD_CH_NR_MAX; i++)
+			{
+				if (mask & (1 << i))
+				{
+					printf(" %06f", rtdFilterRun(&filt[i], val[i]));
+				}
+			}
+			printf("\n");
+			fflush(stdout);
+			samples++;
+		}
+		missed = periodicWait(&sched);
+		if (missed > 0)
+		{
+			overruns += missed;
+			fprintf(stderr, "overrun: %d deadline(s) missed, next one at %ld.%06ld\n", missed,
+				(long)sched.next.tv_sec, sched.next.tv_nsec / 1000);
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &mono);
+	elapsed = (mono.tv_sec - start.tv_sec) + (mono.tv_nsec - start.tv_nsec) / 1e9;
+	fprintf(stderr, "%lld samples in %0.3f s (%0.2f Hz), %lld overruns, %lld read errors\n",
+		samples, elapsed, elapsed > 0 ? samples / elapsed : 0, overruns, errors);
+	sigaction(SIGINT, &oldInt, NULL);
+	sigaction(SIGTERM, &oldTerm, NULL);
+	sigaction(SIGPIPE, &oldPipe, NULL);
+	return OK;
+}
+
+int doHelp(int argc, char *argv[])
+{
+	int i = 0;
+	if (argc == 3)
+	{
+		while (NULL != gCmdArray[i])
+		{
+			if (gCmdArray[i]->name != NULL)
+			{
+				if (strcasecmp(argv[2], gCmdArray[i]->name) == 0)
+				{
+					printf("%s%s%s%s", gCmdArray[i]->help, gCmdArray[i]->usage1,
+						gCmdArray[i]->usage2, gCmdArray[i]->example);
+					break;
+				}
+			}
+			i++;
+		}
+		if (NULL == gCmdArray[i])
+		{
+			printf("Option \"%s\" not found\n", argv[2]);
 			i = 0;
 			while (NULL != gCmdArray[i])
 			{
@@ -592,7 +1837,7 @@ int doRtdCalib(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 5)
@@ -601,21 +1846,21 @@ int doRtdCalib(int argc, char *argv[])
 		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 		{
 			printf("RTD channel number value out of range!\n");
-			exit(1);
+			return FAIL;
 		}
 		val = atof(argv[4]);
 
 		if (OK != rtdSetCalib(dev, ch, val))
 		{
 			printf("Fail to calibrate!\n");
-			exit(1);
+			return FAIL;
 		}
 		printf("OK\n");
 	}
 	else
 	{
 		printf("%s", CMD_CALIB.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -629,7 +1874,7 @@ int doRtdCalibRst(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -638,21 +1883,289 @@ int doRtdCalibRst(int argc, char *argv[])
 		if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
 		{
 			printf("RTD channel number value out of range!\n");
-			exit(1);
+			return FAIL;
 		}
 
 		if (OK != rtdResetCalib(dev, ch))
 		{
 			printf("Fail to calibrate!\n");
-			exit(1);
+			return FAIL;
 		}
 		printf("OK\n");
 	}
 	else
 	{
 		printf("%s", CMD_CALIB_RST.usage1);
+		return FAIL;
+	}
+	return OK;
+}
+
+/*
+ * userFopen:
+ *	fopen() a path given on the command line with the rights of the user
+ *	running rtd, not the setuid root ones
+ */
+static FILE* userFopen(const char *path, const char *mode)
+{
+	uid_t euid = geteuid();
+	gid_t egid = getegid();
+	FILE *f = NULL;
+
+	if (0 != setegid(getgid()))
+	{
+		return NULL;
+	}
+	if (0 == seteuid(getuid()))
+	{
+		f = fopen(path, mode);
+		if (0 != seteuid(euid))
+		{
+			exit(1); // can not get the rights back, stop here
+		}
+	}
+	if (0 != setegid(egid))
+	{
 		exit(1);
 	}
+	return f;
+}
+
+//********************** Host calibration *************************
+static void hostCalibPrint(FILE *out, int bus, int stack, int ch, const RtdCalibType *c)
+{
+	fprintf(out, "%d %d %d %.9g %.9g %.9g %.9g %.*s\n", bus, stack, ch, c->lead, c->offset,
+		c->gain, c->quad, c->probe[0] ? RTD_CALIB_PROBE_MAX : 1,
+		c->probe[0] ? c->probe : "-");
+}
+
+static int hostCalibStack(const char *arg)
+{
+	int stack = atoi(arg);
+
+	if ( (stack < 0) || (stack > 7))
+	{
+		printf("Invalid stack level [0..7]!\n");
+		return ERROR;
+	}
+	return stack;
+}
+
+int doHostCalibWrite(int argc, char *argv[])
+{
+	RtdCalibType c;
+	int stack = 0;
+	int ch = 0;
+
+	if ( (argc < 7) || (argc > 9))
+	{
+		return ARG_CNT_ERR;
+	}
+	stack = hostCalibStack(argv[1]);
+	if (stack < 0)
+	{
+		return FAIL;
+	}
+	ch = atoi(argv[3]);
+	if ( (ch < CHANNEL_NR_MIN) || (ch > RTD_CH_NR_MAX))
+	{
+		printf("RTD channel number value out of range!\n");
+		return FAIL;
+	}
+	memset(&c, 0, sizeof(c));
+	c.lead = atof(argv[4]);
+	c.offset = atof(argv[5]);
+	c.gain = atof(argv[6]);
+	c.quad = (argc > 7) ? atof(argv[7]) : 0;
+	if (argc > 8)
+	{
+		strncpy(c.probe, argv[8], RTD_CALIB_PROBE_MAX);
+	}
+	if (OK != rtdCalibSet(i2cBusGet(), stack, ch, &c))
+	{
+		printf("Fail to write the calibration profile!\n");
+		return FAIL;
+	}
+	printf("OK\n");
+	return OK;
+}
+
+int doHostCalibRead(int argc, char *argv[])
+{
+	RtdCalibType c;
+	int stack = 0;
+	int first = CHANNEL_NR_MIN;
+	int last = RTD_CH_NR_MAX;
+
+	if ( (argc != 3) && (argc != 4))
+	{
+		return ARG_CNT_ERR;
+	}
+	stack = hostCalibStack(argv[1]);
+	if (stack < 0)
+	{
+		return FAIL;
+	}
+	if (argc == 4)
+	{
+		first = last = atoi(argv[3]);
+		if ( (first < CHANNEL_NR_MIN) || (first > RTD_CH_NR_MAX))
+		{
+			printf("RTD channel number value out of range!\n");
+			return FAIL;
+		}
+	}
+	printf("bus stack ch lead offset gain quad probe\n");
+	for (; first <= last; first++)
+	{
+		if (OK == rtdCalibGet(i2cBusGet(), stack, first, &c))
+		{
+			hostCalibPrint(stdout, i2cBusGet(), stack, first, &c);
+		}
+		else
+		{
+			printf("%d %d %d none\n", i2cBusGet(), stack, first);
+		}
+	}
+	return OK;
+}
+
+int doHostCalibRst(int argc, char *argv[])
+{
+	int stack = 0;
+	int first = 0;
+	int last = 0;
+
+	if (argc != 4)
+	{
+		return ARG_CNT_ERR;
+	}
+	stack = hostCalibStack(argv[1]);
+	if (stack < 0)
+	{
+		return FAIL;
+	}
+	if (0 == strcasecmp(argv[3], "all"))
+	{
+		first = CHANNEL_NR_MIN;
+		last = RTD_CH_NR_MAX;
+	}
+	else
+	{
+		first = last = atoi(argv[3]);
+		if ( (first < CHANNEL_NR_MIN) || (first > RTD_CH_NR_MAX))
+		{
+			printf("RTD channel number value out of range!\n");
+			return FAIL;
+		}
+	}
+	for (; first <= last; first++)
+	{
+		if (OK != rtdCalibClear(i2cBusGet(), stack, first))
+		{
+			printf("Fail to write the calibration profile!\n");
+			return FAIL;
+		}
+	}
+	printf("OK\n");
+	return OK;
+}
+
+int doHostCalibExport(int argc, char *argv[])
+{
+	RtdCalibType c;
+	FILE *out = stdout;
+	int bus = 0;
+	int stack = 0;
+	int ch = 0;
+
+	if (argc > 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	if (argc == 3)
+	{
+		out = userFopen(argv[2], "w");
+		if (NULL == out)
+		{
+			printf("Fail to open %s!\n", argv[2]);
+			return FAIL;
+		}
+	}
+	fprintf(out, "# bus stack ch lead offset gain quad probe\n");
+	for (bus = 0; bus < I2C_BUS_MAX; bus++)
+	{
+		for (stack = 0; stack < 8; stack++)
+		{
+			for (ch = CHANNEL_NR_MIN; ch <= RTD_CH_NR_MAX; ch++)
+			{
+				if (OK == rtdCalibGet(bus, stack, ch, &c))
+				{
+					hostCalibPrint(out, bus, stack, ch, &c);
+				}
+			}
+		}
+	}
+	if ( (out != stdout) && (0 != fclose(out)))
+	{
+		printf("Fail to write %s!\n", argv[2]);
+		return FAIL;
+	}
+	return OK;
+}
+
+int doHostCalibImport(int argc, char *argv[])
+{
+	char line[256];
+	char probe[64];
+	RtdCalibType c;
+	FILE *in = NULL;
+	int lineNr = 0;
+	int bus = 0;
+	int stack = 0;
+	int ch = 0;
+	int n = 0;
+
+	if (argc != 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	in = userFopen(argv[2], "r");
+	if (NULL == in)
+	{
+		printf("Fail to open %s!\n", argv[2]);
+		return FAIL;
+	}
+	while (NULL != fgets(line, sizeof(line), in))
+	{
+		lineNr++;
+		if ( (line[0] == '#') || (line[strspn(line, " \t\r\n")] == 0))
+		{
+			continue;
+		}
+		memset(&c, 0, sizeof(c));
+		if (8 != sscanf(line, "%d %d %d %f %f %f %f %63s", &bus, &stack, &ch,
+			&c.lead, &c.offset, &c.gain, &c.quad, probe))
+		{
+			printf("%s:%d: expected <bus> <stack> <ch> <lead> <offset> <gain> <quad> <probe>\n",
+				argv[2], lineNr);
+			fclose(in);
+			return FAIL;
+		}
+		if (0 != strcmp(probe, "-"))
+		{
+			strncpy(c.probe, probe, RTD_CALIB_PROBE_MAX);
+		}
+		if (OK != rtdCalibSet(bus, stack, ch, &c))
+		{
+			printf("%s:%d: fail to write the calibration profile!\n", argv[2], lineNr);
+			fclose(in);
+			return FAIL;
+		}
+		n++;
+	}
+	fclose(in);
+	printf("%d profiles\n", n);
 	return OK;
 }
 
@@ -698,6 +2211,53 @@ int doList(int argc, char *argv[])
 	return OK;
 }
 
+int doDiscover(int argc, char *argv[])
+{
+	RtdBoardInfoType info[RTD_DISCOVER_MAX];
+	int cnt = 0;
+	int i = 0;
+
+	UNUSED(argc);
+	UNUSED(argv);
+
+	cnt = rtdDiscover(info, RTD_DISCOVER_MAX);
+	if (cnt < 0)
+	{
+		return FAIL;
+	}
+	printf("%d board(s) detected\n", cnt);
+	for (i = 0; i < cnt; i++)
+	{
+		printf("Bus %d Id %d: card type %d, hardware %d.%02d, firmware %d.%02d\n",
+			info[i].bus, info[i].stack, info[i].hwType, info[i].hwMajor,
+			info[i].hwMinor, info[i].fwMajor, info[i].fwMinor);
+	}
+	return OK;
+}
+
+int doLockStat(int argc, char *argv[])
+{
+	BusLockStatsType stats;
+
+	UNUSED(argc);
+	UNUSED(argv);
+
+	if (0 != busLockStatsGet(i2cBusGet(), &stats))
+	{
+		printf("Fail to open the bus arbitration data!\n");
+		return FAIL;
+	}
+	printf("Grants %llu, skipped holders %llu\n", (unsigned long long)stats.grants,
+		(unsigned long long)stats.forced);
+	printf("Wait average %0.3fms, max %0.3fms\n",
+		stats.grants ? stats.waitNsTotal / 1e6 / stats.grants : 0,
+		stats.waitNsMax / 1e6);
+	printf("Hold average %0.3fms, max %0.3fms\n",
+		stats.grants ? stats.holdNsTotal / 1e6 / stats.grants : 0,
+		stats.holdNsMax / 1e6);
+	return OK;
+}
+
 //#define DEBUG_ADS
 /* 
  * Self test for production
@@ -728,7 +2288,7 @@ int doBoard(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 3)
@@ -736,19 +2296,19 @@ int doBoard(int argc, char *argv[])
 #ifdef DEBUG_ADS
 		if (FAIL == i2cMem8Read(dev, RTD_SPS1_ADD, buff, 5))
 		{
-			exit(1);
+			return FAIL;
 		}
 		memcpy(sps, buff, 4);
 		cardType = buff[4];
 		if (FAIL == i2cMem8Read(dev, RTD_REINIT_COUNT, buff, 4))
 		{
-			exit(1);
+			return FAIL;
 		}
 		memcpy(&reinit, buff, 4);
 #endif		
 		if (FAIL == i2cMem8Read(dev, DIAG_TEMPERATURE_MEM_ADD, buff, 3))
 		{
-			exit(1);
+			return FAIL;
 		}
 		memcpy(&saux8, buff, 1);
 		memcpy(&aux16, &buff[1], 2);
@@ -756,14 +2316,14 @@ int doBoard(int argc, char *argv[])
 
 		if (FAIL == i2cMem8Read(dev, RTD_RASP_VOLT, buff, 2))
 		{
-			exit(1);
+			return FAIL;
 		}
 		memcpy(&aux16, buff, 2);
 		vRasp = (float)aux16 / 1000;
 
 		if (FAIL == i2cMem8Read(dev, REVISION_MAJOR_MEM_ADD, buff, 2))
 		{
-			exit(1);
+			return FAIL;
 		}
 		printf("Mega RTD firmware version %d.%02d\n", (int)buff[0], (int)buff[1]);
 #ifdef DEBUG_ADS
@@ -796,26 +2356,8 @@ int doBoard(int argc, char *argv[])
 }
 
 int doWarranty(int argc UNU, char *argv[] UNU)
-{
-	printf("%s\n", warranty);
-	return OK;
-}
-
-int sensorRead(int dev, int* val)
-{
-	u8 buff;
-
-	if (NULL == val)
-	{
-		return ERROR;
-	}
-
-	if (FAIL == i2cMem8Read(dev, I2C_MEM_PT1000, &buff, 1))
-	{
-		return ERROR;
-	}
-
-	*val = 0x0f & buff;
+{
+	printf("%s\n", warranty);
 	return OK;
 }
 
@@ -847,32 +2389,32 @@ int doSnsTypeRead(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
-	if (OK != rtdHwTypeGet(dev, &card))
+	if (OK != boardHwTypeGet(atoi(argv[1]), dev, &card))
 	{
 		printf("Fail to read card type!\n");
-		exit(1);
+		return FAIL;
 	}
 	if (card < 1)
 	{
 		printf("Available only for hardware version >= 5.0!\n");
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 3)
 	{
-		if (OK != sensorRead(dev, &val))
+		if (OK != boardSensorTypeGet(atoi(argv[1]), dev, &val))
 		{
 			printf("Fail to read!\n");
-			exit(1);
+			return FAIL;
 		}
 		printf("%d\n", val);
 	}
 	else
 	{
 		printf("%s", CMD_SNS_TYPE_READ.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -886,17 +2428,17 @@ int doSnsTypeWrite(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
-	if (OK != rtdHwTypeGet(dev, &card))
+	if (OK != boardHwTypeGet(atoi(argv[1]), dev, &card))
 	{
 		printf("Fail to read card type!\n");
-		exit(1);
+		return FAIL;
 	}
 	if (card < 1)
 	{
 		printf("Available only for hardware version >= 5.0!\n");
-		exit(1);
+		return FAIL;
 	}
 	if (argc == 4)
 	{
@@ -906,14 +2448,15 @@ int doSnsTypeWrite(int argc, char *argv[])
 		if (OK != sensorWrite(dev, val))
 		{
 			printf("Fail to write!\n");
-			exit(1);
+			return FAIL;
 		}
+		boardSensorTypeSet(i2cBusGet(), atoi(argv[1]), val);
 		printf("OK\n");
 	}
 	else
 	{
 		printf("%s", CMD_SNS_TYPE_WRITE.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -969,7 +2512,7 @@ int doSwitchSamplesRead(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 	
 	if (argc == 3)
@@ -977,14 +2520,14 @@ int doSwitchSamplesRead(int argc, char *argv[])
 		if (OK != samplesRead(dev, &val))
 		{
 			printf("Fail to read!\n");
-			exit(1);
+			return FAIL;
 		}
 		printf("%d\n", val);
 	}
 	else
 	{
 		printf("%s", CMD_SWITCH_SAMPLES_READ.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -997,7 +2540,7 @@ int doSwitchSamplesWrite(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -1007,14 +2550,14 @@ int doSwitchSamplesWrite(int argc, char *argv[])
 		if (OK != samplesWrite(dev, val))
 		{
 			printf("Fail to write!\n");
-			exit(1);
+			return FAIL;
 		}
 		printf("OK\n");
 	}
 	else
 	{
 		printf("%s", CMD_SWITCH_SAMPLES_WRITE.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -1037,20 +2580,21 @@ void usage(void)
 		}
 		i++;
 	}
+	printf("\tUsage:      rtd -bus <n> <command>; Use /dev/i2c-<n> instead of /dev/i2c-%d\n",
+		I2C_BUS_DEFAULT);
 	printf("Where: <id> = Board level id = 0..7\n");
 	printf("Type rtd -h <command> for more help\n");
 }
 
-int main(int argc, char *argv[])
+/*
+ * rtdDispatch:
+ *	Run the command line in argv, the global options already removed
+ */
+static int rtdDispatch(int argc, char *argv[])
 {
 	int i = 0;
 	int ret = OK;
 
-	if (argc == 1)
-	{
-		usage();
-		return -1;
-	}
 	while (NULL != gCmdArray[i])
 	{
 		if ( (gCmdArray[i]->name != NULL) && (gCmdArray[i]->namePos < argc))
@@ -1075,5 +2619,666 @@ int main(int argc, char *argv[])
 	printf("Invalid command option\n");
 	usage();
 
-	return -1;
+	return ERROR;
+}
+
+#define BATCH_LINE_MAX	1024
+#define BATCH_ARGS_MAX	32
+
+/*
+ * doBatch:
+ *	Run one command per line in this process. The i2c handles and the
+ *	board probes are reused between the lines and a failure only sets the
+ *	status of its line
+ */
+int doBatch(int argc, char *argv[])
+{
+	char line[BATCH_LINE_MAX];
+	char *args[BATCH_ARGS_MAX + 1];
+	char *tok = NULL;
+	char *save = NULL;
+	FILE *in = stdin;
+	static RtdBinWriterType bin;
+	const char *capPath = NULL;
+	FILE *capture = NULL;
+	int bus = i2cBusGet();
+	size_t len = 0;
+	int lineNr = 0;
+	int failed = 0;
+	int cnt = 0;
+	int ret = OK;
+	int c = 0;
+	int n = 0;
+
+	if ( (argc > 3) && (0 == strcasecmp(argv[2], "-bin")))
+	{
+		capPath = argv[3];
+		argv[3] = argv[1];
+		argv[2] = argv[0];
+		argv += 2;
+		argc -= 2;
+	}
+	if (argc > 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	if ( (argc == 3) && (0 != strcmp(argv[2], "-")))
+	{
+		in = userFopen(argv[2], "r");
+		if (NULL == in)
+		{
+			printf("Fail to open %s!\n", argv[2]);
+			return FAIL;
+		}
+	}
+	if (NULL != capPath)
+	{
+		capture = userFopen(capPath, "wb");
+		if (NULL == capture)
+		{
+			printf("Fail to open %s!\n", capPath);
+			if (in != stdin)
+			{
+				fclose(in);
+			}
+			return FAIL;
+		}
+		rtdBinWriterInit(&bin, capture);
+		gCapture = &bin;
+	}
+	boardProbeCache(1);
+	while (NULL != fgets(line, sizeof(line), in))
+	{
+		lineNr++;
+		len = strlen(line);
+		if ( (len == sizeof(line) - 1) && (line[len - 1] != '\n') && (EOF != (c = fgetc(in)))
+			&& (c != '\n'))
+		{
+			// the rest is not a command of its own, drop it with its line
+			while ( (c != EOF) && (c != '\n'))
+			{
+				c = fgetc(in);
+			}
+			printf("Line longer than %d characters\n", BATCH_LINE_MAX - 2);
+			cnt++;
+			failed++;
+			printf("# %d FAIL\n", lineNr);
+			fflush(stdout);
+			continue;
+		}
+		n = 0;
+		args[n++] = argv[0];
+		for (tok = strtok_r(line, " \t\r\n", &save); (NULL != tok) && (n < BATCH_ARGS_MAX);
+			tok = strtok_r(NULL, " \t\r\n", &save))
+		{
+			args[n++] = tok;
+		}
+		args[n] = NULL;
+		if ( (n == 1) || (args[1][0] == '#'))
+		{
+			continue; // empty line or comment
+		}
+		i2cBusSet(bus);
+		if ( (n > 3) && (strcasecmp(args[1], "-bus") == 0))
+		{
+			i2cBusSet(atoi(args[2]));
+			args[2] = args[0];
+			ret = rtdDispatch(n - 2, args + 2);
+		}
+		else if (strcasecmp(args[1], CMD_BATCH.name) == 0)
+		{
+			printf("Nested %s not allowed\n", CMD_BATCH.name);
+			ret = ERROR;
+		}
+		else
+		{
+			ret = rtdDispatch(n, args);
+		}
+		cnt++;
+		if (ret != OK)
+		{
+			failed++;
+		}
+		printf("# %d %s\n", lineNr, ret == OK ? "OK" : "FAIL");
+		fflush(stdout); // lets a script drive rtd as a co-process
+	}
+	i2cBusSet(bus);
+	if (in != stdin)
+	{
+		fclose(in);
+	}
+	if (NULL != capture)
+	{
+		gCapture = NULL;
+		if (0 != fclose(capture))
+		{
+			printf("Fail to write the capture!\n");
+			failed++;
+		}
+	}
+	fprintf(stderr, "%d command(s), %d failed\n", cnt, failed);
+	return failed ? FAIL : OK;
+}
+
+#define POLY5_BENCH_DEFAULT	1000000
+#define POLY5_BENCH_RUNS	5
+#define BENCH_ULPS_MAX	4 // float rounding a kernel may add, see benchUlps
+#define CVD_LINEAR_ERR_MAX	2e-4 // degC, interpolation error, see rtdconv.h
+
+/*
+ * benchUlps:
+ *	Error in float ULPs of the magnitude the kernel works at: rounding a
+ *	result near 0 degC still costs the ULPs of its larger terms
+ */
+static double benchUlps(double err, double scale)
+{
+	return fabs(err) / (FLT_EPSILON * scale);
+}
+
+/*
+ * poly5Scale:
+ *	Sum of the absolute Horner terms, the bound of its rounding error
+ */
+static double poly5Scale(const RtdPoly5Type *p, double res)
+{
+	double scale = 0;
+	int i = 0;
+
+	for (i = 5; i >= 0; i--)
+	{
+		scale = scale * fabs(res) + fabs(p->c[i]);
+	}
+	return scale;
+}
+
+/*
+ * doPoly5Bench:
+ *	Best of POLY5_BENCH_RUNS conversions of a PT100 resistance sweep with
+ *	every kernel, with the largest difference to the scalar result and
+ *	to the polynomial evaluated in double precision. FAIL if a kernel is
+ *	more than BENCH_ULPS_MAX away from either
+ */
+int doPoly5Bench(int argc, char *argv[])
+{
+	RtdPoly5ImplType impl[8];
+	const RtdPoly5Type *p = &RTD_POLY5_PT100;
+	struct timespec t0;
+	struct timespec t1;
+	float *res = NULL;
+	float *ref = NULL;
+	float *out = NULL;
+	double best = 0;
+	double scalar = 0;
+	double ns = 0;
+	double diff = 0;
+	double err = 0;
+	double exact = 0;
+	double ulps = 0;
+	long n = POLY5_BENCH_DEFAULT;
+	long i = 0;
+	int ret = OK;
+	int cnt = 0;
+	int k = 0;
+	int run = 0;
+
+	if (argc > 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	if (argc == 3)
+	{
+		n = atol(argv[2]);
+	}
+	if (n <= 0)
+	{
+		printf("Invalid number of samples!\n");
+		return FAIL;
+	}
+	res = malloc(n * sizeof(float));
+	ref = malloc(n * sizeof(float));
+	out = malloc(n * sizeof(float));
+	if ( (NULL == res) || (NULL == ref) || (NULL == out))
+	{
+		printf("Out of memory!\n");
+		free(res);
+		free(ref);
+		free(out);
+		return FAIL;
+	}
+	for (i = 0; i < n; i++)
+	{
+		res[i] = 18.0 + 372.0 * i / n; // PT100 from -200 to 660 degC
+	}
+	cnt = rtdPoly5Impls(impl, sizeof(impl) / sizeof(impl[0]));
+	impl[0].fn(p, res, ref, n);
+	printf("%-8s %10s %10s %12s %12s %8s\n", "kernel", "ns/sample", "speedup", "max |d| ref",
+		"max |d| exact", "ulps");
+	for (k = 0; k < cnt; k++)
+	{
+		for (run = 0; run < POLY5_BENCH_RUNS; run++)
+		{
+			clock_gettime(CLOCK_MONOTONIC, &t0);
+			impl[k].fn(p, res, out, n);
+			clock_gettime(CLOCK_MONOTONIC, &t1);
+			ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+			if ( (run == 0) || (ns < best))
+			{
+				best = ns;
+			}
+		}
+		if (k == 0)
+		{
+			scalar = best;
+		}
+		diff = 0;
+		err = 0;
+		ulps = 0;
+		for (i = 0; i < n; i++)
+		{
+			exact = ( ( ( (p->c[5] * (double)res[i] + p->c[4]) * res[i] + p->c[3]) * res[i]
+				+ p->c[2]) * res[i] + p->c[1]) * res[i] + p->c[0];
+			if (fabs(out[i] - ref[i]) > diff)
+			{
+				diff = fabs(out[i] - ref[i]);
+			}
+			if (fabs(out[i] - exact) > err)
+			{
+				err = fabs(out[i] - exact);
+			}
+			ulps = fmax(ulps, benchUlps(out[i] - ref[i], poly5Scale(p, res[i])));
+			ulps = fmax(ulps, benchUlps(out[i] - exact, poly5Scale(p, res[i])));
+		}
+		printf("%-8s %10.3f %9.2fx %12.3g %12.3g %8.2f %s\n", impl[k].name, best / n,
+			scalar / best, diff, err, ulps, ulps <= BENCH_ULPS_MAX ? "OK" : "FAIL");
+		if (ulps > BENCH_ULPS_MAX)
+		{
+			ret = FAIL;
+		}
+	}
+	free(res);
+	free(ref);
+	free(out);
+	return ret;
+}
+
+/*
+ * doCvdBench:
+ *	Timing of the Callendar-Van Dusen conversions over a PT100 sweep from
+ *	-200 to 850 degC and their largest error against the exact solution,
+ *	the poly5 fit is shown for comparison. FAIL if the exact or cubic
+ *	method is more than BENCH_ULPS_MAX away, or the linear one more than
+ *	CVD_LINEAR_ERR_MAX
+ */
+int doCvdBench(int argc, char *argv[])
+{
+	const char *name[] =
+	{
+		"exact",
+		"linear",
+		"cubic",
+		"poly5"
+	};
+	struct timespec t0;
+	struct timespec t1;
+	float *res = NULL;
+	float *out = NULL;
+	double *exact = NULL;
+	double best = 0;
+	double ns = 0;
+	double err = 0;
+	double ulps = 0;
+	long n = POLY5_BENCH_DEFAULT;
+	long i = 0;
+	int ret = OK;
+	int pass = 0;
+	int k = 0;
+	int run = 0;
+
+	if (argc > 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	if (argc == 3)
+	{
+		n = atol(argv[2]);
+	}
+	if (n <= 0)
+	{
+		printf("Invalid number of samples!\n");
+		return FAIL;
+	}
+	res = malloc(n * sizeof(float));
+	out = malloc(n * sizeof(float));
+	exact = malloc(n * sizeof(double));
+	if ( (NULL == res) || (NULL == out) || (NULL == exact))
+	{
+		printf("Out of memory!\n");
+		free(res);
+		free(out);
+		free(exact);
+		return FAIL;
+	}
+	for (i = 0; i < n; i++)
+	{
+		res[i] = rtdCvdRes(-200.0 + 1050.0 * i / n, RTD_CVD_R0_PT100);
+		exact[i] = rtdCvdTempExact(res[i], RTD_CVD_R0_PT100);
+	}
+	printf("%-8s %10s %16s %16s %8s\n", "method", "ns/sample", "max |err| degC",
+		"-200..660 degC", "ulps");
+	for (k = 0; k < 4; k++)
+	{
+		for (run = 0; run < POLY5_BENCH_RUNS; run++)
+		{
+			clock_gettime(CLOCK_MONOTONIC, &t0);
+			if (k < 3)
+			{
+				rtdCvdBatch(res, out, n, RTD_CVD_R0_PT100, k);
+			}
+			else
+			{
+				rtdPoly5Batch(NULL, res, out, n);
+			}
+			clock_gettime(CLOCK_MONOTONIC, &t1);
+			ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+			if ( (run == 0) || (ns < best))
+			{
+				best = ns;
+			}
+		}
+		err = 0;
+		ns = 0; // error inside the poly5 fit range
+		ulps = 0;
+		for (i = 0; i < n; i++)
+		{
+			if (fabs(out[i] - exact[i]) > err)
+			{
+				err = fabs(out[i] - exact[i]);
+			}
+			if ( (exact[i] <= 660) && (fabs(out[i] - exact[i]) > ns))
+			{
+				ns = fabs(out[i] - exact[i]);
+			}
+			// R / R0 is known to one float ULP, A degC per unit
+			ulps = fmax(ulps, benchUlps(out[i] - exact[i],
+				res[i] / (RTD_CVD_R0_PT100 * RTD_CVD_A)));
+		}
+		switch (k)
+		{
+		case RTD_CVD_EXACT:
+		case RTD_CVD_CUBIC:
+			pass = ulps <= BENCH_ULPS_MAX;
+			break;
+		case RTD_CVD_LINEAR:
+			pass = err <= CVD_LINEAR_ERR_MAX;
+			break;
+		default:
+			pass = -1; // the poly5 fit is not a CVD solution
+			break;
+		}
+		printf("%-8s %10.3f %16.3g %16.3g %8.2f %s\n", name[k], best / n, err, ns, ulps,
+			pass < 0 ? "" : (pass ? "OK" : "FAIL"));
+		if (0 == pass)
+		{
+			ret = FAIL;
+		}
+	}
+	free(res);
+	free(out);
+	free(exact);
+	return ret;
+}
+
+/*
+ * fixRef:
+ *	Exact solution rounded half away from zero, the reference of doFixBench
+ */
+static long fixRef(double temp, double scale)
+{
+	return (temp < 0) ? -(long)floor(-temp * scale + 0.5) : (long)floor(temp * scale + 0.5);
+}
+
+/*
+ * doFixBench:
+ *	The float path is the table conversion followed by the rounding every
+ *	consumer does, the integer one never leaves the integer unit. A value
+ *	may be off by one count at a rounding boundary, FAIL if more
+ */
+int doFixBench(int argc, char *argv[])
+{
+	const char *name[] =
+	{
+		"float 0.01 degC",
+		"int 0.01 degC",
+		"float 0.1 degC",
+		"int 0.1 degC"
+	};
+	struct timespec t0;
+	struct timespec t1;
+	float *res = NULL;
+	float *tmp = NULL;
+	int32_t *out = NULL;
+	double *exact = NULL;
+	double best = 0;
+	double ns = 0;
+	long n = POLY5_BENCH_DEFAULT;
+	long diff = 0;
+	long maxDiff = 0;
+	long d = 0;
+	long i = 0;
+	int ret = OK;
+	int k = 0;
+	int run = 0;
+
+	if (argc > 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	if (argc == 3)
+	{
+		n = atol(argv[2]);
+	}
+	if (n <= 0)
+	{
+		printf("Invalid number of samples!\n");
+		return FAIL;
+	}
+	res = malloc(n * sizeof(float));
+	tmp = malloc(n * sizeof(float));
+	out = malloc(n * sizeof(int32_t));
+	exact = malloc(n * sizeof(double));
+	if ( (NULL == res) || (NULL == tmp) || (NULL == out) || (NULL == exact))
+	{
+		printf("Out of memory!\n");
+		free(res);
+		free(tmp);
+		free(out);
+		free(exact);
+		return FAIL;
+	}
+	for (i = 0; i < n; i++)
+	{
+		res[i] = rtdCvdRes(-200.0 + 1050.0 * i / n, RTD_CVD_R0_PT100);
+		exact[i] = rtdCvdTempExact(res[i], RTD_CVD_R0_PT100);
+	}
+	printf("%-16s %10s %16s %8s\n", "method", "ns/sample", "off by one", "max |d|");
+	for (k = 0; k < 4; k++)
+	{
+		for (run = 0; run < POLY5_BENCH_RUNS; run++)
+		{
+			clock_gettime(CLOCK_MONOTONIC, &t0);
+			switch (k)
+			{
+			case 0:
+			case 2:
+				rtdCvdBatch(res, tmp, n, RTD_CVD_R0_PT100, RTD_CVD_CUBIC);
+				for (i = 0; i < n; i++)
+				{
+					out[i] = lroundf(tmp[i] * (k == 0 ? 100 : 10));
+				}
+				break;
+			default:
+				rtdFixBatch(res, out, n, 0, k == 1 ? RTD_FIX_CENTI_DEGC : RTD_FIX_DECI_DEGC);
+				break;
+			}
+			clock_gettime(CLOCK_MONOTONIC, &t1);
+			ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+			if ( (run == 0) || (ns < best))
+			{
+				best = ns;
+			}
+		}
+		diff = 0;
+		maxDiff = 0;
+		for (i = 0; i < n; i++)
+		{
+			d = labs(out[i] - fixRef(exact[i], k < 2 ? 100 : 10));
+			if (d != 0)
+			{
+				diff++;
+			}
+			if (d > maxDiff)
+			{
+				maxDiff = d;
+			}
+		}
+		printf("%-16s %10.3f %16ld %8ld %s\n", name[k], best / n, diff, maxDiff,
+			maxDiff <= 1 ? "OK" : "FAIL");
+		if (maxDiff > 1)
+		{
+			ret = FAIL;
+		}
+	}
+	free(res);
+	free(tmp);
+	free(out);
+	free(exact);
+	return ret;
+}
+
+#define DECODE_BUFF_SIZE	65536
+
+static const char *gUnitName[] =
+{
+	"degC",
+	"ohm"
+};
+
+static void decodeSegment(const RtdBinReaderType *r)
+{
+	int i = 0;
+
+	printf("# mono real");
+	for (i = 0; i < r->cols; i++)
+	{
+		printf(" %d:%d:%d:%s", r->col[i].bus, r->col[i].stack, r->col[i].channel,
+			r->col[i].unit <= RTD_BIN_UNIT_OHM ? gUnitName[r->col[i].unit] : "?");
+	}
+	printf("\n");
+}
+
+static void decodeRecord(const RtdBinReaderType *r, const RtdBinRecType *rec)
+{
+	int64_t real = rec->tsNs + r->realOffsetNs;
+	float val = 0;
+	int i = 0;
+
+	printf("%llu.%06llu %lld.%06lld", (unsigned long long)rec->tsNs / 1000000000ull,
+		(unsigned long long) (rec->tsNs % 1000000000ull) / 1000,
+		(long long)real / 1000000000ll, (long long) (real % 1000000000ll) / 1000);
+	for (i = 0; i < r->cols; i++)
+	{
+		val = rec->val[i];
+		printf(" %06f", val);
+	}
+	printf("\n");
+}
+
+/*
+ * doDecode:
+ *	Binary capture to text, read in chunks so a live capture from a pipe
+ *	is displayed as it comes
+ */
+int doDecode(int argc, char *argv[])
+{
+	static uint8_t buff[DECODE_BUFF_SIZE];
+	RtdBinReaderType r;
+	const RtdBinRecType *rec = NULL;
+	FILE *in = stdin;
+	size_t len = 0;
+	ssize_t n = 0;
+	int ret = OK;
+
+	if (argc > 3)
+	{
+		return ARG_CNT_ERR;
+	}
+	if ( (argc == 3) && (0 != strcmp(argv[2], "-")))
+	{
+		in = userFopen(argv[2], "rb");
+		if (NULL == in)
+		{
+			printf("Fail to open %s!\n", argv[2]);
+			return FAIL;
+		}
+	}
+	rtdBinReaderInit(&r);
+	while (ret == OK)
+	{
+		// read() returns what a pipe holds, fread() would wait for a full buffer
+		n = read(fileno(in), buff + len, sizeof(buff) - len);
+		if (n <= 0)
+		{
+			break;
+		}
+		len += n;
+		rtdBinReaderFeed(&r, buff, len);
+		while (ret == OK)
+		{
+			switch (rtdBinNext(&r, &rec))
+			{
+			case RTD_BIN_RECORD:
+				decodeRecord(&r, rec);
+				continue;
+			case RTD_BIN_SEGMENT:
+				decodeSegment(&r);
+				continue;
+			case RTD_BIN_MORE:
+				break;
+			default:
+				printf("Not a capture or corrupted at byte %zu!\n", r.off);
+				ret = FAIL;
+				break;
+			}
+			break;
+		}
+		len -= r.off;
+		memmove(buff, buff + r.off, len);
+		fflush(stdout);
+	}
+	if (in != stdin)
+	{
+		fclose(in);
+	}
+	if ( (ret == OK) && (len > 0))
+	{
+		fprintf(stderr, "%zu byte(s) of an incomplete record ignored\n", len);
+	}
+	return ret;
+}
+
+int main(int argc, char *argv[])
+{
+	if ( (argc > 3) && (strcasecmp(argv[1], "-bus") == 0))
+	{
+		i2cBusSet(atoi(argv[2]));
+		argv[2] = argv[0];
+		argv += 2;
+		argc -= 2;
+	}
+	if (argc == 1)
+	{
+		usage();
+		return -1;
+	}
+	return rtdDispatch(argc, argv) == OK ? 0 : 1;
 }
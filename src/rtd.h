@@ -2,6 +2,7 @@
 #define RTD_H_
 
 #include <stdint.h>
+#include "comm.h"
 
 
 #define RETRY_TIMES	10
@@ -95,6 +96,27 @@ typedef enum
 	STATE_COUNT
 } OutStateEnumType;
 
+typedef struct
+{
+	int bus;
+	int stack;
+	int hwType;
+	int hwMajor;
+	int hwMinor;
+	int fwMajor;
+	int fwMinor;
+} RtdBoardInfoType;
+
+#define RTD_DISCOVER_MAX	(I2C_BUS_MAX * 8)
+
+typedef struct
+{
+	RtdBoardInfoType info;
+	int status; // OK if val is valid
+	uint64_t tsNs; // CLOCK_MONOTONIC time of the block read
+	float val[RTD_CH_NR_MAX];
+} RtdFleetType;
+
 typedef struct
 {
 	const char *name;
@@ -109,7 +131,21 @@ typedef struct
 //const CliCmdType *gCmdArray[];
 
 int doBoardInit(int stack);
+void boardProbeCache(int enable);
+int boardHwTypeGet(int stack, int dev, int *hw);
+int boardSensorTypeGet(int stack, int dev, int *val);
+void boardSensorTypeSet(int bus, int stack, int val);
+int boardCheck(u8 add);
 int rtdHwTypeGet(int dev, int* hw);
+int rtdChGet(int dev, u8 channel, float *temperature);
+int rtdChGetR(int dev, u8 channel, float *resistance);
+int sensorRead(int dev, int* val);
+int rtdDiscover(RtdBoardInfoType *info, int max);
+int rtdDiscoverKnown(RtdBoardInfoType *info, int max, const u8 *known);
+int rtdFleetRead(int res, RtdFleetType *fleet, int max);
+int rtdChGetAll(int dev, float *temperature);
+int rtdChGetRAll(int dev, float *resistance);
+int rtdChGetBoth(int dev, float *temperature, float *resistance);
 
 //LED's
 extern const CliCmdType CMD_READ_LED_MODE;
@@ -0,0 +1,163 @@
+/*
+ * rtdbin.c:
+ *	Binary sample capture writer and decoder, see rtdbin.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "rtd.h"
+#include "rtdbin.h"
+
+static int64_t rtdBinRealOffset(void)
+{
+	struct timespec mono;
+	struct timespec real;
+
+	clock_gettime(CLOCK_MONOTONIC, &mono);
+	clock_gettime(CLOCK_REALTIME, &real);
+	return (int64_t) (real.tv_sec - mono.tv_sec) * 1000000000ll
+		+ (real.tv_nsec - mono.tv_nsec);
+}
+
+void rtdBinWriterInit(RtdBinWriterType *w, FILE *out)
+{
+	memset(w, 0, sizeof(*w));
+	w->out = out;
+}
+
+/*
+ * rtdBinColumns:
+ *	Columns of the next records, a new segment is started only if they
+ *	differ from the current ones
+ */
+int rtdBinColumns(RtdBinWriterType *w, const RtdBinColType *col, int cols)
+{
+	RtdBinHeaderType hdr;
+	uint8_t end[sizeof(uint64_t) + RTD_BIN_COLS_MAX * sizeof(float)];
+
+	if ( (cols <= 0) || (cols > RTD_BIN_COLS_MAX))
+	{
+		return ERROR;
+	}
+	if ( (cols == w->cols) && (0 == memcmp(col, w->col, cols * sizeof(*col))))
+	{
+		return OK;
+	}
+	if (w->cols > 0)
+	{
+		memset(end, 0xff, sizeof(end)); // tsNs = RTD_BIN_TS_END
+		if (1 != fwrite(end, sizeof(uint64_t) + w->cols * sizeof(float), 1, w->out))
+		{
+			return ERROR;
+		}
+	}
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = RTD_BIN_MAGIC;
+	hdr.version = RTD_BIN_VERSION;
+	hdr.hdrSize = sizeof(hdr);
+	hdr.cols = cols;
+	hdr.recSize = sizeof(uint64_t) + cols * sizeof(float);
+	hdr.realOffsetNs = rtdBinRealOffset();
+	if ( (1 != fwrite(&hdr, sizeof(hdr), 1, w->out))
+		|| (1 != fwrite(col, cols * sizeof(*col), 1, w->out)))
+	{
+		return ERROR;
+	}
+	memcpy(w->col, col, cols * sizeof(*col));
+	w->cols = cols;
+	return OK;
+}
+
+int rtdBinWrite(RtdBinWriterType *w, uint64_t tsNs, const float *val)
+{
+	if ( (w->cols == 0) || (tsNs == RTD_BIN_TS_END)
+		|| (1 != fwrite(&tsNs, sizeof(tsNs), 1, w->out))
+		|| (1 != fwrite(val, w->cols * sizeof(float), 1, w->out)))
+	{
+		return ERROR;
+	}
+	return OK;
+}
+
+void rtdBinReaderInit(RtdBinReaderType *r)
+{
+	memset(r, 0, sizeof(*r));
+}
+
+/*
+ * rtdBinReaderFeed:
+ *	Data to parse, the segment state is kept. The bytes not consumed by the
+ *	previous buffer (len - off) must be at the start of the new one
+ */
+void rtdBinReaderFeed(RtdBinReaderType *r, const void *buf, size_t len)
+{
+	r->buf = buf;
+	r->len = len;
+	r->off = 0;
+}
+
+static int rtdBinHeader(RtdBinReaderType *r)
+{
+	RtdBinHeaderType hdr;
+	size_t size = 0;
+
+	if (r->len - r->off < sizeof(hdr))
+	{
+		return RTD_BIN_MORE;
+	}
+	memcpy(&hdr, r->buf + r->off, sizeof(hdr));
+	if ( (hdr.magic != RTD_BIN_MAGIC) || (hdr.version < RTD_BIN_VERSION)
+		|| (hdr.hdrSize < sizeof(hdr)) || (hdr.cols == 0)
+		|| (hdr.cols > RTD_BIN_COLS_MAX)
+		|| (hdr.recSize < sizeof(uint64_t) + hdr.cols * sizeof(float)))
+	{
+		return FAIL;
+	}
+	size = hdr.hdrSize + hdr.cols * sizeof(RtdBinColType);
+	if (r->len - r->off < size)
+	{
+		return RTD_BIN_MORE;
+	}
+	memcpy(r->col, r->buf + r->off + hdr.hdrSize, hdr.cols * sizeof(RtdBinColType));
+	r->cols = hdr.cols;
+	r->recSize = hdr.recSize;
+	r->realOffsetNs = hdr.realOffsetNs;
+	r->off += size;
+	return RTD_BIN_SEGMENT;
+}
+
+/*
+ * rtdBinNext:
+ *	Parse the next item. A record is returned in place, without copy.
+ *	Return RTD_BIN_RECORD, RTD_BIN_SEGMENT, RTD_BIN_MORE or FAIL if the
+ *	data is not a capture
+ */
+int rtdBinNext(RtdBinReaderType *r, const RtdBinRecType **rec)
+{
+	const RtdBinRecType *p = NULL;
+
+	if (r->cols == 0)
+	{
+		return rtdBinHeader(r);
+	}
+	if (r->len - r->off < (size_t)r->recSize)
+	{
+		return RTD_BIN_MORE;
+	}
+	p = (const RtdBinRecType*) (r->buf + r->off);
+	r->off += r->recSize;
+	if (p->tsNs == RTD_BIN_TS_END)
+	{
+		r->cols = 0;
+		return rtdBinHeader(r);
+	}
+	*rec = p;
+	return RTD_BIN_RECORD;
+}
@@ -0,0 +1,99 @@
+#ifndef RTDBIN_H_
+#define RTDBIN_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Binary sample capture written by "rtd <id> stream ... -bin" and by
+ * "rtd -batch -bin <file>", little endian, made of segments:
+ *
+ *	RtdBinHeaderType                 hdrSize bytes (24 in version 1)
+ *	RtdBinColType col[cols]          4 bytes each
+ *	RtdBinRecType rec[]              recSize bytes each (8 + 4 * cols)
+ *
+ * A record holds the CLOCK_MONOTONIC time of the read and one float per
+ * column; realOffsetNs added to the time gives the wall clock. A segment
+ * lasts until the end of the data or until a record with tsNs ==
+ * RTD_BIN_TS_END, then a new header follows (the batch mode starts one
+ * each time the columns change). Readers skip the header fields and the
+ * record bytes they do not know, so fields can be appended without a new
+ * version. A truncated last record is a capture still being written.
+ */
+#define RTD_BIN_MAGIC	0x42445452 // "RTDB"
+#define RTD_BIN_VERSION	1
+#define RTD_BIN_COLS_MAX	256
+#define RTD_BIN_TS_END	UINT64_MAX
+
+enum
+{
+	RTD_BIN_UNIT_DEGC = 0,
+	RTD_BIN_UNIT_OHM,
+};
+
+typedef struct
+	__attribute__((packed))
+	{
+		uint32_t magic;
+		uint16_t version;
+		uint16_t hdrSize; // this structure, columns not included
+		uint16_t cols;
+		uint16_t recSize;
+		uint32_t res;
+		int64_t realOffsetNs; // CLOCK_REALTIME - CLOCK_MONOTONIC
+	} RtdBinHeaderType;
+
+typedef struct
+	__attribute__((packed))
+	{
+		uint8_t bus;
+		uint8_t stack;
+		uint8_t channel; // 1..8
+		uint8_t unit; // RTD_BIN_UNIT_*
+	} RtdBinColType;
+
+typedef struct
+	__attribute__((packed))
+	{
+		uint64_t tsNs;
+		float val[];
+	} RtdBinRecType;
+
+_Static_assert(sizeof(RtdBinHeaderType) == 24, "capture layout");
+_Static_assert(sizeof(RtdBinColType) == 4, "capture layout");
+
+typedef struct
+{
+	FILE *out;
+	int cols; // 0 before the first segment
+	RtdBinColType col[RTD_BIN_COLS_MAX];
+} RtdBinWriterType;
+
+void rtdBinWriterInit(RtdBinWriterType *w, FILE *out);
+int rtdBinColumns(RtdBinWriterType *w, const RtdBinColType *col, int cols);
+int rtdBinWrite(RtdBinWriterType *w, uint64_t tsNs, const float *val);
+
+enum
+{
+	RTD_BIN_MORE = 0, // incomplete, feed more data
+	RTD_BIN_SEGMENT, // new header parsed, columns updated
+	RTD_BIN_RECORD,
+};
+
+typedef struct
+{
+	const uint8_t *buf;
+	size_t len;
+	size_t off; // first byte not parsed yet
+	int cols; // current segment, 0 before the first header
+	int recSize;
+	int64_t realOffsetNs;
+	RtdBinColType col[RTD_BIN_COLS_MAX];
+} RtdBinReaderType;
+
+void rtdBinReaderInit(RtdBinReaderType *r);
+void rtdBinReaderFeed(RtdBinReaderType *r, const void *buf, size_t len);
+int rtdBinNext(RtdBinReaderType *r, const RtdBinRecType **rec);
+
+#endif //RTDBIN_H_
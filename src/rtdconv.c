@@ -0,0 +1,555 @@
+/*
+ * rtdconv.c:
+ *	Resistance to temperature conversions, scalar and vector kernels
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "rtd.h"
+#include "rtdconv.h"
+#include "cvdtab.h" // generated by cvdgen
+
+#define POLY5_IMPL_MAX	4
+
+const RtdPoly5Type RTD_POLY5_PT100 =
+{
+	{
+		-2.42522E+02,
+		2.24745E+00,
+		2.38589E-03,
+		-8.20888E-06,
+		2.27311E-08,
+		-2.10678E-11
+	}
+};
+
+static RtdPoly5FnType gPoly5Fn = NULL;
+static pthread_once_t gPoly5Once = PTHREAD_ONCE_INIT;
+
+/*
+ * rtdPoly5Eval:
+ *	One resistance, Horner form
+ *	temp_C = res ( res ( res ( res ( res * c5 + c4) + c3) + c2) + c1) + c0
+ */
+float rtdPoly5Eval(const RtdPoly5Type *p, float res)
+{
+	float temp_C = 0;
+
+	temp_C = res * p->c[5] + p->c[4];
+
+	temp_C *= res;
+	temp_C += p->c[3];
+
+	temp_C *= res;
+	temp_C += p->c[2];
+
+	temp_C *= res;
+	temp_C += p->c[1];
+
+	temp_C *= res;
+	temp_C += p->c[0];
+
+	return temp_C;
+}
+
+
+// kept scalar so the benchmark compares against the plain code
+__attribute__((optimize("no-tree-vectorize")))
+static void poly5Scalar(const RtdPoly5Type *p, const float *res, float *out, size_t n)
+{
+	size_t i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		out[i] = rtdPoly5Eval(p, res[i]);
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+__attribute__((target("sse2")))
+static void poly5Sse2(const RtdPoly5Type *p, const float *res, float *out, size_t n)
+{
+	__m128 c[6];
+	__m128 r;
+	__m128 t;
+	float tail[4] = {0};
+	size_t i = 0;
+	int k = 0;
+
+	for (k = 0; k < 6; k++)
+	{
+		c[k] = _mm_set1_ps(p->c[k]);
+	}
+	for (i = 0; i < n; i += 4)
+	{
+		if (i + 4 <= n)
+		{
+			r = _mm_loadu_ps(res + i);
+		}
+		else
+		{
+			memcpy(tail, res + i, (n - i) * sizeof(float)); // same rounding as the body
+			r = _mm_loadu_ps(tail);
+		}
+		t = _mm_add_ps(_mm_mul_ps(r, c[5]), c[4]);
+		t = _mm_add_ps(_mm_mul_ps(t, r), c[3]);
+		t = _mm_add_ps(_mm_mul_ps(t, r), c[2]);
+		t = _mm_add_ps(_mm_mul_ps(t, r), c[1]);
+		t = _mm_add_ps(_mm_mul_ps(t, r), c[0]);
+		if (i + 4 <= n)
+		{
+			_mm_storeu_ps(out + i, t);
+		}
+		else
+		{
+			_mm_storeu_ps(tail, t);
+			memcpy(out + i, tail, (n - i) * sizeof(float));
+		}
+	}
+}
+
+__attribute__((target("avx2,fma")))
+static void poly5Avx2(const RtdPoly5Type *p, const float *res, float *out, size_t n)
+{
+	__m256 c[6];
+	__m256 r;
+	__m256 t;
+	float tail[8] = {0};
+	size_t i = 0;
+	int k = 0;
+
+	for (k = 0; k < 6; k++)
+	{
+		c[k] = _mm256_set1_ps(p->c[k]);
+	}
+	for (i = 0; i < n; i += 8)
+	{
+		if (i + 8 <= n)
+		{
+			r = _mm256_loadu_ps(res + i);
+		}
+		else
+		{
+			memcpy(tail, res + i, (n - i) * sizeof(float));
+			r = _mm256_loadu_ps(tail);
+		}
+		t = _mm256_fmadd_ps(r, c[5], c[4]);
+		t = _mm256_fmadd_ps(t, r, c[3]);
+		t = _mm256_fmadd_ps(t, r, c[2]);
+		t = _mm256_fmadd_ps(t, r, c[1]);
+		t = _mm256_fmadd_ps(t, r, c[0]);
+		if (i + 8 <= n)
+		{
+			_mm256_storeu_ps(out + i, t);
+		}
+		else
+		{
+			_mm256_storeu_ps(tail, t);
+			memcpy(out + i, tail, (n - i) * sizeof(float));
+		}
+	}
+}
+
+#endif
+
+#if defined(__ARM_NEON)
+
+static void poly5Neon(const RtdPoly5Type *p, const float *res, float *out, size_t n)
+{
+	float32x4_t c[6];
+	float32x4_t r;
+	float32x4_t t;
+	float tail[4] = {0};
+	size_t i = 0;
+	int k = 0;
+
+	for (k = 0; k < 6; k++)
+	{
+		c[k] = vdupq_n_f32(p->c[k]);
+	}
+	for (i = 0; i < n; i += 4)
+	{
+		if (i + 4 <= n)
+		{
+			r = vld1q_f32(res + i);
+		}
+		else
+		{
+			memcpy(tail, res + i, (n - i) * sizeof(float));
+			r = vld1q_f32(tail);
+		}
+#if defined(__aarch64__)
+		t = vfmaq_f32(c[4], r, c[5]);
+		t = vfmaq_f32(c[3], t, r);
+		t = vfmaq_f32(c[2], t, r);
+		t = vfmaq_f32(c[1], t, r);
+		t = vfmaq_f32(c[0], t, r);
+#else
+		t = vmlaq_f32(c[4], r, c[5]);
+		t = vmlaq_f32(c[3], t, r);
+		t = vmlaq_f32(c[2], t, r);
+		t = vmlaq_f32(c[1], t, r);
+		t = vmlaq_f32(c[0], t, r);
+#endif
+		if (i + 4 <= n)
+		{
+			vst1q_f32(out + i, t);
+		}
+		else
+		{
+			vst1q_f32(tail, t);
+			memcpy(out + i, tail, (n - i) * sizeof(float));
+		}
+	}
+}
+
+#endif
+
+/*
+ * rtdPoly5Impls:
+ *	Kernels usable on this CPU, the fastest last. Return their number
+ */
+int rtdPoly5Impls(RtdPoly5ImplType *impl, int max)
+{
+	int cnt = 0;
+
+	if (cnt < max)
+	{
+		impl[cnt].name = "scalar";
+		impl[cnt++].fn = poly5Scalar;
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if ( (cnt < max) && __builtin_cpu_supports("sse2"))
+	{
+		impl[cnt].name = "sse2";
+		impl[cnt++].fn = poly5Sse2;
+	}
+	if ( (cnt < max) && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+	{
+		impl[cnt].name = "avx2";
+		impl[cnt++].fn = poly5Avx2;
+	}
+#endif
+#if defined(__ARM_NEON)
+	if (cnt < max)
+	{
+		impl[cnt].name = "neon";
+		impl[cnt++].fn = poly5Neon;
+	}
+#endif
+	return cnt;
+}
+
+static void poly5Select(void)
+{
+	RtdPoly5ImplType impl[POLY5_IMPL_MAX];
+	const char *force = getenv("RTD_SIMD"); // benchmarks and bug reports
+	int cnt = rtdPoly5Impls(impl, POLY5_IMPL_MAX);
+	int i = 0;
+
+	gPoly5Fn = impl[cnt - 1].fn;
+	for (i = 0; (NULL != force) && (i < cnt); i++)
+	{
+		if (0 == strcmp(force, impl[i].name))
+		{
+			gPoly5Fn = impl[i].fn;
+		}
+	}
+}
+
+/*
+ * rtdPoly5:
+ *	Convert resistance to temperature using the 5th order polynomial fit
+ *	(see doRtdReadPoly5 for details). Goes through the batch kernel so a
+ *	single value matches the same value converted in an array
+ ******************************************************************************************
+ */
+float rtdPoly5(float res)
+{
+	float temp = 0;
+
+	rtdPoly5Batch(NULL, &res, &temp, 1);
+	return temp;
+}
+
+/*
+ * rtdPoly5Batch:
+ *	out[i] = poly5(res[i]) for n values, p NULL selects RTD_POLY5_PT100.
+ *	res and out may be the same array
+ */
+void rtdPoly5Batch(const RtdPoly5Type *p, const float *res, float *out, size_t n)
+{
+	pthread_once(&gPoly5Once, poly5Select);
+	gPoly5Fn( (NULL == p) ? &RTD_POLY5_PT100 : p, res, out, n);
+}
+
+/*
+ * rtdCvdR0:
+ *	Nominal resistance for the I2C_MEM_PT1000 setting of the card
+ */
+float rtdCvdR0(int sensorType)
+{
+	return (sensorType == 1) ? RTD_CVD_R0_PT1000 : RTD_CVD_R0_PT100;
+}
+
+/*
+ * rtdCvd:
+ *	Temperature of a sensor with the given R0 from the generated table,
+ *	interp RTD_CVD_LINEAR or RTD_CVD_CUBIC, or solved with RTD_CVD_EXACT
+ */
+float rtdCvd(float res, float r0, int interp)
+{
+	const float *y = NULL;
+	// in double, a float W would already cost 1e-4 degC near 850 degC
+	double x = ( (double)res / r0 - RTD_CVD_TAB_W_MIN) * RTD_CVD_TAB_SCALE;
+	double u = 0;
+	int i = 0;
+
+	// the cubic needs one node on each side, x also fails this if NaN
+	if ( (interp == RTD_CVD_EXACT) || !(x >= 1) || (x >= RTD_CVD_TAB_SIZE - 2))
+	{
+		return rtdCvdTempExact(res, r0);
+	}
+	i = (int)x;
+	u = x - i;
+	y = gCvdTab + i;
+	if (interp == RTD_CVD_LINEAR)
+	{
+		return y[0] + u * (y[1] - y[0]);
+	}
+	// 4 point Lagrange on the nodes i - 1 .. i + 2
+	return ( (u - 1) * (u - 2) * ( (u + 1) * y[0] / 2 - u * y[-1] / 6)
+		- u * (u + 1) * ( (u - 2) * y[1] / 2 - (u - 1) * y[2] / 6));
+}
+
+void rtdCvdBatch(const float *res, float *out, size_t n, float r0, int interp)
+{
+	size_t i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		out[i] = rtdCvd(res[i], r0, interp);
+	}
+}
+
+#define FIX_RES_FRAC	20 // bits of the resistance below the ohm
+#define FIX_SAT	(1ll << 62)
+
+/*
+ * fixScale:
+ *	round(val * scale * 2^shift), half away from zero, saturated to
+ *	+-2^62. The float is decoded from its bits with integer operations,
+ *	the product of the 24 bit mantissa by scale (up to 2^20) is exact.
+ *	Return ERROR for NaN
+ */
+static int fixScale(uint32_t bits, uint32_t scale, int shift, int64_t *out)
+{
+	uint64_t p = 0;
+	int exp = 0;
+
+	exp = (bits >> 23) & 0xff;
+	p = bits & 0x7fffff;
+	if (exp == 0xff)
+	{
+		if (p != 0)
+		{
+			return ERROR;
+		}
+		*out = (bits >> 31) ? -FIX_SAT : FIX_SAT;
+		return OK;
+	}
+	if (exp == 0)
+	{
+		exp = 1; // subnormal
+	}
+	else
+	{
+		p |= 0x800000;
+	}
+	p *= scale;
+	exp += shift - 150; // val * 2^shift = mantissa * scale * 2^exp
+	if (exp > 0)
+	{
+		p = ( (exp >= 62) || (p >> (62 - exp))) ? FIX_SAT : p << exp;
+	}
+	else if (exp < 0)
+	{
+		p = (exp <= -63) ? 0 : (p + (1ull << (-exp - 1))) >> -exp;
+	}
+	if (p > FIX_SAT)
+	{
+		p = FIX_SAT;
+	}
+	*out = (bits >> 31) ? -(int64_t)p : (int64_t)p;
+	return OK;
+}
+
+static int32_t fixSat32(int64_t val)
+{
+	if (val <= INT32_MIN)
+	{
+		return INT32_MIN + 1; // not RTD_FIX_NAN
+	}
+	return (val > INT32_MAX) ? INT32_MAX : val;
+}
+
+/*
+ * rtdFixScale:
+ *	round(val * scale), half away from zero, saturated to the int32 range,
+ *	RTD_FIX_NAN if val is NaN
+ */
+static uint32_t fixBits(float val)
+{
+	uint32_t bits = 0;
+
+	memcpy(&bits, &val, sizeof(bits));
+	return bits;
+}
+
+int32_t rtdFixScale(float val, int32_t scale)
+{
+	int64_t v = 0;
+
+	if (OK != fixScale(fixBits(val), scale, 0, &v))
+	{
+		return RTD_FIX_NAN;
+	}
+	return fixSat32(v);
+}
+
+static int16_t fixSat16(int32_t val)
+{
+	if (val == RTD_FIX_NAN)
+	{
+		return INT16_MIN;
+	}
+	if (val < -INT16_MAX)
+	{
+		return -INT16_MAX; // INT16_MIN is kept for NaN
+	}
+	return (val > INT16_MAX) ? INT16_MAX : val;
+}
+
+/*
+ * rtdFixRegTemp / rtdFixRegRes:
+ *	Value of the Modbus TEMP (0.1 degC) and R_IN (ohm) input registers
+ */
+int16_t rtdFixRegTemp(float temp)
+{
+	return fixSat16(rtdFixScale(temp, 10));
+}
+
+uint16_t rtdFixRegRes(float res)
+{
+	int32_t val = rtdFixScale(res, 1);
+
+	if ( (val == RTD_FIX_NAN) || (val < 0))
+	{
+		return 0;
+	}
+	return (val > UINT16_MAX) ? UINT16_MAX : val;
+}
+
+/*
+ * fixMicroDeg:
+ *	Temperature in micro degC, saturated to the int32 range (+-2147 degC)
+ */
+static int32_t fixMicroDeg(uint32_t res, int sensorType)
+{
+	int64_t off = 0;
+	int64_t t = 0;
+	int64_t i = 0;
+	const int shift = FIX_RES_FRAC - RTD_FIX_TAB_SHIFT;
+
+	if (OK != fixScale(res, 1, FIX_RES_FRAC, &off))
+	{
+		return RTD_FIX_NAN;
+	}
+	if (sensorType == 1)
+	{
+		off /= 10; // PT1000 to PT100, a multiply by the compiler
+	}
+	off -= (int64_t)RTD_FIX_TAB_MIN << FIX_RES_FRAC;
+	i = (off < 0) ? 0 : off >> shift;
+	if (i > RTD_FIX_TAB_SIZE - 2)
+	{
+		i = RTD_FIX_TAB_SIZE - 2; // the end intervals extended
+	}
+	off -= i << shift;
+	if ( (off >> 40) && (~off >> 40))
+	{
+		off = (off < 0) ? -(1ll << 40) : 1ll << 40; // keeps the product in range
+	}
+	t = gCvdFixTab[i] + ( ( (int64_t)gCvdFixTab[i + 1] - gCvdFixTab[i]) * off >> shift);
+	return fixSat32(t);
+}
+
+static int32_t fixRound(int32_t val, int32_t div)
+{
+	if (val == RTD_FIX_NAN)
+	{
+		return RTD_FIX_NAN;
+	}
+	return (val < 0) ? -( (-(int64_t)val + div / 2) / div) : ( (int64_t)val + div / 2) / div;
+}
+
+static int32_t fixTemp(uint32_t res, int sensorType, int unit)
+{
+	int64_t v = 0;
+
+	switch (unit)
+	{
+	case RTD_FIX_DECI_DEGC:
+		return fixSat16(fixRound(fixMicroDeg(res, sensorType), 100000));
+	case RTD_FIX_MILLIOHM:
+		return (OK == fixScale(res, 1000, 0, &v)) ? fixSat32(v) : RTD_FIX_NAN;
+	default:
+		return fixRound(fixMicroDeg(res, sensorType), 10000);
+	}
+}
+
+int32_t rtdFixMicroDeg(float res, int sensorType)
+{
+	return fixMicroDeg(fixBits(res), sensorType);
+}
+
+/*
+ * rtdFixTemp:
+ *	Resistance to a RTD_FIX_* unit
+ */
+int32_t rtdFixTemp(float res, int sensorType, int unit)
+{
+	return fixTemp(fixBits(res), sensorType, unit);
+}
+
+/*
+ * rtdFixBatch:
+ *	The resistances are read as integers, the loop does not touch the FPU
+ */
+void rtdFixBatch(const float *res, int32_t *out, size_t n, int sensorType, int unit)
+{
+	uint32_t bits = 0;
+	size_t i = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		memcpy(&bits, &res[i], sizeof(bits));
+		out[i] = fixTemp(bits, sensorType, unit);
+	}
+}
@@ -0,0 +1,109 @@
+#ifndef RTDCONV_H_
+#define RTDCONV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Resistance to temperature conversions.
+ *
+ * rtdPoly5Batch() converts arrays of resistances with the widest vector
+ * unit of the CPU running the program (AVX2+FMA or SSE2 on x86, NEON on
+ * aarch64 / armhf built with NEON, scalar otherwise), picked once at the
+ * first call. All the kernels evaluate the same Horner form, the fused
+ * multiply-add ones may differ from the scalar code by one rounding.
+ */
+typedef struct
+{
+	float c[6]; // c[0] + c[1] * r + ... + c[5] * r^5
+} RtdPoly5Type;
+
+// fit of the ITS-90 PT100 curve on [-200, 660] degC, see doRtdReadPoly5
+extern const RtdPoly5Type RTD_POLY5_PT100;
+
+typedef void (*RtdPoly5FnType)(const RtdPoly5Type *p, const float *res, float *out,
+	size_t n);
+
+typedef struct
+{
+	const char *name;
+	RtdPoly5FnType fn;
+} RtdPoly5ImplType;
+
+float rtdPoly5(float res);
+float rtdPoly5Eval(const RtdPoly5Type *p, float res);
+void rtdPoly5Batch(const RtdPoly5Type *p, const float *res, float *out, size_t n);
+int rtdPoly5Impls(RtdPoly5ImplType *impl, int max);
+
+/*
+ * IEC 60751 Callendar-Van Dusen conversion of the PT100 / PT1000 sensors.
+ *
+ * rtdCvdTempExact() solves the equation (quadratic above 0 degC, Newton
+ * below). rtdCvd() interpolates a table of the temperature against the
+ * resistance ratio W = R / R0, generated at build time by cvdgen.c from
+ * the same code and shared by both sensors: one division, one index, no
+ * iteration. The table step is 1 / RTD_CVD_TAB_SCALE in W (0.39 ohm for
+ * a PT100), 4 KB; the linear interpolation error is below 2e-4 degC, the
+ * cubic one is at the float resolution (1e-4 degC). Outside the table
+ * (about -210 to 870 degC) the exact solution is returned.
+ */
+#define RTD_CVD_A	3.9083e-3
+#define RTD_CVD_B	-5.775e-7
+#define RTD_CVD_C	-4.183e-12
+#define RTD_CVD_R0_PT100	100.0
+#define RTD_CVD_R0_PT1000	1000.0
+
+#define RTD_CVD_TAB_W_MIN	0.125
+#define RTD_CVD_TAB_W_MAX	4.0
+#define RTD_CVD_TAB_SCALE	256
+#define RTD_CVD_TAB_SIZE	((int) ( (RTD_CVD_TAB_W_MAX - RTD_CVD_TAB_W_MIN) * RTD_CVD_TAB_SCALE) + 1)
+
+enum
+{
+	RTD_CVD_EXACT = 0,
+	RTD_CVD_LINEAR,
+	RTD_CVD_CUBIC,
+};
+
+double rtdCvdRes(double temp, double r0);
+double rtdCvdTempExact(double res, double r0);
+float rtdCvd(float res, float r0, int interp);
+void rtdCvdBatch(const float *res, float *out, size_t n, float r0, int interp);
+float rtdCvdR0(int sensorType);
+
+/*
+ * Integer conversion of the PT100 / PT1000 resistances, for the consumers
+ * without a FPU and the register exporters. Floats are taken apart with
+ * integer operations only and scaled with exact rounding, half away from
+ * zero, as the Modbus registers: TEMP in 0.1 degC saturated to
+ * [-32767, 32767], R_IN in ohm saturated to [0, 65535]. NaN gives
+ * RTD_FIX_NAN, or INT16_MIN in a 16 bit register (0 for R_IN).
+ *
+ * The temperature comes from a table of micro degC against the PT100
+ * resistance, generated by cvdgen.c, with nodes every 1/16 ohm from
+ * 18 ohm (-201 degC) to 402 ohm (889 degC) and linear interpolation of
+ * the resistance in 2^-20 ohm, 1e-6 degC off the exact equation. A PT1000
+ * resistance is divided by 10 first. Beyond the table the end intervals
+ * are extended.
+ */
+#define RTD_FIX_NAN	INT32_MIN
+
+#define RTD_FIX_TAB_MIN	18 // ohm
+#define RTD_FIX_TAB_SHIFT	4 // 2^-4 ohm between the nodes
+#define RTD_FIX_TAB_SIZE	( ( (402 - RTD_FIX_TAB_MIN) << RTD_FIX_TAB_SHIFT) + 1)
+
+enum
+{
+	RTD_FIX_CENTI_DEGC = 0, // int32, 0.01 degC
+	RTD_FIX_DECI_DEGC, // 0.1 degC, int16 range as the TEMP registers
+	RTD_FIX_MILLIOHM, // int32
+};
+
+int32_t rtdFixScale(float val, int32_t scale);
+int16_t rtdFixRegTemp(float temp);
+uint16_t rtdFixRegRes(float res);
+int32_t rtdFixMicroDeg(float res, int sensorType);
+int32_t rtdFixTemp(float res, int sensorType, int unit);
+void rtdFixBatch(const float *res, int32_t *out, size_t n, int sensorType, int unit);
+
+#endif //RTDCONV_H_
@@ -0,0 +1,1296 @@
+/*
+ * rtdd.c:
+ *	Resident polling daemon for the Raspberry Pi's MEGAS-RTD cards.
+ *	Owns the bus, polls every card at a fixed rate with block reads and
+ *	answers the latest readings to the clients over a unix socket.
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "rtd.h"
+#include "comm.h"
+#include "rtdd.h"
+#include "rtdshm.h"
+#include "rtdhist.h"
+#include "thread.h"
+#include "rs485.h"
+#include "modbus.h"
+#include "metrics.h"
+#include "rtdconv.h"
+#include "filter.h"
+#include "fault.h"
+
+#define RTDD_DISCOVER_S	30 // look for added cards this often
+#define RTDD_DISCOVER_MISS	3 // a card is dropped after missing this many discoveries in a row
+#define RTDD_DIAG_NS	1000000000ull // supply and cpu readings are slow
+#define RTDD_LAT_BUCKETS	10
+#define RTDD_FAULT_CFG_NS	10000000000ull // curve bindings looked at again
+
+// poll latency histogram upper bounds, seconds
+static const double gLatBounds[RTDD_LAT_BUCKETS - 1] =
+{
+	0.0005, 0.001, 0.002, 0.005, 0.01, 0.02, 0.05, 0.1, 0.25
+};
+
+typedef struct
+{
+	RtdBoardInfoType info;
+	int dev;
+	int status; // OK after a good poll
+	int missed; // discoveries in a row without the card
+	uint64_t tsNs;
+	uint64_t diagNs;
+	float temp[RTD_CH_NR_MAX]; // as read
+	float res[RTD_CH_NR_MAX];
+	float tempFilt[RTD_CH_NR_MAX]; // through the filter chain, as read without one
+	float resFilt[RTD_CH_NR_MAX];
+	u8 filtMask; // channels with a chain
+	u8 fault[RTD_CH_NR_MAX]; // RTD_FAULT_*
+	float vIn;
+	float vRasp;
+	int cpuTemp;
+	int wdtResets;
+	ModbusSetingsType mbSettings; // configuration, read with the diagnostics
+	u16 ledFunc;
+	s16 ledThreshold[RTD_CH_NR_MAX];
+	u8 sensorType;
+	uint32_t cfgGen; // bumped by the Modbus writes
+	uint64_t polls;
+	uint64_t pollErrors;
+	uint32_t samples;
+	uint64_t latBucket[RTDD_LAT_BUCKETS]; // last one is +Inf
+	double latSum;
+} RtddBoardType;
+
+static RtddBoardType gBoards[RTDD_BOARDS_MAX];
+static int gBoardsCount = 0;
+static s16 gBoardIndex[RTDD_BOARDS_MAX]; // bus * 8 + stack to gBoards, -1 if absent
+static pthread_mutex_t gBoardsMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t gXferMutex = PTHREAD_MUTEX_INITIALIZER; // poll vs Modbus writes
+static float gRate = RTDD_RATE_DEFAULT;
+static uint32_t gHistCapacity = RTD_HIST_CAPACITY_DEFAULT;
+static const char *gSocketPath = NULL;
+static int gMbPort = 0;
+static int gMbBus = I2C_BUS_DEFAULT;
+static int gMetricsPort = 0;
+// filters of the poll thread, bus * 8 + stack, temperatures then resistances,
+// NULL for the cards without any chain
+static RtdFilterType *gFilter[RTDD_BOARDS_MAX];
+static uint32_t gFilterGen[RTDD_BOARDS_MAX]; // chains loaded, compared to gFilterCur
+static uint32_t gFilterCur = 1;
+// fault classification of the poll thread, bus * 8 + stack
+static RtdFaultCfgType gFaultCfg[RTDD_BOARDS_MAX][RTD_CH_NR_MAX];
+static RtdFaultStateType gFaultState[RTDD_BOARDS_MAX][RTD_CH_NR_MAX];
+static uint64_t gFaultCfgNs[RTDD_BOARDS_MAX];
+static u8 gFaultSensor[RTDD_BOARDS_MAX];
+static float gFaultRate = RTD_FAULT_RATE_DEFAULT;
+static float gFaultStuck = RTD_FAULT_STUCK_DEFAULT;
+
+/*
+ * rtddIdx:
+ *	Index of a card in the bus * 8 + stack tables, -1 out of them
+ */
+static int rtddIdx(const RtdBoardInfoType *info)
+{
+	if ( (info->bus < 0) || (info->bus >= I2C_BUS_MAX) || (info->stack < 0)
+		|| (info->stack > 7))
+	{
+		return -1;
+	}
+	return info->bus * 8 + info->stack;
+}
+
+static uint64_t rtddNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/*
+ * rtddPublish:
+ *	Copy one board to the shared memory snapshot, called with the table
+ *	locked from the polling thread, the only writer
+ */
+static void rtddPublish(RtddBoardType *b, int present)
+{
+	RtdShmBoardType sb;
+	int i = 0;
+
+	memset(&sb, 0, sizeof(sb));
+	sb.present = present;
+	sb.bus = b->info.bus;
+	sb.stack = b->info.stack;
+	sb.hwType = b->info.hwType;
+	sb.tsNs = b->tsNs;
+	sb.vIn = b->vIn;
+	sb.vRasp = b->vRasp;
+	sb.cpuTemp = b->cpuTemp;
+	sb.wdtResets = b->wdtResets;
+	sb.polls = b->polls;
+	sb.pollErrors = b->pollErrors;
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		sb.ch[i].temp = b->temp[i];
+		sb.ch[i].res = b->res[i];
+		sb.ch[i].tempFilt = b->tempFilt[i];
+		sb.ch[i].resFilt = b->resFilt[i];
+		sb.ch[i].tsNs = b->tsNs;
+		sb.ch[i].seq = b->samples;
+		sb.ch[i].status = (b->status == OK) ? b->fault[i] : b->status;
+	}
+	rtdShmPublish(&sb);
+}
+
+static void rtddHistory(RtddBoardType *b)
+{
+	RtdHistRecType rec;
+	int i = 0;
+
+	memset(&rec, 0, sizeof(rec));
+	rec.tsNs = b->tsNs;
+	rec.bus = b->info.bus;
+	rec.stack = b->info.stack;
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		rec.channel = i + 1;
+		rec.temp = b->temp[i];
+		rec.res = b->res[i];
+		rec.status = b->fault[i];
+		rtdHistPush(&rec);
+	}
+}
+
+/*
+ * rtddDiscover:
+ *	Refresh the list of polled boards, keeping the readings of the boards
+ *	already known. The bus is probed under gXferMutex and the handles of
+ *	the known boards are never closed, the Modbus and socket threads use
+ *	them. A known board that does not answer is kept, polled as failed,
+ *	until it missed RTDD_DISCOVER_MISS discoveries
+ */
+static void rtddDiscover(void)
+{
+	RtdBoardInfoType info[RTDD_BOARDS_MAX];
+	static RtddBoardType boards[RTDD_BOARDS_MAX];
+	static u8 known[RTDD_BOARDS_MAX];
+	RtddBoardType tmp;
+	int cnt = 0;
+	int n = 0;
+	int i = 0;
+	int j = 0;
+
+	memset(known, 0, sizeof(known));
+	pthread_mutex_lock(&gBoardsMutex);
+	for (j = 0; j < gBoardsCount; j++)
+	{
+		known[rtddIdx(&gBoards[j].info)] = 1; // only cards with an index are kept
+	}
+	pthread_mutex_unlock(&gBoardsMutex);
+	pthread_mutex_lock(&gXferMutex);
+	cnt = rtdDiscoverKnown(info, RTDD_BOARDS_MAX, known);
+	pthread_mutex_unlock(&gXferMutex);
+	if (cnt < 0)
+	{
+		return;
+	}
+	pthread_mutex_lock(&gBoardsMutex);
+	for (i = 0; i < cnt; i++)
+	{
+		if (rtddIdx(&info[i]) < 0)
+		{
+			continue;
+		}
+		memset(&boards[n], 0, sizeof(RtddBoardType));
+		for (j = 0; j < gBoardsCount; j++)
+		{
+			if ( (gBoards[j].info.bus == info[i].bus)
+				&& (gBoards[j].info.stack == info[i].stack))
+			{
+				boards[n] = gBoards[j];
+				break;
+			}
+		}
+		boards[n].info = info[i];
+		boards[n].missed = 0;
+		boards[n].dev = i2cSetupBus(info[i].bus,
+			SLAVE_OWN_ADDRESS_BASE + info[i].stack);
+		if (j == gBoardsCount)
+		{
+			boards[n].status = FAIL;
+		}
+		n++;
+	}
+	for (j = 0; j < gBoardsCount; j++)
+	{
+		for (i = 0; i < cnt; i++)
+		{
+			if ( (gBoards[j].info.bus == info[i].bus)
+				&& (gBoards[j].info.stack == info[i].stack))
+			{
+				break;
+			}
+		}
+		if (i < cnt)
+		{
+			continue;
+		}
+		if ( (gBoards[j].missed + 1 < RTDD_DISCOVER_MISS) && (n < RTDD_BOARDS_MAX))
+		{
+			boards[n] = gBoards[j];
+			boards[n++].missed++;
+		}
+		else
+		{
+			rtddPublish(&gBoards[j], 0); // gone
+		}
+	}
+	// kept boards go back to their place, sorted by bus and stack level
+	for (i = 1; i < n; i++)
+	{
+		tmp = boards[i];
+		for (j = i; (j > 0) && (rtddIdx(&boards[j - 1].info) > rtddIdx(&tmp.info)); j--)
+		{
+			boards[j] = boards[j - 1];
+		}
+		boards[j] = tmp;
+	}
+	memcpy(gBoards, boards, n * sizeof(RtddBoardType));
+	gBoardsCount = n;
+	memset(gBoardIndex, 0xff, sizeof(gBoardIndex));
+	for (i = 0; i < n; i++)
+	{
+		gBoardIndex[rtddIdx(&gBoards[i].info)] = i;
+	}
+	pthread_mutex_unlock(&gBoardsMutex);
+}
+
+static int rtddPollDiag(RtddBoardType *b, RtddBoardType *out)
+{
+	u8 buff[3];
+	u8 buff2[32];
+	u16 aux16 = 0;
+	s8 saux8 = 0;
+
+	if (FAIL == i2cMem8Read(b->dev, DIAG_TEMPERATURE_MEM_ADD, buff, 3))
+	{
+		return FAIL;
+	}
+	memcpy(&saux8, buff, 1);
+	memcpy(&aux16, &buff[1], 2);
+	out->cpuTemp = saux8;
+	out->vIn = (float)aux16 / 1000;
+	if (FAIL == i2cMem8Read(b->dev, RTD_RASP_VOLT, buff, 2))
+	{
+		return FAIL;
+	}
+	memcpy(&aux16, buff, 2);
+	out->vRasp = (float)aux16 / 1000;
+	if (FAIL == i2cMem8Read(b->dev, I2C_MEM_WDT_RESET_COUNT_ADD, buff, 2))
+	{
+		return FAIL;
+	}
+	memcpy(&aux16, buff, 2);
+	out->wdtResets = aux16;
+	// RS-485 settings, LED functions and thresholds are contiguous
+	if (FAIL == i2cMem8Read(b->dev, I2C_MODBUS_SETINGS_ADD, buff2,
+		sizeof(ModbusSetingsType) + 2 + 2 * RTD_CH_NR_MAX))
+	{
+		return FAIL;
+	}
+	memcpy(&out->mbSettings, buff2, sizeof(ModbusSetingsType));
+	memcpy(&out->ledFunc, &buff2[RTD_LEDS_FUNC - I2C_MODBUS_SETINGS_ADD], 2);
+	memcpy(out->ledThreshold, &buff2[RTD_LED_THRESHOLD1 - I2C_MODBUS_SETINGS_ADD],
+		sizeof(out->ledThreshold));
+	if (FAIL == i2cMem8Read(b->dev, I2C_MEM_PT1000, buff, 1))
+	{
+		return FAIL;
+	}
+	out->sensorType = buff[0] & 0x0f;
+	return OK;
+}
+
+/*
+ * rtddFault:
+ *	Classify the readings of a card taken at nowNs. The bounds follow the
+ *	sensor type and the curve bindings, looked at again every
+ *	RTDD_FAULT_CFG_NS
+ */
+static void rtddFault(RtddBoardType *b, uint64_t nowNs)
+{
+	RtdFaultCfgType *cfg = NULL;
+	int idx = rtddIdx(&b->info);
+	int i = 0;
+
+	if (idx < 0)
+	{
+		return;
+	}
+	if ( (gFaultCfgNs[idx] == 0) || (nowNs - gFaultCfgNs[idx] >= RTDD_FAULT_CFG_NS)
+		|| (gFaultSensor[idx] != b->sensorType))
+	{
+		gFaultCfgNs[idx] = nowNs;
+		gFaultSensor[idx] = b->sensorType;
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			cfg = &gFaultCfg[idx][i];
+			if (OK != rtdFaultCfg(b->info.bus, b->info.stack, i + 1, b->sensorType, cfg))
+			{
+				cfg->curve = NULL;
+				continue;
+			}
+			cfg->rate = gFaultRate;
+			cfg->stuckNs = (uint64_t) (gFaultStuck * 1e9);
+		}
+	}
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		cfg = &gFaultCfg[idx][i];
+		b->fault[i] = (NULL == cfg->curve) ? RTD_FAULT_OK
+			: rtdFaultRun(cfg, &gFaultState[idx][i], b->res[i], nowNs);
+	}
+}
+
+/*
+ * rtddFilter:
+ *	Run the readings of a card through the filter chains of its channels,
+ *	to tempFilt and resFilt, the raw readings are served too. The filters
+ *	are reset when the chains file changes, the memory is only taken then,
+ *	not per sample
+ */
+static void rtddFilter(RtddBoardType *b)
+{
+	RtdFilterCfgType cfg[RTD_CH_NR_MAX];
+	RtdFilterType *f = NULL;
+	int idx = rtddIdx(&b->info);
+	int any = 0;
+	int i = 0;
+
+	memcpy(b->tempFilt, b->temp, sizeof(b->temp));
+	memcpy(b->resFilt, b->res, sizeof(b->res));
+	if (idx < 0)
+	{
+		return;
+	}
+	if (gFilterGen[idx] != gFilterCur)
+	{
+		gFilterGen[idx] = gFilterCur;
+		b->filtMask = 0;
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			if (OK == rtdFilterCfgGet(b->info.bus, b->info.stack, i + 1, &cfg[i]))
+			{
+				b->filtMask |= 1 << i;
+				any = 1;
+			}
+		}
+		if (!any)
+		{
+			free(gFilter[idx]);
+			gFilter[idx] = NULL;
+			return;
+		}
+		if (NULL == gFilter[idx])
+		{
+			gFilter[idx] = malloc(2 * RTD_CH_NR_MAX * sizeof(RtdFilterType));
+			if (NULL == gFilter[idx])
+			{
+				gFilterGen[idx] = 0; // try again at the next poll
+				b->filtMask = 0;
+				return;
+			}
+		}
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			rtdFilterInit(&gFilter[idx][i], &cfg[i]);
+			rtdFilterInit(&gFilter[idx][RTD_CH_NR_MAX + i], &cfg[i]);
+		}
+	}
+	f = gFilter[idx];
+	if (NULL == f)
+	{
+		return;
+	}
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		if (b->fault[i] != RTD_FAULT_OK)
+		{
+			continue; // kept out of the filter state
+		}
+		b->tempFilt[i] = rtdFilterRun(&f[i], b->temp[i]);
+		b->resFilt[i] = rtdFilterRun(&f[RTD_CH_NR_MAX + i], b->res[i]);
+	}
+}
+
+/*
+ * rtddPoll:
+ *	One pass over all boards, two block reads per board plus the slow
+ *	diagnostics once a second. The bus is accessed without holding the
+ *	table lock so the clients are never blocked by a transfer.
+ */
+static void rtddPoll(void)
+{
+	RtddBoardType b;
+	uint64_t now = 0;
+	double lat = 0;
+	int ok = 0;
+	int i = 0;
+	int j = 0;
+
+	if (rtdFilterRefresh())
+	{
+		gFilterCur++;
+	}
+	for (i = 0;; i++)
+	{
+		pthread_mutex_lock(&gBoardsMutex);
+		if (i >= gBoardsCount)
+		{
+			pthread_mutex_unlock(&gBoardsMutex);
+			break;
+		}
+		b = gBoards[i];
+		pthread_mutex_unlock(&gBoardsMutex);
+
+		now = rtddNow();
+		pthread_mutex_lock(&gXferMutex);
+		ok = (OK == rtdChGetBoth(b.dev, b.temp, b.res));
+		if (ok && (now - b.diagNs >= RTDD_DIAG_NS))
+		{
+			if (OK == rtddPollDiag(&b, &b))
+			{
+				b.diagNs = now;
+			}
+		}
+		pthread_mutex_unlock(&gXferMutex);
+		lat = (double) (rtddNow() - now) / 1e9;
+		if (ok)
+		{
+			rtddFault(&b, now);
+			rtddFilter(&b);
+		}
+
+		pthread_mutex_lock(&gBoardsMutex);
+		if ( (i < gBoardsCount) && (gBoards[i].info.bus == b.info.bus)
+			&& (gBoards[i].info.stack == b.info.stack))
+		{
+			gBoards[i].polls++;
+			for (j = 0; (j < RTDD_LAT_BUCKETS - 1) && (lat > gLatBounds[j]); j++)
+				;
+			gBoards[i].latBucket[j]++;
+			gBoards[i].latSum += lat;
+			if (ok)
+			{
+				memcpy(gBoards[i].temp, b.temp, sizeof(b.temp));
+				memcpy(gBoards[i].res, b.res, sizeof(b.res));
+				memcpy(gBoards[i].tempFilt, b.tempFilt, sizeof(b.tempFilt));
+				memcpy(gBoards[i].resFilt, b.resFilt, sizeof(b.resFilt));
+				gBoards[i].filtMask = b.filtMask;
+				memcpy(gBoards[i].fault, b.fault, sizeof(b.fault));
+				gBoards[i].vIn = b.vIn;
+				gBoards[i].vRasp = b.vRasp;
+				gBoards[i].cpuTemp = b.cpuTemp;
+				gBoards[i].wdtResets = b.wdtResets;
+				gBoards[i].diagNs = b.diagNs;
+				if (gBoards[i].cfgGen == b.cfgGen) // not written meanwhile
+				{
+					gBoards[i].mbSettings = b.mbSettings;
+					gBoards[i].ledFunc = b.ledFunc;
+					memcpy(gBoards[i].ledThreshold, b.ledThreshold,
+						sizeof(b.ledThreshold));
+					gBoards[i].sensorType = b.sensorType;
+				}
+				gBoards[i].tsNs = rtddNow();
+				gBoards[i].status = OK;
+				gBoards[i].samples++;
+			}
+			else
+			{
+				gBoards[i].pollErrors++;
+				gBoards[i].status = FAIL;
+			}
+			rtddPublish(&gBoards[i], 1);
+			if (ok)
+			{
+				rtddHistory(&gBoards[i]);
+			}
+		}
+		pthread_mutex_unlock(&gBoardsMutex);
+	}
+}
+
+static RtddBoardType* rtddMbBoard(int unit)
+{
+	int idx = gBoardIndex[gMbBus * 8 + unit];
+
+	if ( (idx < 0) || (gBoards[idx].status != OK))
+	{
+		return NULL;
+	}
+	return &gBoards[idx];
+}
+
+static int rtddMbImageGet(int unit, MbImageType *img)
+{
+	RtddBoardType *b = NULL;
+	int i = 0;
+
+	pthread_mutex_lock(&gBoardsMutex);
+	b = rtddMbBoard(unit);
+	if (NULL == b)
+	{
+		pthread_mutex_unlock(&gBoardsMutex);
+		return ERROR;
+	}
+	img->coils = b->ledFunc;
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		img->input[i] = (u16)rtdFixRegTemp(b->temp[i]);
+		img->input[RTD_CH_NR_MAX + i] = rtdFixRegRes(b->res[i]);
+		img->input[MB_IN_FAULT1 + i] = b->fault[i];
+		img->input[MB_IN_TEMP_FILT1 + i] = (u16)rtdFixRegTemp(b->tempFilt[i]);
+		img->holding[MB_HOLD_LED_TH1 + i] = (u16)b->ledThreshold[i];
+	}
+	img->holding[MB_HOLD_BAUD_100] = b->mbSettings.mbBaud / 100;
+	img->holding[MB_HOLD_ADD_OFFSET] = b->mbSettings.add;
+	img->holding[MB_HOLD_SENSOR_TYPE] = b->sensorType;
+	pthread_mutex_unlock(&gBoardsMutex);
+	return OK;
+}
+
+static int rtddMbCoilsWrite(int unit, u16 coils)
+{
+	RtddBoardType *b = NULL;
+	int dev = 0;
+	int ret = OK;
+
+	pthread_mutex_lock(&gBoardsMutex);
+	b = rtddMbBoard(unit);
+	dev = (NULL == b) ? -1 : b->dev;
+	pthread_mutex_unlock(&gBoardsMutex);
+	if (dev < 0)
+	{
+		return MB_EX_TARGET_FAILED;
+	}
+	pthread_mutex_lock(&gXferMutex);
+	if (OK != i2cMem8Write(dev, RTD_LEDS_FUNC, (u8*)&coils, 2))
+	{
+		ret = MB_EX_DEVICE_FAILURE;
+	}
+	pthread_mutex_unlock(&gXferMutex);
+	if (ret == OK)
+	{
+		pthread_mutex_lock(&gBoardsMutex);
+		b = rtddMbBoard(unit);
+		if (NULL != b)
+		{
+			b->ledFunc = coils;
+			b->cfgGen++;
+		}
+		pthread_mutex_unlock(&gBoardsMutex);
+	}
+	return ret;
+}
+
+/*
+ * rtddMbHoldingWrite:
+ *	Check the new holding registers image and write the groups that
+ *	changed: LED thresholds, RS-485 settings, sensor type
+ */
+static int rtddMbHoldingWrite(int unit, const u16 *holding, int first,
+	int count)
+{
+	RtddBoardType *b = NULL;
+	ModbusSetingsType settings;
+	s16 th[RTD_CH_NR_MAX];
+	u8 sensor = 0;
+	int last = first + count - 1;
+	int dev = 0;
+	int ret = OK;
+	int i = 0;
+
+	// only the written registers are checked, the others keep the card values
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		th[i] = (s16)holding[MB_HOLD_LED_TH1 + i];
+		if ( (MB_HOLD_LED_TH1 + i >= first) && (MB_HOLD_LED_TH1 + i <= last)
+			&& ( (th[i] < -200) || (th[i] > 300)))
+		{
+			return MB_EX_ILLEGAL_VALUE;
+		}
+	}
+	if ( ( (first <= MB_HOLD_BAUD_100) && (last >= MB_HOLD_BAUD_100)
+		&& ( (holding[MB_HOLD_BAUD_100] < 12) || (holding[MB_HOLD_BAUD_100] > 9216)))
+		|| ( (first <= MB_HOLD_ADD_OFFSET) && (last >= MB_HOLD_ADD_OFFSET)
+			&& ( (holding[MB_HOLD_ADD_OFFSET] < 1) || (holding[MB_HOLD_ADD_OFFSET] > 255)))
+		|| ( (last >= MB_HOLD_SENSOR_TYPE) && (holding[MB_HOLD_SENSOR_TYPE] > 1)))
+	{
+		return MB_EX_ILLEGAL_VALUE;
+	}
+	pthread_mutex_lock(&gBoardsMutex);
+	b = rtddMbBoard(unit);
+	dev = (NULL == b) ? -1 : b->dev;
+	if (NULL != b)
+	{
+		settings = b->mbSettings;
+	}
+	pthread_mutex_unlock(&gBoardsMutex);
+	if (dev < 0)
+	{
+		return MB_EX_TARGET_FAILED;
+	}
+	settings.mbBaud = holding[MB_HOLD_BAUD_100] * 100;
+	settings.add = holding[MB_HOLD_ADD_OFFSET];
+	sensor = holding[MB_HOLD_SENSOR_TYPE];
+
+	pthread_mutex_lock(&gXferMutex);
+	if ( (first <= MB_HOLD_LED_TH1 + RTD_CH_NR_MAX - 1)
+		&& (OK != i2cMem8Write(dev, RTD_LED_THRESHOLD1, (u8*)th, sizeof(th))))
+	{
+		ret = MB_EX_DEVICE_FAILURE;
+	}
+	if ( (ret == OK) && (first <= MB_HOLD_ADD_OFFSET) && (last >= MB_HOLD_BAUD_100)
+		&& (OK != i2cMem8Write(dev, I2C_MODBUS_SETINGS_ADD, (u8*)&settings,
+			sizeof(settings))))
+	{
+		ret = MB_EX_DEVICE_FAILURE;
+	}
+	if ( (ret == OK) && (last >= MB_HOLD_SENSOR_TYPE)
+		&& (OK != i2cMem8Write(dev, I2C_MEM_PT1000, &sensor, 1)))
+	{
+		ret = MB_EX_DEVICE_FAILURE;
+	}
+	pthread_mutex_unlock(&gXferMutex);
+
+	pthread_mutex_lock(&gBoardsMutex);
+	b = rtddMbBoard(unit);
+	if ( (NULL != b) && (ret == OK))
+	{
+		memcpy(b->ledThreshold, th, sizeof(th));
+		b->mbSettings = settings;
+		b->sensorType = sensor;
+		boardSensorTypeSet(b->info.bus, b->info.stack, sensor);
+	}
+	if (NULL != b)
+	{
+		b->cfgGen++;
+		b->diagNs = 0; // read back on the next poll, even after a failure
+	}
+	pthread_mutex_unlock(&gBoardsMutex);
+	return ret;
+}
+
+static const MbHandlerType gMbHandler =
+{
+	rtddMbImageGet,
+	rtddMbCoilsWrite,
+	rtddMbHoldingWrite
+};
+
+enum
+{
+	RTDD_M_UP = 0,
+	RTDD_M_AGE,
+	RTDD_M_VIN,
+	RTDD_M_VRASP,
+	RTDD_M_CPU,
+	RTDD_M_WDT,
+	RTDD_M_POLLS,
+	RTDD_M_POLL_ERRORS,
+	RTDD_M_XFERS,
+	RTDD_M_RETRIES,
+	RTDD_M_FAILURES,
+	RTDD_M_NR
+};
+
+// one value per board, OpenMetrics wants the samples of a family together
+static const struct
+{
+	const char *name;
+	const char *type;
+	const char *help;
+} gMetrics[RTDD_M_NR] =
+{
+	{"rtd_up", "gauge", "1 if the last poll of the card succeeded"},
+	{"rtd_sample_age_seconds", "gauge", "Time since the last good poll"},
+	{"rtd_supply_volts", "gauge", "Card power supply"},
+	{"rtd_raspberry_volts", "gauge", "Raspberry Pi 5V supply"},
+	{"rtd_cpu_temperature_celsius", "gauge", "Card processor temperature"},
+	{"rtd_watchdog_resets", "gauge", "Watchdog reset count stored on the card"},
+	{"rtd_polls", "counter", "Poll cycles"},
+	{"rtd_poll_errors", "counter", "Poll cycles with a failed transfer"},
+	{"rtd_i2c_transfers", "counter", "i2c transfers"},
+	{"rtd_i2c_retries", "counter", "i2c transfer attempts repeated"},
+	{"rtd_i2c_failures", "counter", "i2c transfers failed after all the attempts"},
+};
+
+static int rtddMetricValue(const RtddBoardType *b, const CommStatsType *st,
+	int id, uint64_t now, double *val)
+{
+	int diag = (b->diagNs != 0);
+
+	switch (id)
+	{
+	case RTDD_M_UP:
+		*val = b->status == OK;
+		return OK;
+	case RTDD_M_AGE:
+		*val = (double) (now - b->tsNs) / 1e9;
+		return b->samples > 0 ? OK : ERROR;
+	case RTDD_M_VIN:
+		*val = b->vIn;
+		return diag ? OK : ERROR;
+	case RTDD_M_VRASP:
+		*val = b->vRasp;
+		return diag ? OK : ERROR;
+	case RTDD_M_CPU:
+		*val = b->cpuTemp;
+		return diag ? OK : ERROR;
+	case RTDD_M_WDT:
+		*val = b->wdtResets;
+		return diag ? OK : ERROR;
+	case RTDD_M_POLLS:
+		*val = b->polls;
+		return OK;
+	case RTDD_M_POLL_ERRORS:
+		*val = b->pollErrors;
+		return OK;
+	case RTDD_M_XFERS:
+		*val = st->xfers;
+		return OK;
+	case RTDD_M_RETRIES:
+		*val = st->retries;
+		return OK;
+	case RTDD_M_FAILURES:
+		*val = st->failures;
+		return OK;
+	}
+	return ERROR;
+}
+
+/*
+ * rtddMetrics:
+ *	Format the cached readings and the counters of every board, the table
+ *	is copied under the lock and formatted without it
+ */
+static void rtddMetrics(FILE *out)
+{
+	static const char *errKind[4] = {"nack", "timeout", "again", "other"};
+	RtddBoardType *boards = NULL;
+	CommStatsType *st = NULL;
+	uint64_t now = rtddNow();
+	uint64_t errs[4];
+	uint64_t cum = 0;
+	double val = 0;
+	char lbl[32];
+	int cnt = 0;
+	int m = 0;
+	int i = 0;
+	int j = 0;
+
+	boards = malloc(RTDD_BOARDS_MAX * (sizeof(RtddBoardType) + sizeof(CommStatsType)));
+	if (NULL == boards)
+	{
+		return;
+	}
+	st = (CommStatsType*) (boards + RTDD_BOARDS_MAX);
+	pthread_mutex_lock(&gBoardsMutex);
+	cnt = gBoardsCount;
+	memcpy(boards, gBoards, cnt * sizeof(RtddBoardType));
+	pthread_mutex_unlock(&gBoardsMutex);
+	for (i = 0; i < cnt; i++)
+	{
+		if (OK != i2cStatsGet(boards[i].info.bus,
+			SLAVE_OWN_ADDRESS_BASE + boards[i].info.stack, &st[i]))
+		{
+			memset(&st[i], 0, sizeof(CommStatsType));
+		}
+	}
+
+	fprintf(out, "# TYPE rtd_temperature_celsius gauge\n");
+	for (i = 0; i < cnt; i++)
+	{
+		for (j = 0; (boards[i].status == OK) && (j < RTD_CH_NR_MAX); j++)
+		{
+			fprintf(out, "rtd_temperature_celsius{bus=\"%d\",stack=\"%d\",channel=\"%d\"} %g\n",
+				boards[i].info.bus, boards[i].info.stack, j + 1, boards[i].temp[j]);
+		}
+	}
+	fprintf(out, "# TYPE rtd_sensor_fault gauge\n"
+		"# HELP rtd_sensor_fault Sensor fault of the last sample: 0 ok, 1 open, 2 short, 3 rate, 4 stuck, 5 invalid\n");
+	for (i = 0; i < cnt; i++)
+	{
+		for (j = 0; (boards[i].status == OK) && (j < RTD_CH_NR_MAX); j++)
+		{
+			fprintf(out, "rtd_sensor_fault{bus=\"%d\",stack=\"%d\",channel=\"%d\"} %d\n",
+				boards[i].info.bus, boards[i].info.stack, j + 1, boards[i].fault[j]);
+		}
+	}
+	fprintf(out, "# TYPE rtd_resistance_ohms gauge\n");
+	for (i = 0; i < cnt; i++)
+	{
+		for (j = 0; (boards[i].status == OK) && (j < RTD_CH_NR_MAX); j++)
+		{
+			fprintf(out, "rtd_resistance_ohms{bus=\"%d\",stack=\"%d\",channel=\"%d\"} %g\n",
+				boards[i].info.bus, boards[i].info.stack, j + 1, boards[i].res[j]);
+		}
+	}
+	fprintf(out, "# TYPE rtd_temperature_filtered_celsius gauge\n"
+		"# HELP rtd_temperature_filtered_celsius Output of the filter chain, channels with a chain only\n");
+	for (i = 0; i < cnt; i++)
+	{
+		for (j = 0; (boards[i].status == OK) && (j < RTD_CH_NR_MAX); j++)
+		{
+			if (boards[i].filtMask & (1 << j))
+			{
+				fprintf(out,
+					"rtd_temperature_filtered_celsius{bus=\"%d\",stack=\"%d\",channel=\"%d\"} %g\n",
+					boards[i].info.bus, boards[i].info.stack, j + 1, boards[i].tempFilt[j]);
+			}
+		}
+	}
+	fprintf(out, "# TYPE rtd_resistance_filtered_ohms gauge\n"
+		"# HELP rtd_resistance_filtered_ohms Output of the filter chain, channels with a chain only\n");
+	for (i = 0; i < cnt; i++)
+	{
+		for (j = 0; (boards[i].status == OK) && (j < RTD_CH_NR_MAX); j++)
+		{
+			if (boards[i].filtMask & (1 << j))
+			{
+				fprintf(out,
+					"rtd_resistance_filtered_ohms{bus=\"%d\",stack=\"%d\",channel=\"%d\"} %g\n",
+					boards[i].info.bus, boards[i].info.stack, j + 1, boards[i].resFilt[j]);
+			}
+		}
+	}
+	for (m = 0; m < RTDD_M_NR; m++)
+	{
+		fprintf(out, "# TYPE %s %s\n# HELP %s %s\n", gMetrics[m].name,
+			gMetrics[m].type, gMetrics[m].name, gMetrics[m].help);
+		for (i = 0; i < cnt; i++)
+		{
+			if (OK == rtddMetricValue(&boards[i], &st[i], m, now, &val))
+			{
+				fprintf(out, "%s%s{bus=\"%d\",stack=\"%d\"} %.10g\n", gMetrics[m].name,
+					gMetrics[m].type[0] == 'c' ? "_total" : "", boards[i].info.bus,
+					boards[i].info.stack, val);
+			}
+		}
+	}
+	fprintf(out, "# TYPE rtd_i2c_errors counter\n"
+		"# HELP rtd_i2c_errors Failed i2c attempts by errno class\n");
+	for (i = 0; i < cnt; i++)
+	{
+		errs[0] = st[i].nack;
+		errs[1] = st[i].timeout;
+		errs[2] = st[i].again;
+		errs[3] = st[i].other;
+		for (j = 0; j < 4; j++)
+		{
+			fprintf(out, "rtd_i2c_errors_total{bus=\"%d\",stack=\"%d\",kind=\"%s\"} %llu\n",
+				boards[i].info.bus, boards[i].info.stack, errKind[j],
+				(unsigned long long)errs[j]);
+		}
+	}
+
+	fprintf(out, "# TYPE rtd_poll_duration_seconds histogram\n"
+		"# HELP rtd_poll_duration_seconds Bus time to poll one card\n");
+	for (i = 0; i < cnt; i++)
+	{
+		snprintf(lbl, sizeof(lbl), "bus=\"%d\",stack=\"%d\"", boards[i].info.bus,
+			boards[i].info.stack);
+		cum = 0;
+		for (j = 0; j < RTDD_LAT_BUCKETS - 1; j++)
+		{
+			cum += boards[i].latBucket[j];
+			fprintf(out, "rtd_poll_duration_seconds_bucket{%s,le=\"%g\"} %llu\n", lbl,
+				gLatBounds[j], (unsigned long long)cum);
+		}
+		cum += boards[i].latBucket[j];
+		fprintf(out, "rtd_poll_duration_seconds_bucket{%s,le=\"+Inf\"} %llu\n", lbl,
+			(unsigned long long)cum);
+		fprintf(out, "rtd_poll_duration_seconds_count{%s} %llu\n", lbl,
+			(unsigned long long)cum);
+		fprintf(out, "rtd_poll_duration_seconds_sum{%s} %g\n", lbl, boards[i].latSum);
+	}
+	free(boards);
+}
+
+static void* rtddPollThread(void *arg)
+{
+	PeriodicType sched;
+	uint64_t lastDiscover = rtddNow();
+
+	(void)arg;
+	periodicStart(&sched, (long long) (1e9 / gRate));
+	while (1)
+	{
+		rtddPoll();
+		if (rtddNow() - lastDiscover > RTDD_DISCOVER_S * 1000000000ull)
+		{
+			rtddDiscover();
+			lastDiscover = rtddNow();
+		}
+		// absolute deadlines, the poll time does not add up as drift
+		periodicWait(&sched);
+	}
+	return NULL;
+}
+
+static float rtddQty(const RtddBoardType *b, int qty, int ch)
+{
+	switch (qty)
+	{
+	case RTDD_QTY_RES:
+		return b->res[ch];
+	case RTDD_QTY_TEMP_FILT:
+		return b->tempFilt[ch];
+	case RTDD_QTY_RES_FILT:
+		return b->resFilt[ch];
+	default:
+		break;
+	}
+	return b->temp[ch];
+}
+
+/*
+ * rtddAnswer:
+ *	Build the response to one request frame, all the values are taken
+ *	under one lock so they come from the same poll cycle
+ */
+static int rtddAnswer(const u8 *req, u8 *resp)
+{
+	const RtddFrameType *rHdr = (const RtddFrameType*)req;
+	const RtddItemType *item = (const RtddItemType*)(req + sizeof(RtddFrameType));
+	RtddFrameType *hdr = (RtddFrameType*)resp;
+	RtddValType *val = (RtddValType*)(resp + sizeof(RtddFrameType));
+	RtddBoardType *b = NULL;
+	int idx = 0;
+	int i = 0;
+
+	memset(hdr, 0, sizeof(RtddFrameType));
+	hdr->tag = rHdr->tag;
+	hdr->count = rHdr->count;
+	hdr->status = OK;
+	hdr->len = sizeof(RtddFrameType) + rHdr->count * sizeof(RtddValType);
+	pthread_mutex_lock(&gBoardsMutex);
+	for (i = 0; i < rHdr->count; i++)
+	{
+		memset(&val[i], 0, sizeof(RtddValType));
+		val[i].status = FAIL;
+		if ( (item[i].bus >= I2C_BUS_MAX) || (item[i].stack > 7)
+			|| (item[i].channel < CHANNEL_NR_MIN)
+			|| (item[i].channel > RTD_CH_NR_MAX) || (item[i].qty >= RTDD_QTY_COUNT))
+		{
+			continue;
+		}
+		idx = gBoardIndex[item[i].bus * 8 + item[i].stack];
+		if (idx < 0)
+		{
+			continue;
+		}
+		b = &gBoards[idx];
+		if (b->status == OK)
+		{
+			val[i].status = OK;
+			val[i].fault = b->fault[item[i].channel - 1];
+			val[i].tsNs = b->tsNs;
+			val[i].val = rtddQty(b, item[i].qty, item[i].channel - 1);
+		}
+	}
+	pthread_mutex_unlock(&gBoardsMutex);
+	return hdr->len;
+}
+
+static int rtddWriteFull(int fd, const u8 *buff, int size)
+{
+	int n = 0;
+
+	while (size > 0)
+	{
+		n = write(fd, buff, size);
+		if (n <= 0)
+		{
+			return -1;
+		}
+		buff += n;
+		size -= n;
+	}
+	return 0;
+}
+
+/*
+ * rtddClientThread:
+ *	Serve one connection. Every complete request already received is
+ *	answered before the responses are written back in a single call, a
+ *	pipelining client gets one write per read instead of one per request
+ */
+static void* rtddClientThread(void *arg)
+{
+	int fd = (int)(intptr_t)arg;
+	u8 *in = malloc(2 * RTDD_REQ_MAX);
+	u8 *out = malloc(2 * RTDD_RESP_MAX);
+	RtddFrameType *hdr = NULL;
+	int inLen = 0;
+	int outLen = 0;
+	int pos = 0;
+	int n = 0;
+
+	while ( (NULL != in) && (NULL != out))
+	{
+		n = read(fd, in + inLen, 2 * RTDD_REQ_MAX - inLen);
+		if (n <= 0)
+		{
+			break;
+		}
+		inLen += n;
+		pos = 0;
+		outLen = 0;
+		while (inLen - pos >= (int)sizeof(RtddFrameType))
+		{
+			hdr = (RtddFrameType*) (in + pos);
+			if ( (hdr->count > RTDD_ITEMS_MAX)
+				|| (hdr->len != sizeof(RtddFrameType) + hdr->count * sizeof(RtddItemType)))
+			{
+				n = -1; // lost the frame boundaries
+				break;
+			}
+			if (inLen - pos < (int)hdr->len)
+			{
+				break;
+			}
+			if (outLen + RTDD_RESP_MAX > 2 * RTDD_RESP_MAX)
+			{
+				if (0 != rtddWriteFull(fd, out, outLen))
+				{
+					n = -1;
+					break;
+				}
+				outLen = 0;
+			}
+			outLen += rtddAnswer(in + pos, out + outLen);
+			pos += hdr->len;
+		}
+		if ( (n < 0) || (0 != rtddWriteFull(fd, out, outLen)))
+		{
+			break;
+		}
+		memmove(in, in + pos, inLen - pos);
+		inLen -= pos;
+	}
+	free(in);
+	free(out);
+	close(fd);
+	return NULL;
+}
+
+static int rtddListen(const char *path)
+{
+	struct sockaddr_un sa;
+	int fd = 0;
+
+	fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+	{
+		return -1;
+	}
+	memset(&sa, 0, sizeof(sa));
+	sa.sun_family = AF_UNIX;
+	strncpy(sa.sun_path, path, sizeof(sa.sun_path) - 1);
+	unlink(path);
+	if ( (bind(fd, (struct sockaddr*)&sa, sizeof(sa)) < 0) || (listen(fd, 16) < 0))
+	{
+		close(fd);
+		return -1;
+	}
+	chmod(path, 0666); // readings are not secret, let any user query them
+	return fd;
+}
+
+static void rtddSignal(int sig)
+{
+	(void)sig;
+	if (NULL != gSocketPath)
+	{
+		unlink(gSocketPath);
+	}
+	_exit(0);
+}
+
+static void rtddUsage(void)
+{
+	printf("Usage: rtdd [-f] [-r <rate>] [-s <socket>] [-H <records>] [-m <port>] [-b <bus>] [-p <port>] [-d <degC/s>] [-k <s>]\n");
+	printf("\t-f            Run in foreground\n");
+	printf("\t-r <rate>     Polls per second for every card (default %d)\n",
+		RTDD_RATE_DEFAULT);
+	printf("\t-s <socket>   Unix socket path (default %s)\n", RTDD_SOCKET_DEFAULT);
+	printf("\t-H <records>  History ring capacity, 8 records per card poll (default %d)\n",
+		RTD_HIST_CAPACITY_DEFAULT);
+	printf("\t-m <port>     Serve the cards over Modbus TCP on this port (%d is the standard one)\n",
+		MB_TCP_PORT_DEFAULT);
+	printf("\t-b <bus>      i2c bus of the cards served over Modbus TCP (default %d)\n",
+		I2C_BUS_DEFAULT);
+	printf("\t-p <port>     Serve OpenMetrics on http://<host>:<port>/metrics (%d is the suggested one)\n",
+		METRICS_PORT_DEFAULT);
+	printf("\t-d <degC/s>   Rate of change above which a sample is an outlier, 0 for no check (default %d)\n",
+		RTD_FAULT_RATE_DEFAULT);
+	printf("\t-k <s>        Time a resistance may stay the same before the channel is stuck, 0 for no check (default %d)\n",
+		RTD_FAULT_STUCK_DEFAULT);
+}
+
+int main(int argc, char *argv[])
+{
+	pthread_t thread;
+	unsigned long histCapacity = RTD_HIST_CAPACITY_DEFAULT;
+	int foreground = 0;
+	int listenFd = 0;
+	int fd = 0;
+	int opt = 0;
+
+	gSocketPath = rtddSocketPath();
+	while ( (opt = getopt(argc, argv, "fr:s:H:m:b:p:d:k:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'f':
+			foreground = 1;
+			break;
+		case 'r':
+			gRate = atof(optarg);
+			break;
+		case 's':
+			gSocketPath = optarg;
+			break;
+		case 'H':
+			histCapacity = strtoul(optarg, NULL, 0);
+			break;
+		case 'm':
+			gMbPort = atoi(optarg);
+			break;
+		case 'b':
+			gMbBus = atoi(optarg);
+			break;
+		case 'p':
+			gMetricsPort = atoi(optarg);
+			break;
+		case 'd':
+			gFaultRate = atof(optarg);
+			break;
+		case 'k':
+			gFaultStuck = atof(optarg);
+			break;
+		default:
+			rtddUsage();
+			return opt == 'h' ? 0 : 1;
+		}
+	}
+	if ( (gRate <= 0) || (gRate > 1000))
+	{
+		printf("Invalid poll rate (0..1000]!\n");
+		return 1;
+	}
+	if ( (gMbPort < 0) || (gMbPort > 65535) || (gMbBus < 0) || (gMbBus >= I2C_BUS_MAX))
+	{
+		printf("Invalid Modbus TCP port or bus!\n");
+		return 1;
+	}
+	if ( (gMetricsPort < 0) || (gMetricsPort > 65535))
+	{
+		printf("Invalid metrics port!\n");
+		return 1;
+	}
+	if ( (gFaultRate < 0) || (gFaultStuck < 0))
+	{
+		printf("Invalid fault limits!\n");
+		return 1;
+	}
+	if ( (histCapacity == 0) || (histCapacity > RTD_HIST_CAPACITY_MAX))
+	{
+		printf("Invalid history capacity [1..%d]!\n", RTD_HIST_CAPACITY_MAX);
+		return 1;
+	}
+	gHistCapacity = (uint32_t)histCapacity;
+
+	if (OK != rtdShmCreate())
+	{
+		printf("rtdd: fail to create the shared memory snapshot %s\n",
+		RTD_SHM_NAME);
+	}
+	if (OK != rtdHistCreate(gHistCapacity))
+	{
+		printf("rtdd: fail to create the history ring %s\n", RTD_HIST_NAME);
+	}
+	memset(gBoardIndex, 0xff, sizeof(gBoardIndex));
+	rtddDiscover();
+	printf("rtdd: %d board(s) detected, polling at %0.1f Hz\n", gBoardsCount,
+		gRate);
+	fflush(stdout);
+	listenFd = rtddListen(gSocketPath);
+	if (listenFd < 0)
+	{
+		printf("rtdd: fail to listen on %s: %s\n", gSocketPath, strerror(errno));
+		return 1;
+	}
+	// bind every port while the errors still reach the terminal
+	if ( (gMbPort > 0) && (OK != mbTcpListen(gMbPort, &gMbHandler)))
+	{
+		printf("rtdd: fail to listen on Modbus TCP port %d: %s\n", gMbPort,
+			strerror(errno));
+		unlink(gSocketPath);
+		return 1;
+	}
+	if ( (gMetricsPort > 0) && (OK != metricsListen(gMetricsPort, rtddMetrics)))
+	{
+		printf("rtdd: fail to listen on metrics port %d: %s\n", gMetricsPort,
+			strerror(errno));
+		unlink(gSocketPath);
+		return 1;
+	}
+	if (!foreground && (daemon(0, 0) < 0))
+	{
+		printf("rtdd: fail to detach: %s\n", strerror(errno));
+		unlink(gSocketPath);
+		return 1;
+	}
+	signal(SIGPIPE, SIG_IGN);
+	signal(SIGINT, rtddSignal);
+	signal(SIGTERM, rtddSignal);
+
+	if ( (0 != pthread_create(&thread, NULL, rtddPollThread, NULL))
+		|| ( (gMbPort > 0) && (OK != mbTcpStart()))
+		|| ( (gMetricsPort > 0) && (OK != metricsStart())))
+	{
+		unlink(gSocketPath);
+		return 1;
+	}
+	while (1)
+	{
+		fd = accept(listenFd, NULL, NULL);
+		if (fd < 0)
+		{
+			continue;
+		}
+		if (0 != pthread_create(&thread, NULL, rtddClientThread, (void*)(intptr_t)fd))
+		{
+			close(fd);
+			continue;
+		}
+		pthread_detach(thread);
+	}
+	return 0;
+}
@@ -0,0 +1,79 @@
+#ifndef RTDD_H_
+#define RTDD_H_
+
+#include "rtd.h"
+
+/*
+ * rtdd, the resident polling daemon, answers the latest readings over a
+ * unix socket so the command line and the scripts do not touch the bus
+ */
+#define RTDD_SOCKET_DEFAULT	"/run/rtdd.sock"
+#define RTDD_RATE_DEFAULT	10 // polls per second
+#define RTDD_STALE_NS	5000000000ull // older readings are not trusted
+#define RTDD_BOARDS_MAX	RTD_DISCOVER_MAX
+
+/*
+ * Quantities served, the readings as the card gives them and the output of
+ * the filter chains of the channels (filter.h), the same as the readings
+ * for a channel without a chain
+ */
+enum
+{
+	RTDD_QTY_TEMP = 0,
+	RTDD_QTY_RES,
+	RTDD_QTY_TEMP_FILT,
+	RTDD_QTY_RES_FILT,
+	RTDD_QTY_COUNT
+};
+
+/*
+ * Socket protocol, host byte order, every frame starts with its length:
+ *	request:  RtddFrameType + count x RtddItemType
+ *	response: RtddFrameType + count x RtddValType, same tag, same item order
+ * A client may write any number of requests before reading the responses,
+ * they are answered in the order received. A frame the daemon can not parse
+ * closes the connection.
+ */
+#define RTDD_ITEMS_MAX	2048 // per frame
+#define RTDD_REQ_MAX	(sizeof(RtddFrameType) + RTDD_ITEMS_MAX * sizeof(RtddItemType))
+#define RTDD_RESP_MAX	(sizeof(RtddFrameType) + RTDD_ITEMS_MAX * sizeof(RtddValType))
+
+typedef struct
+	__attribute__((packed))
+	{
+		uint32_t len; // frame size in bytes, this header included
+		uint32_t tag; // chosen by the client, echoed in the response
+		uint16_t count; // number of items that follow
+		s8 status; // response: OK, FAIL if the request is refused
+		u8 res;
+	} RtddFrameType;
+
+typedef struct
+	__attribute__((packed))
+	{
+		u8 bus;
+		u8 stack;
+		u8 channel; // 1..8
+		u8 qty; // RTDD_QTY_*
+	} RtddItemType;
+
+typedef struct
+	__attribute__((packed))
+	{
+		s8 status; // OK or FAIL if the board is not polled
+		u8 fault; // RTD_FAULT_* of the channel (fault.h)
+		u8 res[2];
+		float val;
+		uint64_t tsNs; // CLOCK_MONOTONIC time of the reading
+	} RtddValType;
+
+const char* rtddSocketPath(void);
+int rtddOpen(void);
+void rtddClose(int fd);
+int rtddSend(int fd, uint32_t tag, const RtddItemType *item, int count);
+int rtddRecv(int fd, uint32_t *tag, RtddValType *val, int max);
+int rtddQuery(int fd, const RtddItemType *item, int count, RtddValType *val);
+int rtddGet(int bus, int stack, int qty, float *val);
+int rtddGetFault(int bus, int stack, int *fault);
+
+#endif //RTDD_H_
@@ -0,0 +1,320 @@
+/*
+ * rtddclient.c:
+ *	Query the latest readings from the rtdd daemon
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#define _GNU_SOURCE // secure_getenv
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "rtdd.h"
+#include "rtdshm.h"
+
+/*
+ * rtddSocketPath:
+ *	RTDD_SOCKET environment variable or the default path
+ */
+const char* rtddSocketPath(void)
+{
+	char *env = secure_getenv("RTDD_SOCKET");
+
+	if ( (NULL != env) && (*env != 0))
+	{
+		return env;
+	}
+	return RTDD_SOCKET_DEFAULT;
+}
+
+static int rtddEnabled(void)
+{
+	char *env = secure_getenv("RTD_NO_DAEMON");
+
+	if ( (NULL != env) && (atoi(env) != 0))
+	{
+		return ERROR;
+	}
+	return OK;
+}
+
+/*
+ * rtddOpen:
+ *	Connect to the daemon, return the socket or -1 if it is not running
+ */
+int rtddOpen(void)
+{
+	struct sockaddr_un sa;
+	int fd = 0;
+
+	if (OK != rtddEnabled())
+	{
+		return -1;
+	}
+	fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0)
+	{
+		return -1;
+	}
+	memset(&sa, 0, sizeof(sa));
+	sa.sun_family = AF_UNIX;
+	strncpy(sa.sun_path, rtddSocketPath(), sizeof(sa.sun_path) - 1);
+	if (connect(fd, (struct sockaddr*)&sa, sizeof(sa)) < 0)
+	{
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+void rtddClose(int fd)
+{
+	if (fd >= 0)
+	{
+		close(fd);
+	}
+}
+
+static int rtddReadFull(int fd, void *buff, int size)
+{
+	int got = 0;
+	int n = 0;
+
+	while (got < size)
+	{
+		n = read(fd, (u8*)buff + got, size - got);
+		if (n <= 0)
+		{
+			return -1;
+		}
+		got += n;
+	}
+	return 0;
+}
+
+/*
+ * rtddSend:
+ *	Write one request, does not wait for the response so several requests
+ *	can be in flight on the same socket
+ */
+int rtddSend(int fd, uint32_t tag, const RtddItemType *item, int count)
+{
+	u8 buff[RTDD_REQ_MAX];
+	RtddFrameType *hdr = (RtddFrameType*)buff;
+	int len = 0;
+
+	if ( (NULL == item) || (count < 0) || (count > RTDD_ITEMS_MAX))
+	{
+		return ERROR;
+	}
+	len = sizeof(RtddFrameType) + count * sizeof(RtddItemType);
+	memset(hdr, 0, sizeof(RtddFrameType));
+	hdr->len = len;
+	hdr->tag = tag;
+	hdr->count = count;
+	memcpy(buff + sizeof(RtddFrameType), item, count * sizeof(RtddItemType));
+	if (write(fd, buff, len) != len)
+	{
+		return ERROR;
+	}
+	return OK;
+}
+
+/*
+ * rtddRecv:
+ *	Read the next response, return the number of values or -1 on error
+ */
+int rtddRecv(int fd, uint32_t *tag, RtddValType *val, int max)
+{
+	RtddFrameType hdr;
+	RtddValType dummy;
+	int i = 0;
+
+	if ( (NULL == val) || (0 != rtddReadFull(fd, &hdr, sizeof(hdr))))
+	{
+		return -1;
+	}
+	if ( (hdr.count > RTDD_ITEMS_MAX)
+		|| (hdr.len != sizeof(hdr) + hdr.count * sizeof(RtddValType)))
+	{
+		return -1;
+	}
+	for (i = 0; i < hdr.count; i++)
+	{
+		if (0 != rtddReadFull(fd, i < max ? &val[i] : &dummy, sizeof(RtddValType)))
+		{
+			return -1;
+		}
+	}
+	if (NULL != tag)
+	{
+		*tag = hdr.tag;
+	}
+	if (hdr.status != OK)
+	{
+		return -1;
+	}
+	return hdr.count < max ? hdr.count : max;
+}
+
+/*
+ * rtddQuery:
+ *	One round trip for any set of (board, channel, quantity), return the
+ *	number of values or -1 on error
+ */
+int rtddQuery(int fd, const RtddItemType *item, int count, RtddValType *val)
+{
+	if (OK != rtddSend(fd, 0, item, count))
+	{
+		return -1;
+	}
+	return rtddRecv(fd, NULL, val, count);
+}
+
+/*
+ * rtddGet:
+ *	Read all channels of one board from the daemon cache. Return ERROR if
+ *	the daemon is not running, does not poll this board or the reading is
+ *	stale, the caller then reads the card directly
+ */
+int rtddGet(int bus, int stack, int qty, float *val)
+{
+	RtddItemType item[RTD_CH_NR_MAX];
+	RtddValType resp[RTD_CH_NR_MAX];
+	RtdShmBoardType board;
+	struct timespec ts;
+	uint64_t now = 0;
+	int fd = 0;
+	int ret = ERROR;
+	int i = 0;
+
+	if ( (NULL == val) || (qty < 0) || (qty >= RTDD_QTY_COUNT))
+	{
+		return ERROR;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	now = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+
+	// shared memory snapshot first, no round trip to the daemon
+	if ( (OK == rtddEnabled()) && (OK == rtdShmRead(bus, stack, &board))
+		&& (board.ch[0].status != FAIL) && (now - board.tsNs < RTDD_STALE_NS))
+	{
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			switch (qty)
+			{
+			case RTDD_QTY_RES:
+				val[i] = board.ch[i].res;
+				break;
+			case RTDD_QTY_TEMP_FILT:
+				val[i] = board.ch[i].tempFilt;
+				break;
+			case RTDD_QTY_RES_FILT:
+				val[i] = board.ch[i].resFilt;
+				break;
+			default:
+				val[i] = board.ch[i].temp;
+				break;
+			}
+		}
+		return OK;
+	}
+
+	fd = rtddOpen();
+	if (fd < 0)
+	{
+		return ERROR;
+	}
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		item[i].bus = bus;
+		item[i].stack = stack;
+		item[i].channel = i + 1;
+		item[i].qty = qty;
+	}
+	if (RTD_CH_NR_MAX == rtddQuery(fd, item, RTD_CH_NR_MAX, resp))
+	{
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		now = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+		ret = OK;
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			if ( (resp[i].status != OK) || (now - resp[i].tsNs >= RTDD_STALE_NS))
+			{
+				ret = ERROR;
+			}
+			val[i] = resp[i].val;
+		}
+	}
+	rtddClose(fd);
+	return ret;
+}
+
+/*
+ * rtddGetFault:
+ *	Fault status (RTD_FAULT_*) of all channels of one board as classified
+ *	by the daemon, same fallback rules as rtddGet
+ */
+int rtddGetFault(int bus, int stack, int *fault)
+{
+	RtddItemType item[RTD_CH_NR_MAX];
+	RtddValType resp[RTD_CH_NR_MAX];
+	RtdShmBoardType board;
+	struct timespec ts;
+	uint64_t now = 0;
+	int fd = 0;
+	int ret = ERROR;
+	int i = 0;
+
+	if (NULL == fault)
+	{
+		return ERROR;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	now = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+	if ( (OK == rtddEnabled()) && (OK == rtdShmRead(bus, stack, &board))
+		&& (board.ch[0].status != FAIL) && (now - board.tsNs < RTDD_STALE_NS))
+	{
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			fault[i] = board.ch[i].status;
+		}
+		return OK;
+	}
+
+	fd = rtddOpen();
+	if (fd < 0)
+	{
+		return ERROR;
+	}
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		item[i].bus = bus;
+		item[i].stack = stack;
+		item[i].channel = i + 1;
+		item[i].qty = RTDD_QTY_RES;
+	}
+	if (RTD_CH_NR_MAX == rtddQuery(fd, item, RTD_CH_NR_MAX, resp))
+	{
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		now = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+		ret = OK;
+		for (i = 0; i < RTD_CH_NR_MAX; i++)
+		{
+			if ( (resp[i].status != OK) || (now - resp[i].tsNs >= RTDD_STALE_NS))
+			{
+				ret = ERROR;
+			}
+			fault[i] = resp[i].fault;
+		}
+	}
+	rtddClose(fd);
+	return ret;
+}
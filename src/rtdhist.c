@@ -0,0 +1,228 @@
+/*
+ * rtdhist.c:
+ *	Shared memory history ring buffer of the polled samples, see rtdhist.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "rtd.h"
+#include "rtdhist.h"
+
+static RtdHistType *gHist = NULL;
+
+/*
+ * rtdHistSize:
+ *	Size of a ring with "capacity" records, computed in 64 bits so a 32-bit
+ *	size_t never wraps
+ */
+static int rtdHistSize(uint32_t capacity, size_t *size)
+{
+	uint64_t len = 0;
+
+	if ( (capacity == 0) || (capacity > RTD_HIST_CAPACITY_MAX))
+	{
+		return ERROR;
+	}
+	len = sizeof(RtdHistType) + (uint64_t)capacity * sizeof(RtdHistRecType);
+	if ( (len > SIZE_MAX) || (len > (uint64_t)INT32_MAX))
+	{
+		return ERROR;
+	}
+	*size = (size_t)len;
+	return OK;
+}
+
+/*
+ * rtdHistCreate:
+ *	Writer side (rtdd), create the ring with "capacity" records
+ */
+int rtdHistCreate(uint32_t capacity)
+{
+	size_t size = 0;
+	int fd = 0;
+
+	if (OK != rtdHistSize(capacity, &size))
+	{
+		return ERROR;
+	}
+	// a new object, readers that mapped an older ring keep it untouched
+	shm_unlink(RTD_HIST_NAME);
+	fd = shm_open(RTD_HIST_NAME, O_RDWR | O_CREAT | O_EXCL, 0644);
+	if (fd < 0)
+	{
+		return ERROR;
+	}
+	fchmod(fd, 0644);
+	if (0 != ftruncate(fd, (off_t)size))
+	{
+		close(fd);
+		shm_unlink(RTD_HIST_NAME);
+		return ERROR;
+	}
+	gHist = mmap(NULL, size, PROT_READ | PROT_WRITE,
+	MAP_SHARED, fd, 0);
+	close(fd);
+	if (MAP_FAILED == gHist)
+	{
+		gHist = NULL;
+		return ERROR;
+	}
+	gHist->version = RTD_HIST_VERSION;
+	gHist->recSize = sizeof(RtdHistRecType);
+	gHist->capacity = capacity;
+	gHist->head = 0;
+	__atomic_store_n(&gHist->magic, RTD_HIST_MAGIC, __ATOMIC_RELEASE);
+	return OK;
+}
+
+void rtdHistPush(RtdHistRecType *rec)
+{
+	RtdHistRecType *pRec = NULL;
+	uint64_t head = 0;
+
+	if (NULL == gHist)
+	{
+		return;
+	}
+	head = gHist->head;
+	pRec = &gHist->rec[head % gHist->capacity];
+	__atomic_store_n(&pRec->seq, RTD_HIST_SEQ_BUSY, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	pRec->tsNs = rec->tsNs;
+	pRec->bus = rec->bus;
+	pRec->stack = rec->stack;
+	pRec->channel = rec->channel;
+	pRec->status = rec->status;
+	pRec->temp = rec->temp;
+	pRec->res = rec->res;
+	pRec->res1 = 0;
+	__atomic_store_n(&pRec->seq, head, __ATOMIC_RELEASE);
+	__atomic_store_n(&gHist->head, head + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * rtdHistOpen:
+ *	Reader side, map the ring published by rtdd
+ */
+int rtdHistOpen(void)
+{
+	RtdHistType *pHist = NULL;
+	struct stat st;
+	size_t size = 0;
+	int fd = 0;
+
+	if (NULL != gHist)
+	{
+		return OK;
+	}
+	fd = shm_open(RTD_HIST_NAME, O_RDONLY, 0);
+	if (fd < 0)
+	{
+		return ERROR;
+	}
+	if ( (0 != fstat(fd, &st)) || ( (st.st_uid != 0) && (st.st_uid != geteuid()))
+		|| (st.st_size < (off_t)sizeof(RtdHistType))
+		|| ((uint64_t)st.st_size > SIZE_MAX))
+	{
+		close(fd);
+		return ERROR;
+	}
+	pHist = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (MAP_FAILED == pHist)
+	{
+		return ERROR;
+	}
+	if ( (__atomic_load_n(&pHist->magic, __ATOMIC_ACQUIRE) != RTD_HIST_MAGIC)
+		|| (pHist->version != RTD_HIST_VERSION)
+		|| (pHist->recSize != sizeof(RtdHistRecType))
+		|| (OK != rtdHistSize(pHist->capacity, &size))
+		|| ((uint64_t)size > (uint64_t)st.st_size))
+	{
+		munmap(pHist, st.st_size);
+		return ERROR;
+	}
+	gHist = pHist;
+	return OK;
+}
+
+uint64_t rtdHistHead(void)
+{
+	if (NULL == gHist)
+	{
+		return 0;
+	}
+	return __atomic_load_n(&gHist->head, __ATOMIC_ACQUIRE);
+}
+
+uint32_t rtdHistCapacity(void)
+{
+	if (NULL == gHist)
+	{
+		return 0;
+	}
+	return gHist->capacity;
+}
+
+/*
+ * rtdHistRead:
+ *	Copy up to "max" records starting at *cursor and advance it. Records
+ *	lost to overruns are skipped and added to *lost. Return the number of
+ *	records copied.
+ */
+int rtdHistRead(uint64_t *cursor, RtdHistRecType *out, int max, uint64_t *lost)
+{
+	RtdHistRecType *pRec = NULL;
+	uint64_t head = 0;
+	uint64_t seq1 = 0;
+	uint64_t seq2 = 0;
+	uint64_t skipped = 0;
+	int cnt = 0;
+
+	if ( (NULL == gHist) || (NULL == cursor) || (NULL == out))
+	{
+		return ERROR;
+	}
+	while (cnt < max)
+	{
+		head = __atomic_load_n(&gHist->head, __ATOMIC_ACQUIRE);
+		if (*cursor >= head)
+		{
+			break;
+		}
+		if (head - *cursor > gHist->capacity)
+		{
+			skipped += head - gHist->capacity - *cursor;
+			*cursor = head - gHist->capacity;
+		}
+		pRec = &gHist->rec[*cursor % gHist->capacity];
+		seq1 = __atomic_load_n(&pRec->seq, __ATOMIC_ACQUIRE);
+		memcpy(&out[cnt], pRec, sizeof(RtdHistRecType));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		seq2 = __atomic_load_n(&pRec->seq, __ATOMIC_RELAXED);
+		if ( (seq1 != *cursor) || (seq2 != *cursor))
+		{
+			// overwritten while copying, the writer lapped us
+			(*cursor)++;
+			skipped++;
+			continue;
+		}
+		(*cursor)++;
+		cnt++;
+	}
+	if (NULL != lost)
+	{
+		*lost += skipped;
+	}
+	return cnt;
+}
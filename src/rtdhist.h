@@ -0,0 +1,62 @@
+#ifndef RTDHIST_H_
+#define RTDHIST_H_
+
+#include <stdint.h>
+
+/*
+ * History of the samples polled by rtdd, a single writer / many readers
+ * ring buffer in the POSIX shared memory object "/rtdd-history":
+ *
+ *	RtdHistType header               32 bytes
+ *	RtdHistRecType rec[capacity]     32 bytes each
+ *
+ * Record number n (counted from the daemon start) is stored at
+ * rec[n % capacity]. The writer first sets the record "seq" to
+ * RTD_HIST_SEQ_BUSY, fills the record, stores "seq" = n and then
+ * "head" = n + 1. Every reader keeps its own cursor (the next record
+ * number it wants); if head - cursor > capacity the records in between
+ * were overwritten (overrun). A copied record is valid only if its "seq"
+ * equals the cursor before and after the copy.
+ */
+#define RTD_HIST_NAME	"/rtdd-history"
+#define RTD_HIST_MAGIC	0x53484452 // "RDHS"
+#define RTD_HIST_VERSION	1
+#define RTD_HIST_CAPACITY_DEFAULT	65536
+#define RTD_HIST_CAPACITY_MAX	(1 << 24) // 512 MiB
+#define RTD_HIST_SEQ_BUSY	UINT64_MAX
+
+typedef struct
+{
+	uint64_t tsNs; // CLOCK_MONOTONIC
+	uint64_t seq;
+	uint8_t bus;
+	uint8_t stack;
+	uint8_t channel; // 1..8
+	uint8_t status; // 0 = valid, else RTD_FAULT_* (fault.h)
+	float temp;
+	float res;
+	uint32_t res1;
+} RtdHistRecType;
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t recSize;
+	uint32_t capacity;
+	uint64_t head; // number of records written
+	uint64_t res1;
+	RtdHistRecType rec[];
+} RtdHistType;
+
+_Static_assert(sizeof(RtdHistRecType) == 32, "history layout");
+_Static_assert(sizeof(RtdHistType) == 32, "history layout");
+
+int rtdHistCreate(uint32_t capacity);
+void rtdHistPush(RtdHistRecType *rec);
+int rtdHistOpen(void);
+uint64_t rtdHistHead(void);
+uint32_t rtdHistCapacity(void);
+int rtdHistRead(uint64_t *cursor, RtdHistRecType *out, int max, uint64_t *lost);
+
+#endif //RTDHIST_H_
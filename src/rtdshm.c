@@ -0,0 +1,163 @@
+/*
+ * rtdshm.c:
+ *	Shared memory snapshot of the latest readings, see rtdshm.h
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "rtd.h"
+#include "rtdshm.h"
+
+static RtdShmType *gShm = NULL;
+static int gShmWriter = 0;
+
+static uint64_t rtdShmNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/*
+ * rtdShmCreate:
+ *	Writer side (rtdd), create or reset the snapshot
+ */
+int rtdShmCreate(void)
+{
+	int fd = 0;
+
+	fd = shm_open(RTD_SHM_NAME, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+	{
+		return ERROR;
+	}
+	fchmod(fd, 0644);
+	if (0 != ftruncate(fd, sizeof(RtdShmType)))
+	{
+		close(fd);
+		return ERROR;
+	}
+	gShm = mmap(NULL, sizeof(RtdShmType), PROT_READ | PROT_WRITE, MAP_SHARED,
+		fd, 0);
+	close(fd);
+	if (MAP_FAILED == gShm)
+	{
+		gShm = NULL;
+		return ERROR;
+	}
+	memset(gShm, 0, sizeof(RtdShmType));
+	gShm->version = RTD_SHM_VERSION;
+	gShm->boardSize = sizeof(RtdShmBoardType);
+	gShm->boardsMax = RTD_SHM_BOARDS_MAX;
+	__atomic_store_n(&gShm->magic, RTD_SHM_MAGIC, __ATOMIC_RELEASE);
+	gShmWriter = 1;
+	return OK;
+}
+
+void rtdShmPublish(const RtdShmBoardType *board)
+{
+	RtdShmBoardType *pB = NULL;
+	uint32_t seq = 0;
+	int idx = board->bus * RTD_SHM_CH_NR + board->stack;
+
+	if ( (NULL == gShm) || !gShmWriter || (idx >= RTD_SHM_BOARDS_MAX))
+	{
+		return;
+	}
+	pB = &gShm->board[idx];
+	seq = pB->seqlock;
+	__atomic_store_n(&pB->seqlock, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memcpy((u8*)pB + sizeof(uint32_t), (const u8*)board + sizeof(uint32_t),
+		sizeof(RtdShmBoardType) - sizeof(uint32_t));
+	__atomic_store_n(&pB->seqlock, seq + 2, __ATOMIC_RELEASE);
+	__atomic_store_n(&gShm->updateNs, rtdShmNow(), __ATOMIC_RELAXED);
+}
+
+static int rtdShmOpen(void)
+{
+	RtdShmType *pShm = NULL;
+	struct stat st;
+	int fd = 0;
+
+	fd = shm_open(RTD_SHM_NAME, O_RDONLY | O_NOFOLLOW, 0);
+	if (fd < 0)
+	{
+		return ERROR;
+	}
+	if ( (0 != fstat(fd, &st)) || ( (st.st_uid != 0) && (st.st_uid != geteuid()))
+		|| (st.st_size < (off_t)sizeof(RtdShmType)))
+	{
+		close(fd); // not published by rtdd
+		return ERROR;
+	}
+	pShm = mmap(NULL, sizeof(RtdShmType), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (MAP_FAILED == pShm)
+	{
+		return ERROR;
+	}
+	if ( (__atomic_load_n(&pShm->magic, __ATOMIC_ACQUIRE) != RTD_SHM_MAGIC)
+		|| (pShm->version != RTD_SHM_VERSION)
+		|| (pShm->boardSize != sizeof(RtdShmBoardType)))
+	{
+		munmap(pShm, sizeof(RtdShmType));
+		return ERROR;
+	}
+	gShm = pShm;
+	return OK;
+}
+
+/*
+ * rtdShmRead:
+ *	Consistent copy of one board entry, no system call once mapped.
+ *	Return ERROR if there is no snapshot, rtdd does not poll the board or
+ *	the entry never settles
+ */
+int rtdShmRead(int bus, int stack, RtdShmBoardType *board)
+{
+	RtdShmBoardType *pB = NULL;
+	uint32_t seq1 = 0;
+	uint32_t seq2 = 0;
+	int tries = 0;
+	int idx = bus * RTD_SHM_CH_NR + stack;
+
+	if ( (NULL == board) || (bus < 0) || (stack < 0) || (stack > 7)
+		|| (idx >= RTD_SHM_BOARDS_MAX))
+	{
+		return ERROR;
+	}
+	if ( (NULL == gShm) && (OK != rtdShmOpen()))
+	{
+		return ERROR;
+	}
+	pB = &gShm->board[idx];
+	do
+	{
+		if (tries++ >= RTD_SHM_READ_TRIES)
+		{
+			return ERROR;
+		}
+		seq1 = __atomic_load_n(&pB->seqlock, __ATOMIC_ACQUIRE);
+		if (seq1 & 1)
+		{
+			continue; // writer in progress
+		}
+		memcpy(board, pB, sizeof(RtdShmBoardType));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		seq2 = __atomic_load_n(&pB->seqlock, __ATOMIC_RELAXED);
+	} while ( (seq1 & 1) || (seq1 != seq2));
+	return board->present ? OK : ERROR;
+}
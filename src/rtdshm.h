@@ -0,0 +1,76 @@
+#ifndef RTDSHM_H_
+#define RTDSHM_H_
+
+#include <stdint.h>
+
+/*
+ * Latest readings published by rtdd in the POSIX shared memory object
+ * "/rtdd-snapshot" (/dev/shm/rtdd-snapshot). Fixed little-endian layout,
+ * no implicit padding, so any language can mmap it:
+ *
+ *	RtdShmType header                24 bytes
+ *	RtdShmBoardType board[256]       304 bytes each, index = bus * 8 + stack
+ *
+ * Every board entry is protected by a seqlock: the single writer makes
+ * "seqlock" odd, updates the entry, then makes it even again. A reader
+ * reads "seqlock", copies the entry and reads "seqlock" again; the copy is
+ * consistent if both values are equal and even, otherwise it retries, at
+ * most RTD_SHM_READ_TRIES times: a writer that died in the middle of an
+ * update leaves the entry odd for ever.
+ *
+ * The object must belong to root (or to the reader), anybody could create
+ * it while rtdd is not running.
+ */
+#define RTD_SHM_NAME	"/rtdd-snapshot"
+#define RTD_SHM_MAGIC	0x50534452 // "RDSP"
+#define RTD_SHM_VERSION	2
+#define RTD_SHM_BOARDS_MAX	256
+#define RTD_SHM_CH_NR	8
+#define RTD_SHM_READ_TRIES	10000
+
+typedef struct
+{
+	float temp; // deg C, as computed by the card
+	float res; // ohms
+	uint64_t tsNs; // CLOCK_MONOTONIC time of the reading
+	uint32_t seq; // readings count for this channel
+	int32_t status; // 0 = valid, -1 board not read, else RTD_FAULT_* (fault.h)
+	float tempFilt; // through the filter chain (filter.h), temp without one
+	float resFilt;
+} RtdShmChType;
+
+typedef struct
+{
+	uint32_t seqlock;
+	uint8_t present; // 1 if rtdd polls this board
+	uint8_t bus;
+	uint8_t stack;
+	uint8_t hwType;
+	uint64_t tsNs; // last successful poll
+	float vIn;
+	float vRasp;
+	int32_t cpuTemp;
+	int32_t wdtResets;
+	uint64_t polls;
+	uint64_t pollErrors;
+	RtdShmChType ch[RTD_SHM_CH_NR];
+} RtdShmBoardType;
+
+typedef struct
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t boardSize; // sizeof(RtdShmBoardType)
+	uint32_t boardsMax;
+	uint64_t updateNs; // last time any board was written
+	RtdShmBoardType board[RTD_SHM_BOARDS_MAX];
+} RtdShmType;
+
+_Static_assert(sizeof(RtdShmChType) == 32, "shm layout");
+_Static_assert(sizeof(RtdShmBoardType) == 304, "shm layout");
+
+int rtdShmCreate(void);
+void rtdShmPublish(const RtdShmBoardType *board);
+int rtdShmRead(int bus, int stack, RtdShmBoardType *board);
+
+#endif //RTDSHM_H_
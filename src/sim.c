@@ -0,0 +1,405 @@
+/*
+ * sim.c:
+ *	In-process simulated RTD card, models the card register map so the
+ *	command line and the polling code can run without hardware
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "rtd.h"
+#include "sim.h"
+
+#define SIM_DEV_BASE	0x100
+#define SIM_BUS_MAX	16
+#define SIM_ADD_MIN	SLAVE_OWN_ADDRESS_BASE
+#define SIM_ADD_MAX	(SLAVE_OWN_ADDRESS_BASE + 7)
+#define SIM_PT100_R0	100.0
+#define SIM_PT_ALPHA	0.00385
+#define SIM_OPEN_RES	8000.0 // ADC at full scale, PT100 range
+#define SIM_SHORT_RES	0.4 // the lead wires
+
+typedef struct
+{
+	int init;
+	u8 mem[SLAVE_BUFF_SIZE + 1];
+	float r0[RTD_CH_NR_MAX]; // nominal resistance of every simulated probe
+	uint64_t lastConv;
+	int nextCh;
+} SimBoardType;
+
+static SimConfigType gSimCfg =
+{
+	1 << 1,
+	0x01,
+	50,
+	0.02,
+	0,
+	0,
+	0,
+	0};
+static int gSimCfgLoaded = 0;
+static SimBoardType gSimBoards[SIM_BUS_MAX][SIM_ADD_MAX - SIM_ADD_MIN + 1];
+static unsigned int gSimSeed = 1;
+static pthread_mutex_t gSimMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t simNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static float simRand(void)
+{
+	return (float)rand_r(&gSimSeed) / ((float)RAND_MAX + 1);
+}
+
+static float simGauss(void)
+{
+	float u1 = simRand();
+	float u2 = simRand();
+
+	if (u1 < 1e-9)
+	{
+		u1 = 1e-9;
+	}
+	return sqrtf(-2 * logf(u1)) * cosf(2 * M_PI * u2);
+}
+
+static void simConfigLoad(void)
+{
+	char *env = NULL;
+
+	if (gSimCfgLoaded)
+	{
+		return;
+	}
+	gSimCfgLoaded = 1;
+	gSimSeed = (unsigned int)simNow() ^ (unsigned int)getpid();
+	if (NULL != (env = getenv("RTD_SIM_BUSES")))
+	{
+		gSimCfg.buses = 0xffff & strtol(env, NULL, 0);
+	}
+	if (NULL != (env = getenv("RTD_SIM_BOARDS")))
+	{
+		gSimCfg.boards = 0xff & strtol(env, NULL, 0);
+	}
+	if (NULL != (env = getenv("RTD_SIM_SPS")))
+	{
+		gSimCfg.sps = atof(env);
+	}
+	if (NULL != (env = getenv("RTD_SIM_NOISE")))
+	{
+		gSimCfg.noise = atof(env);
+	}
+	if (NULL != (env = getenv("RTD_SIM_ERR")))
+	{
+		gSimCfg.errRate = atof(env);
+	}
+	if (NULL != (env = getenv("RTD_SIM_OPEN")))
+	{
+		gSimCfg.open = 0xff & strtol(env, NULL, 0);
+	}
+	if (NULL != (env = getenv("RTD_SIM_SHORT")))
+	{
+		gSimCfg.shorted = 0xff & strtol(env, NULL, 0);
+	}
+	if (NULL != (env = getenv("RTD_SIM_STUCK")))
+	{
+		gSimCfg.stuck = 0xff & strtol(env, NULL, 0);
+	}
+}
+
+void simConfigGet(SimConfigType *cfg)
+{
+	pthread_mutex_lock(&gSimMutex);
+	simConfigLoad();
+	*cfg = gSimCfg;
+	pthread_mutex_unlock(&gSimMutex);
+}
+
+void simConfigSet(const SimConfigType *cfg)
+{
+	pthread_mutex_lock(&gSimMutex);
+	gSimCfgLoaded = 1;
+	gSimCfg = *cfg;
+	pthread_mutex_unlock(&gSimMutex);
+}
+
+static void simMemSet16(SimBoardType *b, int add, u16 val)
+{
+	memcpy(&b->mem[add], &val, 2);
+}
+
+static void simConvert(SimBoardType *b);
+
+static void simBoardInit(SimBoardType *b, int stack)
+{
+	int i;
+
+	memset(b, 0, sizeof(SimBoardType));
+	b->init = 1;
+	b->mem[DIAG_TEMPERATURE_MEM_ADD] = 35;
+	simMemSet16(b, DIAG_5V_MEM_ADD, 24000);
+	simMemSet16(b, RTD_RASP_VOLT, 5100);
+	simMemSet16(b, I2C_MEM_WDT_INTERVAL_GET_ADD, 120);
+	simMemSet16(b, I2C_MEM_WDT_INIT_INTERVAL_GET_ADD, 270);
+	b->mem[REVISION_HW_MAJOR_MEM_ADD] = 5;
+	b->mem[REVISION_HW_MINOR_MEM_ADD] = 0;
+	b->mem[REVISION_MAJOR_MEM_ADD] = 1;
+	b->mem[REVISION_MINOR_MEM_ADD] = 5;
+	b->mem[RTD_CARD_TYPE] = 1;
+	simMemSet16(b, I2C_MEM_ADS_SAMPLE_SWITCH, 10);
+	for (i = 0; i < RTD_CH_NR_MAX; i++)
+	{
+		// every channel sits a few degrees apart around room temperature
+		b->r0[i] = SIM_PT100_R0 * (1 + SIM_PT_ALPHA * (20 + 2 * i + stack));
+	}
+	// start as a card that has been running for a while, all channels valid
+	b->lastConv = 0;
+	simConvert(b);
+	b->lastConv = simNow();
+}
+
+/*
+ * simConvert:
+ *	The card converts one channel at a time, advance the conversions that
+ *	happened since the last access at the configured rate
+ */
+static void simConvert(SimBoardType *b)
+{
+	uint64_t now = simNow();
+	uint64_t period = 0;
+	uint64_t n = 0;
+	float res = 0;
+	float temp = 0;
+	float scale = 1;
+	int first = (b->lastConv == 0); // the conversions of the power up
+	int ch = 0;
+
+	if (gSimCfg.sps <= 0)
+	{
+		return;
+	}
+	period = (uint64_t) (1e9 / gSimCfg.sps);
+	if (period == 0)
+	{
+		period = 1;
+	}
+	n = (now - b->lastConv) / period;
+	b->lastConv += n * period;
+	if (n > RTD_CH_NR_MAX)
+	{
+		n = RTD_CH_NR_MAX;
+	}
+	if (b->mem[I2C_MEM_PT1000] & 0x0f)
+	{
+		scale = 10;
+	}
+	while (n--)
+	{
+		ch = b->nextCh;
+		b->nextCh = (b->nextCh + 1) % RTD_CH_NR_MAX;
+		// slow drift of a fraction of degree plus the conversion noise
+		res = b->r0[ch] + 0.2 * sinf(now / 6e10 + ch);
+		res += gSimCfg.noise * simGauss();
+		if ( (gSimCfg.stuck & (1 << ch)) && !first)
+		{
+			continue; // keeps the value of the first conversion
+		}
+		if (gSimCfg.open & (1 << ch))
+		{
+			res = SIM_OPEN_RES;
+		}
+		else if (gSimCfg.shorted & (1 << ch))
+		{
+			res = SIM_SHORT_RES;
+		}
+		res *= scale;
+		temp = (res / (SIM_PT100_R0 * scale) - 1) / SIM_PT_ALPHA;
+		memcpy(&b->mem[RTD_RES1_ADD + sizeof(float) * ch], &res, sizeof(float));
+		memcpy(&b->mem[RTD_VAL1_ADD + sizeof(float) * ch], &temp, sizeof(float));
+	}
+}
+
+/*
+ * The handle encodes the bus and the stack level: base + bus * 8 + stack
+ */
+static SimBoardType* simBoardGet(int dev)
+{
+	int bus = (dev - SIM_DEV_BASE) / RTD_CH_NR_MAX;
+	int idx = (dev - SIM_DEV_BASE) % RTD_CH_NR_MAX;
+
+	if ( (dev < SIM_DEV_BASE) || (bus >= SIM_BUS_MAX))
+	{
+		return NULL;
+	}
+	if (! (gSimCfg.buses & (1 << bus)) || ! (gSimCfg.boards & (1 << idx)))
+	{
+		return NULL; // no card at this address, same as a NACK
+	}
+	if (!gSimBoards[bus][idx].init)
+	{
+		simBoardInit(&gSimBoards[bus][idx], idx);
+	}
+	return &gSimBoards[bus][idx];
+}
+
+static int simSetup(int bus, int addr)
+{
+	int ret = 0;
+
+	pthread_mutex_lock(&gSimMutex);
+	simConfigLoad();
+	if ( (bus < 0) || (bus >= SIM_BUS_MAX) || ! (gSimCfg.buses & (1 << bus)))
+	{
+		ret = COMM_SETUP_BUS;
+	}
+	else if ( (addr < SIM_ADD_MIN) || (addr > SIM_ADD_MAX))
+	{
+		ret = COMM_SETUP_ADDR;
+	}
+	else
+	{
+		ret = SIM_DEV_BASE + bus * RTD_CH_NR_MAX + addr - SIM_ADD_MIN;
+	}
+	pthread_mutex_unlock(&gSimMutex);
+	return ret;
+}
+
+static int simBusList(int *buses, int max)
+{
+	int cnt = 0;
+	int i;
+
+	pthread_mutex_lock(&gSimMutex);
+	simConfigLoad();
+	for (i = 0; (i < SIM_BUS_MAX) && (cnt < max); i++)
+	{
+		if (gSimCfg.buses & (1 << i))
+		{
+			buses[cnt++] = i;
+		}
+	}
+	pthread_mutex_unlock(&gSimMutex);
+	return cnt;
+}
+
+static int simCheck(SimBoardType *b, int add, uint8_t* buff, int size)
+{
+	if (NULL == b)
+	{
+		errno = EREMOTEIO;
+		return -1;
+	}
+	if ( (NULL == buff) || (add < 0) || (size < 0)
+		|| (add + size > SLAVE_BUFF_SIZE + 1))
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	if ( (gSimCfg.errRate > 0) && (simRand() < gSimCfg.errRate))
+	{
+		errno = EREMOTEIO;
+		return -1;
+	}
+	return 0;
+}
+
+static int simRead(int dev, int add, uint8_t* buff, int size)
+{
+	SimBoardType *b = NULL;
+	int ret = 0;
+
+	pthread_mutex_lock(&gSimMutex);
+	simConfigLoad();
+	b = simBoardGet(dev);
+	ret = simCheck(b, add, buff, size);
+	if (ret == 0)
+	{
+		simConvert(b);
+		memcpy(buff, &b->mem[add], size);
+	}
+	pthread_mutex_unlock(&gSimMutex);
+	return ret;
+}
+
+/*
+ * simWriteSideEffects:
+ *	Mirror what the card firmware does with the command registers
+ */
+static void simWriteSideEffects(SimBoardType *b, int add, int size)
+{
+	int i;
+
+	for (i = add; i < add + size; i++)
+	{
+		switch (i)
+		{
+		case I2C_MEM_WDT_INTERVAL_SET_ADD:
+			memcpy(&b->mem[I2C_MEM_WDT_INTERVAL_GET_ADD],
+				&b->mem[I2C_MEM_WDT_INTERVAL_SET_ADD], 2);
+			break;
+		case I2C_MEM_WDT_INIT_INTERVAL_SET_ADD:
+			memcpy(&b->mem[I2C_MEM_WDT_INIT_INTERVAL_GET_ADD],
+				&b->mem[I2C_MEM_WDT_INIT_INTERVAL_SET_ADD], 2);
+			break;
+		case I2C_MEM_WDT_POWER_OFF_INTERVAL_SET_ADD:
+			memcpy(&b->mem[I2C_MEM_WDT_POWER_OFF_INTERVAL_GET_ADD],
+				&b->mem[I2C_MEM_WDT_POWER_OFF_INTERVAL_SET_ADD], 4);
+			break;
+		case I2C_MEM_WDT_CLEAR_RESET_COUNT_ADD:
+			if (b->mem[i] == WDT_RESET_COUNT_SIGNATURE)
+			{
+				simMemSet16(b, I2C_MEM_WDT_RESET_COUNT_ADD, 0);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+static int simWrite(int dev, int add, uint8_t* buff, int size)
+{
+	SimBoardType *b = NULL;
+	int ret = 0;
+
+	pthread_mutex_lock(&gSimMutex);
+	simConfigLoad();
+	b = simBoardGet(dev);
+	ret = simCheck(b, add, buff, size);
+	if (ret == 0)
+	{
+		memcpy(&b->mem[add], buff, size);
+		simWriteSideEffects(b, add, size);
+	}
+	pthread_mutex_unlock(&gSimMutex);
+	return ret;
+}
+
+static void simClose(int dev)
+{
+	(void)dev; // the board state lives for the whole process
+}
+
+const CommTransportType gSimTransport =
+{
+	"sim",
+	&simSetup,
+	&simRead,
+	&simWrite,
+	&simClose,
+	&simBusList};
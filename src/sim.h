@@ -0,0 +1,28 @@
+#ifndef SIM_H_
+#define SIM_H_
+
+#include "comm.h"
+
+/*
+ * Simulated board configuration, the defaults can be overridden with the
+ * RTD_SIM_BUSES, RTD_SIM_BOARDS, RTD_SIM_SPS, RTD_SIM_NOISE, RTD_SIM_ERR,
+ * RTD_SIM_OPEN, RTD_SIM_SHORT and RTD_SIM_STUCK environment variables or by calling simConfigSet() before the first bus access
+ */
+typedef struct
+{
+	int buses; // bit mask of the simulated i2c buses
+	int boards; // bit mask of the stack levels present on every bus
+	float sps; // ADC conversions per second, one channel per conversion
+	float noise; // resistance noise standard deviation in ohms
+	float errRate; // probability of a failed transfer [0..1]
+	int open; // bit mask of the channels with a broken sensor wire
+	int shorted; // bit mask of the channels with the sensor shorted
+	int stuck; // bit mask of the channels that are never converted again
+} SimConfigType;
+
+extern const CommTransportType gSimTransport;
+
+void simConfigGet(SimConfigType *cfg);
+void simConfigSet(const SimConfigType *cfg);
+
+#endif //SIM_H_
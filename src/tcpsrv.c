@@ -0,0 +1,108 @@
+/*
+ * tcpsrv.c:
+ *	TCP listener of the rtdd network services, one thread per connection.
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include "rtd.h"
+#include "tcpsrv.h"
+
+static void* tcpSrvAcceptThread(void *arg)
+{
+	TcpSrvType *srv = (TcpSrvType*)arg;
+	struct timeval tv = {srv->timeoutS, 0};
+	pthread_t thread;
+	int one = 1;
+	int fd = 0;
+
+	while (1)
+	{
+		fd = accept(srv->fd, NULL, NULL);
+		if (fd < 0)
+		{
+			continue;
+		}
+		if (srv->timeoutS > 0)
+		{
+			setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+			setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+		}
+		if (srv->noDelay)
+		{
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+		}
+		if (0 != pthread_create(&thread, NULL, srv->client, (void*)(intptr_t)fd))
+		{
+			close(fd);
+			continue;
+		}
+		pthread_detach(thread);
+	}
+	return NULL;
+}
+
+/*
+ * tcpSrvListen:
+ *	Bind and listen on the given TCP port, all interfaces
+ */
+int tcpSrvListen(TcpSrvType *srv, int port)
+{
+	struct sockaddr_in sa;
+	int one = 1;
+
+	if ( (NULL == srv) || (NULL == srv->client))
+	{
+		return ERROR;
+	}
+	srv->fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (srv->fd < 0)
+	{
+		return ERROR;
+	}
+	setsockopt(srv->fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+	memset(&sa, 0, sizeof(sa));
+	sa.sin_family = AF_INET;
+	sa.sin_addr.s_addr = htonl(INADDR_ANY);
+	sa.sin_port = htons(port);
+	if ( (bind(srv->fd, (struct sockaddr*)&sa, sizeof(sa)) < 0)
+		|| (listen(srv->fd, 8) < 0))
+	{
+		close(srv->fd);
+		srv->fd = -1;
+		return ERROR;
+	}
+	return OK;
+}
+
+/*
+ * tcpSrvStart:
+ *	Serve the connections of a listening port from a background thread
+ */
+int tcpSrvStart(TcpSrvType *srv)
+{
+	pthread_t thread;
+
+	if ( (NULL == srv) || (srv->fd < 0))
+	{
+		return ERROR;
+	}
+	if (0 != pthread_create(&thread, NULL, tcpSrvAcceptThread, srv))
+	{
+		return ERROR;
+	}
+	pthread_detach(thread);
+	return OK;
+}
@@ -0,0 +1,22 @@
+#ifndef TCPSRV_H_
+#define TCPSRV_H_
+
+/*
+ * TCP listener shared by the rtdd network services (Modbus TCP, metrics).
+ * tcpSrvListen() binds the port while rtdd is still attached to the
+ * terminal, so a busy port is reported; tcpSrvStart() runs the accept
+ * thread, one detached "client" thread per connection with the socket as
+ * argument.
+ */
+typedef struct
+{
+	int fd;
+	int timeoutS; // receive / send timeout of the client sockets
+	int noDelay; // TCP_NODELAY on the client sockets
+	void* (*client)(void *arg);
+} TcpSrvType;
+
+int tcpSrvListen(TcpSrvType *srv, int port);
+int tcpSrvStart(TcpSrvType *srv);
+
+#endif //TCPSRV_H_
@@ -2,6 +2,8 @@
 #include <string.h>
 #include <termios.h>
 #include <pthread.h>
+#include <errno.h>
+#include <time.h>
 
 #include "thread.h"
 
@@ -106,3 +108,48 @@ void busyWait(int ms)
 
   nanosleep (&sleeper, &dummy) ;
 }
+
+/*
+ * periodicStart:
+ *	Start a fixed rate schedule, the first deadline is one period from now
+ *********************************************************************************
+ */
+
+void periodicStart(PeriodicType *p, long long periodNs)
+{
+	clock_gettime(CLOCK_MONOTONIC, &p->next);
+	p->periodNs = periodNs;
+}
+
+/*
+ * periodicWait:
+ *	Sleep until the next deadline of the schedule. The deadlines are
+ *	absolute so the time spent between the calls does not add up as drift.
+ *	Return the number of deadlines already missed, they are skipped to stay
+ *	on the original cadence
+ *********************************************************************************
+ */
+
+int periodicWait(PeriodicType *p)
+{
+	struct timespec now;
+	long long late = 0;
+	int missed = 0;
+
+	p->next.tv_nsec += p->periodNs % 1000000000ll;
+	p->next.tv_sec += p->periodNs / 1000000000ll + p->next.tv_nsec / 1000000000;
+	p->next.tv_nsec %= 1000000000;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	late = (now.tv_sec - p->next.tv_sec) * 1000000000ll + now.tv_nsec
+		- p->next.tv_nsec;
+	if (late >= 0)
+	{
+		missed = late / p->periodNs + 1;
+		late = (long long)missed * p->periodNs + p->next.tv_nsec;
+		p->next.tv_sec += late / 1000000000ll;
+		p->next.tv_nsec = late % 1000000000ll;
+	}
+	while (EINTR == clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &p->next, NULL))
+		;
+	return missed;
+}
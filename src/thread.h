@@ -1,6 +1,8 @@
 #ifndef _THREAD_H_
 #define _THREAD_H_
 
+#include <time.h>
+
 #define	COUNT_KEY	0
 #define YES		1
 #define NO		2
@@ -9,7 +11,15 @@
 #define	PI_THREAD(X)	void *X (UNU void *dummy)
 
 
+typedef struct
+{
+	struct timespec next; // CLOCK_MONOTONIC deadline of the next cycle
+	long long periodNs;
+} PeriodicType;
+
 void busyWait(int ms);
+void periodicStart(PeriodicType *p, long long periodNs);
+int periodicWait(PeriodicType *p);
 void startThread(void);
 int checkThreadResult(void);
 
@@ -0,0 +1,189 @@
+/*
+ * topo.c:
+ *	Board topology cache shared between the rtd processes
+ *
+ *	Copyright (c) 2016-2023 Sequent Microsystem
+ *	<http://www.sequentmicrosystem.com>
+ ***********************************************************************
+ */
+#define _GNU_SOURCE // secure_getenv
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "rtd.h"
+#include "topo.h"
+
+static int gTopoFd = -2; // not opened yet
+static int64_t gTopoTtlNs = -1;
+
+static uint64_t topoNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint8_t topoCheck(const RtdTopoType *t)
+{
+	const uint8_t *p = (const uint8_t*)t;
+	uint8_t sum = 0x5a;
+	unsigned i = 0;
+
+	for (i = 0; i < offsetof(RtdTopoType, check); i++)
+	{
+		sum = (sum << 1 | sum >> 7) ^ p[i];
+	}
+	return sum;
+}
+
+static void topoInvalidateHook(int bus, int addr)
+{
+	if ( (addr >= SLAVE_OWN_ADDRESS_BASE) && (addr < SLAVE_OWN_ADDRESS_BASE + 8))
+	{
+		topoInvalidate(bus, addr - SLAVE_OWN_ADDRESS_BASE);
+	}
+}
+
+/*
+ * topoOpen:
+ *	Open the cache file once per process, read only for the users that can
+ *	not write /run. Return -1 if the cache is off or not usable. rtd runs
+ *	setuid root: the environment is ignored then, and the file must be a
+ *	regular one owned by root or by the caller
+ */
+static int topoOpen(void)
+{
+	const char *path = secure_getenv("RTD_TOPOLOGY");
+	char *env = secure_getenv("RTD_TOPO_TTL");
+	struct stat st;
+	mode_t mask = 0;
+
+	if (gTopoFd != -2)
+	{
+		return gTopoFd;
+	}
+	gTopoFd = -1;
+	gTopoTtlNs = (int64_t) ( (NULL != env) ? atof(env) : RTD_TOPO_TTL_DEFAULT)
+		* 1000000000ll;
+	if (gTopoTtlNs <= 0)
+	{
+		return -1;
+	}
+	if ( (NULL == path) || (*path == 0))
+	{
+		path = RTD_TOPO_PATH;
+	}
+	mask = umask(0);
+	gTopoFd = open(path, O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW, 0644);
+	umask(mask);
+	if (gTopoFd < 0)
+	{
+		gTopoFd = open(path, O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+	}
+	if ( (gTopoFd >= 0) && ( (0 != fstat(gTopoFd, &st)) || !S_ISREG(st.st_mode)
+		|| ( (st.st_uid != 0) && (st.st_uid != geteuid()))))
+	{
+		close(gTopoFd);
+		gTopoFd = -1;
+	}
+	if (gTopoFd >= 0)
+	{
+		i2cFailHookSet(topoInvalidateHook);
+	}
+	return gTopoFd;
+}
+
+/*
+ * topoGet:
+ *	Return TOPO_PRESENT (t filled) or TOPO_ABSENT for a card seen less
+ *	than a TTL ago, TOPO_UNKNOWN otherwise
+ */
+int topoGet(int bus, int stack, RtdTopoType *t)
+{
+	RtdTopoType e;
+	int64_t ttl = 0;
+	int idx = bus * 8 + stack;
+	int fd = topoOpen();
+
+	if ( (fd < 0) || (idx < 0) || (idx >= RTD_TOPO_ENTRIES) || (stack < 0)
+		|| (stack > 7))
+	{
+		return TOPO_UNKNOWN;
+	}
+	if ( (sizeof(e) != pread(fd, &e, sizeof(e), idx * sizeof(e)))
+		|| (e.check != topoCheck(&e)))
+	{
+		return TOPO_UNKNOWN;
+	}
+	ttl = gTopoTtlNs;
+	if ( (e.state == TOPO_ABSENT) && (ttl > RTD_TOPO_ABSENT_TTL * 1000000000ll))
+	{
+		ttl = RTD_TOPO_ABSENT_TTL * 1000000000ll;
+	}
+	if (topoNow() - e.tsNs > (uint64_t)ttl)
+	{
+		return TOPO_UNKNOWN;
+	}
+	if ( (e.state == TOPO_PRESENT) && (NULL != t))
+	{
+		*t = e;
+	}
+	return e.state;
+}
+
+static int topoWrite(int bus, int stack, RtdTopoType *e)
+{
+	int idx = bus * 8 + stack;
+	int fd = topoOpen();
+
+	if ( (fd < 0) || (idx < 0) || (idx >= RTD_TOPO_ENTRIES) || (stack < 0)
+		|| (stack > 7))
+	{
+		return ERROR;
+	}
+	e->check = topoCheck(e);
+	if (sizeof(*e) != pwrite(fd, e, sizeof(*e), idx * sizeof(*e)))
+	{
+		return ERROR; // read only cache
+	}
+	return OK;
+}
+
+void topoPut(int bus, int stack, const RtdTopoType *t)
+{
+	RtdTopoType e = *t;
+
+	e.tsNs = topoNow();
+	e.state = TOPO_PRESENT;
+	topoWrite(bus, stack, &e);
+}
+
+void topoAbsent(int bus, int stack)
+{
+	RtdTopoType e;
+
+	memset(&e, 0, sizeof(e));
+	e.tsNs = topoNow();
+	e.state = TOPO_ABSENT;
+	topoWrite(bus, stack, &e);
+}
+
+void topoInvalidate(int bus, int stack)
+{
+	RtdTopoType e;
+
+	if (TOPO_UNKNOWN == topoGet(bus, stack, NULL))
+	{
+		return; // nothing to forget, spare the write
+	}
+	memset(&e, 0, sizeof(e));
+	topoWrite(bus, stack, &e);
+}
@@ -0,0 +1,52 @@
+#ifndef TOPO_H_
+#define TOPO_H_
+
+#include <stdint.h>
+
+#include "comm.h"
+
+/*
+ * Cache of the cards found on every bus, shared by all the rtd processes
+ * through the file /run/rtd-topology (RTD_TOPOLOGY environment variable),
+ * so a command does not probe its card before the real work. Present cards
+ * expire after RTD_TOPO_TTL seconds (default 60, 0 turns the cache off),
+ * absent ones after RTD_TOPO_ABSENT_TTL, and a card is forgotten as soon
+ * as a transfer to it fails.
+ *
+ * The file is an array of RtdTopoType, index bus * 8 + stack. Every entry
+ * is written with one pwrite() and carries a checksum, a torn entry is
+ * treated as unknown.
+ */
+#define RTD_TOPO_PATH	"/run/rtd-topology"
+#define RTD_TOPO_TTL_DEFAULT	60
+#define RTD_TOPO_ABSENT_TTL	5 // a card plugged in is seen after this at most
+#define RTD_TOPO_ENTRIES	(I2C_BUS_MAX * 8)
+
+#define TOPO_UNSET	0xff // hwType or sensorType not read yet
+
+enum
+{
+	TOPO_UNKNOWN = 0,
+	TOPO_PRESENT,
+	TOPO_ABSENT,
+};
+
+typedef struct
+{
+	uint64_t tsNs; // CLOCK_MONOTONIC, /run does not survive a reboot
+	uint8_t state; // TOPO_*
+	uint8_t hwType; // RTD_CARD_TYPE
+	uint8_t hwMajor;
+	uint8_t hwMinor;
+	uint8_t fwMajor;
+	uint8_t fwMinor;
+	uint8_t sensorType; // I2C_MEM_PT1000
+	uint8_t check;
+} RtdTopoType;
+
+int topoGet(int bus, int stack, RtdTopoType *t);
+void topoPut(int bus, int stack, const RtdTopoType *t);
+void topoAbsent(int bus, int stack);
+void topoInvalidate(int bus, int stack);
+
+#endif //TOPO_H_
@@ -30,7 +30,7 @@ int doWdtReload(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 3)
@@ -39,13 +39,13 @@ int doWdtReload(int argc, char *argv[])
 		if (OK != i2cMem8Write(dev, I2C_MEM_WDT_RESET_ADD, buff, 1))
 		{
 			printf("Fail to write watchdog reset key!\n");
-			exit(1);
+			return FAIL;
 		}
 	}
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_WDT_RELOAD.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -73,7 +73,7 @@ int doWdtSetPeriod(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -82,19 +82,19 @@ int doWdtSetPeriod(int argc, char *argv[])
 		if (0 == period)
 		{
 			printf("Invalid period!\n");
-			exit(1);
+			return FAIL;
 		}
 		memcpy(buff, &period, 2);
 		if (OK != i2cMem8Write(dev, I2C_MEM_WDT_INTERVAL_SET_ADD, buff, 2))
 		{
 			printf("Fail to write watchdog period!\n");
-			exit(1);
+			return FAIL;
 		}
 	}
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_WDT_SET_PERIOD.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -122,7 +122,7 @@ int doWdtGetPeriod(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 3)
@@ -130,7 +130,7 @@ int doWdtGetPeriod(int argc, char *argv[])
 		if (OK != i2cMem8Read(dev, I2C_MEM_WDT_INTERVAL_GET_ADD, buff, 2))
 		{
 			printf("Fail to read watchdog period!\n");
-			exit(1);
+			return FAIL;
 		}
 		memcpy(&period, buff, 2);
 		printf("%d\n", (int)period);
@@ -138,7 +138,7 @@ int doWdtGetPeriod(int argc, char *argv[])
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_WDT_GET_PERIOD.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -166,7 +166,7 @@ int doWdtSetInitPeriod(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -175,19 +175,19 @@ int doWdtSetInitPeriod(int argc, char *argv[])
 		if (0 == period)
 		{
 			printf("Invalid period!\n");
-			exit(1);
+			return FAIL;
 		}
 		memcpy(buff, &period, 2);
 		if (OK != i2cMem8Write(dev, I2C_MEM_WDT_INIT_INTERVAL_SET_ADD, buff, 2))
 		{
 			printf("Fail to write watchdog period!\n");
-			exit(1);
+			return FAIL;
 		}
 	}
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_WDT_SET_INIT_PERIOD.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -215,7 +215,7 @@ int doWdtGetInitPeriod(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 3)
@@ -223,7 +223,7 @@ int doWdtGetInitPeriod(int argc, char *argv[])
 		if (OK != i2cMem8Read(dev, I2C_MEM_WDT_INIT_INTERVAL_GET_ADD, buff, 2))
 		{
 			printf("Fail to read watchdog period!\n");
-			exit(1);
+			return FAIL;
 		}
 		memcpy(&period, buff, 2);
 		printf("%d\n", (int)period);
@@ -231,7 +231,7 @@ int doWdtGetInitPeriod(int argc, char *argv[])
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_WDT_GET_INIT_PERIOD.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -261,7 +261,7 @@ int doWdtSetOffPeriod(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 4)
@@ -270,20 +270,20 @@ int doWdtSetOffPeriod(int argc, char *argv[])
 		if ( (0 == period) || (period > WDT_MAX_OFF_INTERVAL_S))
 		{
 			printf("Invalid period!\n");
-			exit(1);
+			return FAIL;
 		}
 		memcpy(buff, &period, 4);
 		if (OK
 			!= i2cMem8Write(dev, I2C_MEM_WDT_POWER_OFF_INTERVAL_SET_ADD, buff, 4))
 		{
 			printf("Fail to write watchdog period!\n");
-			exit(1);
+			return FAIL;
 		}
 	}
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_WDT_SET_OFF_PERIOD.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }
@@ -313,7 +313,7 @@ int doWdtGetOffPeriod(int argc, char *argv[])
 	dev = doBoardInit(atoi(argv[1]));
 	if (dev <= 0)
 	{
-		exit(1);
+		return FAIL;
 	}
 
 	if (argc == 3)
@@ -322,7 +322,7 @@ int doWdtGetOffPeriod(int argc, char *argv[])
 			!= i2cMem8Read(dev, I2C_MEM_WDT_POWER_OFF_INTERVAL_GET_ADD, buff, 4))
 		{
 			printf("Fail to read watchdog period!\n");
-			exit(1);
+			return FAIL;
 		}
 		memcpy(&period, buff, 4);
 		printf("%d\n", (int)period);
@@ -330,7 +330,7 @@ int doWdtGetOffPeriod(int argc, char *argv[])
 	else
 	{
 		printf("Invalid params number:\n %s", CMD_WDT_GET_OFF_PERIOD.usage1);
-		exit(1);
+		return FAIL;
 	}
 	return OK;
 }